@@ -53,6 +53,7 @@ typedef struct ie_network ie_network_t;
 typedef struct ie_executable ie_executable_network_t;
 typedef struct ie_infer_request ie_infer_request_t;
 typedef struct ie_blob ie_blob_t;
+typedef struct ie_completion_queue ie_completion_queue_t;
 
 /**
  * @struct ie_version
@@ -298,6 +299,16 @@ typedef struct ie_complete_call_back {
     void *args;
 } ie_complete_call_back_t;
 
+/**
+ * @struct ie_infer_completion
+ * @brief Represents an asynchronous inference completed by an infer request attached to a completion queue
+ */
+typedef struct ie_infer_completion {
+    ie_infer_request_t *request;  //!< Completed infer request
+    void *user_data;              //!< User data set with the queue to the infer request
+    IEStatusCode status;          //!< Status code of the inference: OK(0) for success
+} ie_infer_completion_t;
+
 /**
  * @struct ie_available_devices
  * @brief Represent all available devices.
@@ -661,6 +672,71 @@ INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_set_batch(ie_
 
 /** @} */ // end of InferRequest
 
+// CompletionQueue
+
+/**
+ * @defgroup CompletionQueue CompletionQueue
+ * Set of functions collecting completed asynchronous inferences of many infer requests,
+ * so they can be processed by an event loop thread without completion callbacks.
+ * @{
+ */
+
+/**
+ * @brief Creates an empty completion queue. Use the ie_completion_queue_free() method to free memory.
+ * @ingroup CompletionQueue
+ * @param queue A pointer to the newly created ie_completion_queue_t instance.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_completion_queue_create(ie_completion_queue_t **queue);
+
+/**
+ * @brief Releases memory occupied by ie_completion_queue_t instance.
+ * Inferences completed after the queue is freed are discarded.
+ * @ingroup CompletionQueue
+ * @param queue A pointer to the ie_completion_queue_t to free memory.
+ */
+INFERENCE_ENGINE_C_API(void) ie_completion_queue_free(ie_completion_queue_t **queue);
+
+/**
+ * @brief Gets a file descriptor that is readable while the queue has completions, so it can be polled
+ * with select/poll/epoll or added to an event loop. The descriptor is owned by the queue and must not be read or closed.
+ * @ingroup CompletionQueue
+ * @param queue A pointer to ie_completion_queue_t instance.
+ * @param fd A pointer to the file descriptor.
+ * @return Status code of the operation: OK(0) for success, NOT_IMPLEMENTED if the OS has no pollable descriptors.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_completion_queue_get_fd(ie_completion_queue_t *queue, int *fd);
+
+/**
+ * @brief Takes completed inferences from the queue.
+ * @ingroup CompletionQueue
+ * @param queue A pointer to ie_completion_queue_t instance.
+ * @param completions A pointer to the array receiving the completions.
+ * @param max_count Size of the completions array.
+ * @param timeout Maximum duration in milliseconds to block for the first completion
+ * @note There are special cases when timeout is equal some value of the WaitMode enum:
+ * * 0 - Immediately returns available completions.
+ * * -1 - waits until a completion becomes available
+ * @param count A pointer to the number of taken completions.
+ * @return Status code of the operation: OK(0) for success, RESULT_NOT_READY if no inference is completed.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_completion_queue_dequeue(ie_completion_queue_t *queue, ie_infer_completion_t *completions,
+                                                                              size_t max_count, const int64_t timeout, size_t *count);
+
+/**
+ * @brief Makes the infer request post its asynchronous inference completions to the queue.
+ * It replaces the completion callback set by ie_infer_set_completion_callback().
+ * @ingroup CompletionQueue
+ * @param infer_request A pointer to ie_infer_request_t instance.
+ * @param queue A pointer to ie_completion_queue_t instance.
+ * @param user_data Data returned with the completions of the request.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_set_completion_queue(ie_infer_request_t *infer_request, ie_completion_queue_t *queue,
+                                                                                        void *user_data);
+
+/** @} */ // end of CompletionQueue
+
 // Network
 
 /**
@@ -14,6 +14,16 @@
 #include <chrono>
 #include <tuple>
 #include <memory>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+#ifdef __linux__
+#include <sys/eventfd.h>
+#endif
 #include <ie_extension.h>
 #include "inference_engine.hpp"
 #include "ie_compound_blob.h"
@@ -61,6 +71,106 @@ struct ie_network {
     IE::CNNNetwork object;
 };
 
+/**
+ * @brief Completions shared by the queue and the callbacks of the attached infer requests,
+ * so requests may complete after the queue is freed
+ */
+struct CompletionQueueState {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<ie_infer_completion_t> completions;
+    bool closed = false;
+    // readable while completions are not empty
+    int read_fd = -1;
+    int write_fd = -1;
+
+    CompletionQueueState() {
+#if defined(__linux__)
+        read_fd = write_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+#elif !defined(_WIN32)
+        int fds[2];
+        if (pipe(fds) == 0) {
+            for (auto fd : fds) {
+                fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+                fcntl(fd, F_SETFD, FD_CLOEXEC);
+            }
+            read_fd = fds[0];
+            write_fd = fds[1];
+        }
+#endif
+    }
+
+    ~CompletionQueueState() {
+#ifndef _WIN32
+        if (read_fd != -1) close(read_fd);
+        if (write_fd != -1 && write_fd != read_fd) close(write_fd);
+#endif
+    }
+
+    void signal() {
+#ifndef _WIN32
+        if (write_fd != -1) {
+            uint64_t one = 1;
+            auto written = write(write_fd, &one, write_fd == read_fd ? sizeof(one) : 1);
+            (void)written;
+        }
+#endif
+    }
+
+    void reset() {
+#ifndef _WIN32
+        if (read_fd != -1) {
+            // eventfd counter is reset by a single read, pipe keeps at most one byte
+            uint64_t value;
+            auto read_bytes = read(read_fd, &value, read_fd == write_fd ? sizeof(value) : 1);
+            (void)read_bytes;
+        }
+#endif
+    }
+
+    void post(const ie_infer_completion_t& completion) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (closed)
+            return;
+        completions.push_back(completion);
+        if (completions.size() == 1)
+            signal();
+        cv.notify_one();
+    }
+};
+
+/**
+ * @struct ie_completion_queue
+ * @brief This struct collects completed asynchronous inferences of many infer requests
+ */
+struct ie_completion_queue {
+    std::shared_ptr<CompletionQueueState> state;
+};
+
+/**
+ * @brief Posts the completion with the inference status to the queue
+ */
+struct CompletionQueueCallback {
+    std::shared_ptr<CompletionQueueState> state;
+    ie_infer_request_t *request;
+    void *user_data;
+};
+
+namespace InferenceEngine {
+namespace details {
+// the status is dropped by wrappers of the general callbacks, so the queue callback gets its own one
+template <>
+class CompletionCallbackWrapper<CompletionQueueCallback> : public ICompletionCallbackWrapper {
+    CompletionQueueCallback callback;
+
+public:
+    explicit CompletionCallbackWrapper(const CompletionQueueCallback& callback): callback(callback) {}
+
+    void call(InferenceEngine::IInferRequest::Ptr, InferenceEngine::StatusCode code) const noexcept override;
+};
+}  // namespace details
+}  // namespace InferenceEngine
+
 std::map<IE::StatusCode, IEStatusCode> status_map = {{IE::StatusCode::GENERAL_ERROR, IEStatusCode::GENERAL_ERROR},
                                                         {IE::StatusCode::INFER_NOT_STARTED, IEStatusCode::INFER_NOT_STARTED},
                                                         {IE::StatusCode::NETWORK_NOT_LOADED,  IEStatusCode::NETWORK_NOT_LOADED},
@@ -1336,6 +1446,90 @@ IEStatusCode ie_infer_request_set_batch(ie_infer_request_t *infer_request, const
     return status;
 }
 
+void IE::details::CompletionCallbackWrapper<CompletionQueueCallback>::call(IE::IInferRequest::Ptr, IE::StatusCode code) const noexcept {
+    auto status = status_map.find(code);
+    callback.state->post({callback.request, callback.user_data, status != status_map.end() ? status->second : IEStatusCode::UNEXPECTED});
+}
+
+IEStatusCode ie_completion_queue_create(ie_completion_queue_t **queue) {
+    if (queue == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        std::unique_ptr<ie_completion_queue_t> tmp(new ie_completion_queue_t);
+        tmp->state = std::make_shared<CompletionQueueState>();
+        *queue = tmp.release();
+    } CATCH_IE_EXCEPTIONS catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+void ie_completion_queue_free(ie_completion_queue_t **queue) {
+    if (queue) {
+        if (*queue) {
+            std::lock_guard<std::mutex> lock((*queue)->state->mutex);
+            (*queue)->state->closed = true;
+            (*queue)->state->completions.clear();
+        }
+        delete *queue;
+        *queue = NULL;
+    }
+}
+
+IEStatusCode ie_completion_queue_get_fd(ie_completion_queue_t *queue, int *fd) {
+    if (queue == nullptr || fd == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+    if (queue->state->read_fd == -1) {
+        return IEStatusCode::NOT_IMPLEMENTED;
+    }
+
+    *fd = queue->state->read_fd;
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_completion_queue_dequeue(ie_completion_queue_t *queue, ie_infer_completion_t *completions,
+                                         size_t max_count, const int64_t timeout, size_t *count) {
+    if (queue == nullptr || completions == nullptr || max_count == 0 || count == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    auto& state = *queue->state;
+    std::unique_lock<std::mutex> lock(state.mutex);
+    auto ready = [&state] { return !state.completions.empty(); };
+    if (timeout < 0) {
+        state.cv.wait(lock, ready);
+    } else if (timeout > 0) {
+        state.cv.wait_for(lock, std::chrono::milliseconds(timeout), ready);
+    }
+
+    *count = std::min(max_count, state.completions.size());
+    std::copy_n(state.completions.begin(), *count, completions);
+    state.completions.erase(state.completions.begin(), state.completions.begin() + *count);
+    if (*count != 0 && state.completions.empty()) {
+        state.reset();
+    }
+
+    return *count != 0 ? IEStatusCode::OK : IEStatusCode::RESULT_NOT_READY;
+}
+
+IEStatusCode ie_infer_request_set_completion_queue(ie_infer_request_t *infer_request, ie_completion_queue_t *queue, void *user_data) {
+    if (infer_request == nullptr || queue == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        infer_request->object.SetCompletionCallback(CompletionQueueCallback{queue->state, infer_request, user_data});
+    } CATCH_IE_EXCEPTIONS catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
 IEStatusCode ie_blob_make_memory(const tensor_desc_t *tensorDesc, ie_blob_t **blob) {
     if (tensorDesc == nullptr || blob == nullptr) {
         return IEStatusCode::GENERAL_ERROR;
@@ -12,6 +12,9 @@
 #include <inference_engine.hpp>
 #include "test_model_repo.hpp"
 #include <fstream>
+#ifndef _WIN32
+#include <poll.h>
+#endif
 
 std::string xml_std = TestDataHelpers::generate_model_path("test_model", "test_model_fp32.xml"),
             bin_std = TestDataHelpers::generate_model_path("test_model", "test_model_fp32.bin"),
@@ -1185,6 +1188,85 @@ TEST(ie_infer_request_infer_async, inferAsyncWaitTime) {
     ie_core_free(&core);
 }
 
+TEST(ie_completion_queue, dequeueCompletionsOfManyRequests) {
+    ie_core_t *core = nullptr;
+    IE_ASSERT_OK(ie_core_create("", &core));
+    ASSERT_NE(nullptr, core);
+
+    ie_network_t *network = nullptr;
+    IE_EXPECT_OK(ie_core_read_network(core, xml, bin, &network));
+    EXPECT_NE(nullptr, network);
+
+    IE_EXPECT_OK(ie_network_set_input_precision(network, "data", precision_e::U8));
+
+    const char *device_name = "CPU";
+    ie_config_t config = {nullptr, nullptr, nullptr};
+    ie_executable_network_t *exe_network = nullptr;
+    IE_EXPECT_OK(ie_core_load_network(core, network, device_name, &config, &exe_network));
+    EXPECT_NE(nullptr, exe_network);
+
+    ie_completion_queue_t *queue = nullptr;
+    IE_ASSERT_OK(ie_completion_queue_create(&queue));
+    ASSERT_NE(nullptr, queue);
+
+    cv::Mat image = cv::imread(input_image);
+    const size_t num_requests = 3;
+    ie_infer_request_t *infer_requests[num_requests] = {};
+    for (size_t i = 0; i < num_requests; i++) {
+        IE_EXPECT_OK(ie_exec_network_create_infer_request(exe_network, &infer_requests[i]));
+        ie_blob_t *blob = nullptr;
+        IE_EXPECT_OK(ie_infer_request_get_blob(infer_requests[i], "data", &blob));
+        Mat2Blob(image, blob);
+        ie_blob_free(&blob);
+        IE_EXPECT_OK(ie_infer_request_set_completion_queue(infer_requests[i], queue, reinterpret_cast<void *>(i)));
+    }
+
+    ie_infer_completion_t completions[num_requests];
+    size_t count = 0;
+    EXPECT_EQ(IEStatusCode::RESULT_NOT_READY, ie_completion_queue_dequeue(queue, completions, num_requests, 0, &count));
+    EXPECT_EQ(0, count);
+
+    for (size_t i = 0; i < num_requests; i++) {
+        IE_EXPECT_OK(ie_infer_request_infer_async(infer_requests[i]));
+    }
+
+#ifndef _WIN32
+    int fd = -1;
+    IE_EXPECT_OK(ie_completion_queue_get_fd(queue, &fd));
+    pollfd poll_fd = {fd, POLLIN, 0};
+    EXPECT_EQ(1, poll(&poll_fd, 1, -1));
+#endif
+
+    size_t completed = 0;
+    bool seen[num_requests] = {};
+    while (completed < num_requests) {
+        IE_ASSERT_OK(ie_completion_queue_dequeue(queue, completions, num_requests, -1, &count));
+        for (size_t i = 0; i < count; i++) {
+            auto index = reinterpret_cast<size_t>(completions[i].user_data);
+            ASSERT_LT(index, num_requests);
+            EXPECT_EQ(infer_requests[index], completions[i].request);
+            EXPECT_EQ(IEStatusCode::OK, completions[i].status);
+            EXPECT_FALSE(seen[index]);
+            seen[index] = true;
+        }
+        completed += count;
+    }
+
+#ifndef _WIN32
+    // descriptor is not readable when the queue is empty
+    EXPECT_EQ(0, poll(&poll_fd, 1, 0));
+#endif
+
+    for (size_t i = 0; i < num_requests; i++) {
+        IE_EXPECT_OK(ie_infer_request_wait(infer_requests[i], -1));
+        ie_infer_request_free(&infer_requests[i]);
+    }
+    ie_completion_queue_free(&queue);
+    ie_exec_network_free(&exe_network);
+    ie_network_free(&network);
+    ie_core_free(&core);
+}
+
 TEST(ie_infer_request_set_batch, setBatch) {
     ie_core_t *core = nullptr;
     IE_ASSERT_OK(ie_core_create("", &core));
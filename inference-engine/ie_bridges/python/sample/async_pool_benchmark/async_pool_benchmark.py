@@ -0,0 +1,106 @@
+# Copyright (C) 2021 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+from __future__ import print_function
+import sys
+import threading
+from argparse import ArgumentParser, SUPPRESS
+from time import perf_counter
+import numpy as np
+import logging as log
+from openvino.inference_engine import IECore
+
+
+def build_argparser():
+    parser = ArgumentParser(add_help=False)
+    args = parser.add_argument_group('Options')
+    args.add_argument('-h', '--help', action='help', default=SUPPRESS, help='Show this help message and exit.')
+    args.add_argument("-m", "--model", help="Required. Path to an .xml or .onnx file with a trained model.", required=True,
+                      type=str)
+    args.add_argument("-d", "--device",
+                      help="Optional. Specify the target device to infer on; CPU, GPU, FPGA, HDDL, MYRIAD or HETERO: is "
+                           "acceptable. Default value is CPU",
+                      default="CPU", type=str)
+    args.add_argument("-nireq", "--number_infer_requests",
+                      help="Optional. Number of infer requests. Default value is the optimal number for the device",
+                      default=0, type=int)
+    args.add_argument("-niter", "--number_iterations", help="Optional. Number of inferences. Default value is 1000",
+                      default=1000, type=int)
+
+    return parser
+
+
+def make_inputs(exec_net):
+    inputs = {}
+    for name, info in exec_net.input_info.items():
+        tensor_desc = info.tensor_desc
+        dtype = {"FP32": np.float32, "FP16": np.float16, "I32": np.int32, "U8": np.uint8}[tensor_desc.precision]
+        inputs[name] = np.random.uniform(0, 255, tensor_desc.dims).astype(dtype)
+    return inputs
+
+
+def run_requests(exec_net, inputs, iterations):
+    # classic approach: each completion calls back into Python to start the next inference
+    requests = exec_net.requests
+    remaining = [iterations - len(requests)]
+    done = threading.Event()
+    lock = threading.Lock()
+
+    def callback(status, request):
+        with lock:
+            if remaining[0] > 0:
+                remaining[0] -= 1
+                request.async_infer()
+                return
+        done.set()
+
+    for request in requests:
+        for name, array in inputs.items():
+            request.input_blobs[name].buffer[:] = array
+        request.set_completion_callback(callback, request)
+
+    start = perf_counter()
+    for request in requests:
+        request.async_infer()
+    done.wait()
+    for request in requests:
+        request.wait()
+    return perf_counter() - start
+
+
+def run_pool(exec_net, inputs, iterations):
+    pool = exec_net.create_async_pool(len(exec_net.requests))
+    start = perf_counter()
+    for _ in range(iterations):
+        pool.submit(inputs)
+    pool.wait_all()
+    elapsed = perf_counter() - start
+    assert len(pool.get_completed()) == iterations
+    return elapsed
+
+
+def main():
+    log.basicConfig(format="[ %(levelname)s ] %(message)s", level=log.INFO, stream=sys.stdout)
+    args = build_argparser().parse_args()
+
+    ie = IECore()
+    log.info(f"Loading network:\n\t{args.model}")
+    net = ie.read_network(model=args.model)
+    exec_net = ie.load_network(network=net, device_name=args.device, config={"PERF_COUNT": "NO"},
+                               num_requests=args.number_infer_requests)
+    log.info(f"Number of infer requests: {len(exec_net.requests)}")
+
+    inputs = make_inputs(exec_net)
+    # warm up
+    exec_net.infer(inputs)
+
+    for name, run in (("Infer requests with callbacks", run_requests), ("Async infer pool", run_pool)):
+        elapsed = run(exec_net, inputs, args.number_iterations)
+        log.info(f"{name}: {args.number_iterations / elapsed:.2f} FPS")
+    log.info("Compare the results with C++ benchmark_app run with the same number of infer requests, e.g.:\n"
+             f"\tbenchmark_app -m {args.model} -d {args.device} -nireq {len(exec_net.requests)} "
+             f"-niter {args.number_iterations} -api async")
+
+
+if __name__ == '__main__':
+    sys.exit(main() or 0)
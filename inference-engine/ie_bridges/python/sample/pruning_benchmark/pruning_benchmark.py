@@ -0,0 +1,84 @@
+# Copyright (C) 2021 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+from __future__ import print_function
+import sys
+from argparse import ArgumentParser, SUPPRESS
+from time import perf_counter
+import numpy as np
+import logging as log
+from openvino.inference_engine import IECore
+from openvino.offline_transformations import ApplyPruningTransformation, GetPruningReport
+
+
+def build_argparser():
+    parser = ArgumentParser(add_help=False)
+    args = parser.add_argument_group('Options')
+    args.add_argument('-h', '--help', action='help', default=SUPPRESS, help='Show this help message and exit.')
+    args.add_argument("-m", "--model", help="Required. Path to an .xml file with a trained model.", required=True,
+                      type=str)
+    args.add_argument("-d", "--device",
+                      help="Optional. Specify the target device to infer on. Default value is CPU",
+                      default="CPU", type=str)
+    args.add_argument("-niter", "--number_iterations", help="Optional. Number of inferences. Default value is 200",
+                      default=200, type=int)
+    args.add_argument("--dry_run", help="Optional. Only print the pruning report without running inference.",
+                      action="store_true")
+
+    return parser
+
+
+def print_report(report):
+    log.info("Pruning report:")
+    print(f"{'Layer':<40} {'Type':<18} {'MFLOPs':>10} {'Pruned':>8} {'Weights, KB':>12} {'Pruned':>8}")
+    for layer in report:
+        flops_ratio = layer["pruned_flops"] / layer["flops"] if layer["flops"] else 0
+        bytes_ratio = layer["pruned_weights_bytes"] / layer["weights_bytes"] if layer["weights_bytes"] else 0
+        print(f"{layer['name'][:40]:<40} {layer['type']:<18} {layer['flops'] / 1e6:>10.2f} {flops_ratio:>8.1%} "
+              f"{layer['weights_bytes'] / 1024:>12.1f} {bytes_ratio:>8.1%}")
+    flops = sum(layer["flops"] for layer in report)
+    pruned_flops = sum(layer["pruned_flops"] for layer in report)
+    weights_bytes = sum(layer["weights_bytes"] for layer in report)
+    pruned_weights_bytes = sum(layer["pruned_weights_bytes"] for layer in report)
+    log.info(f"Total: {pruned_flops / 1e6:.2f} of {flops / 1e6:.2f} MFLOPs and "
+             f"{pruned_weights_bytes / 1024:.1f} of {weights_bytes / 1024:.1f} KB of weights can be removed")
+
+
+def measure_latency(ie, net, device, iterations):
+    exec_net = ie.load_network(network=net, device_name=device, num_requests=1)
+    inputs = {}
+    for name, info in net.input_info.items():
+        inputs[name] = np.random.uniform(0, 255, info.tensor_desc.dims).astype(np.float32)
+    # warm up
+    exec_net.infer(inputs)
+
+    request = exec_net.requests[0]
+    start = perf_counter()
+    for _ in range(iterations):
+        request.infer(inputs)
+    return (perf_counter() - start) / iterations
+
+
+def main():
+    log.basicConfig(format="[ %(levelname)s ] %(message)s", level=log.INFO, stream=sys.stdout)
+    args = build_argparser().parse_args()
+
+    ie = IECore()
+    log.info(f"Loading network:\n\t{args.model}")
+    net = ie.read_network(model=args.model)
+    print_report(GetPruningReport(net))
+    if args.dry_run:
+        return
+
+    latency = measure_latency(ie, net, args.device, args.number_iterations)
+    log.info(f"Original network latency: {latency * 1e3:.2f} ms")
+
+    pruned_net = ie.read_network(model=args.model)
+    ApplyPruningTransformation(pruned_net)
+    pruned_latency = measure_latency(ie, pruned_net, args.device, args.number_iterations)
+    log.info(f"Pruned network latency: {pruned_latency * 1e3:.2f} ms")
+    log.info(f"Speedup: {latency / pruned_latency:.2f}x")
+
+
+if __name__ == '__main__':
+    sys.exit(main() or 0)
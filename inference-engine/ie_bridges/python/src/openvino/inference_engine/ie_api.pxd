@@ -9,6 +9,7 @@ import os
 from libcpp.string cimport string
 from libcpp.vector cimport vector
 from libcpp cimport bool
+from libc.stdint cimport int64_t
 from libcpp.memory cimport unique_ptr, shared_ptr
 
 cdef class Blob:
@@ -43,11 +44,21 @@ cdef class InferRequest:
 cdef class IENetwork:
     cdef C.IENetwork impl
 
+cdef class AsyncInferPool:
+    cdef unique_ptr[C.AsyncInferPool] impl
+    cpdef submit(self, inputs, outputs = ?, userdata = ?)
+    cpdef get_completed(self, timeout = ?)
+    cpdef wait_all(self)
+    cdef _collect(self, int64_t timeout)
+    cdef public:
+        _exec_net, _jobs, _ready, _py_callback, _next_job_id, _input_descs, _output_descs
+
 cdef class ExecutableNetwork:
     cdef unique_ptr[C.IEExecNetwork] impl
     cdef C.IECore ie_core_impl
     cpdef wait(self, num_requests = ?, timeout = ?)
     cpdef get_idle_request_id(self)
+    cpdef AsyncInferPool create_async_pool(self, int num_requests = ?)
     cdef public:
         _requests, _infer_requests
 
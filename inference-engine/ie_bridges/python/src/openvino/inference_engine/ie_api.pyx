@@ -35,6 +35,7 @@ warnings.filterwarnings(action="module", category=DeprecationWarning)
 
 cdef extern from "<utility>" namespace "std" nogil:
     cdef unique_ptr[C.IEExecNetwork] move(unique_ptr[C.IEExecNetwork])
+    cdef unique_ptr[C.AsyncInferPool] move(unique_ptr[C.AsyncInferPool])
 
 cdef string to_std_string(str py_string):
     return py_string.encode()
@@ -964,6 +965,139 @@ cdef class ExecutableNetwork:
     cpdef get_idle_request_id(self):
         return deref(self.impl).getIdleRequestId()
 
+    ## Creates a pool of infer requests for high-throughput asynchronous inference.
+    #  Unlike `requests`, completion of the pool requests does not call into Python, finished jobs are collected
+    #  in batches by `get_completed()`, `wait_all()` or `submit()` when all the requests are busy.
+    #  @param num_requests: A number of infer requests in the pool. If 0 (default), the optimal number
+    #                       of requests for the device is used
+    #  @return An instance of the `AsyncInferPool` class
+    #
+    #  Usage example:\n
+    #  ```python
+    #  ie = IECore()
+    #  net = ie.read_network(model=path_to_xml_file, weights=path_to_bin_file)
+    #  exec_net = ie.load_network(net, "CPU")
+    #  pool = exec_net.create_async_pool()
+    #  for image in images:
+    #      pool.submit({input_blob: image})
+    #  pool.wait_all()
+    #  results = pool.get_completed()
+    #  ```
+    cpdef AsyncInferPool create_async_pool(self, int num_requests=0):
+        cdef AsyncInferPool pool = AsyncInferPool()
+        pool.impl = move(deref(self.impl).createAsyncPool(num_requests))
+        pool._exec_net = self
+        pool._input_descs = {name: info.tensor_desc for name, info in self.input_info.items()}
+        pool._output_descs = {name: TensorDesc(data.precision, data.shape, data.layout)
+                              for name, data in self.outputs.items()}
+        return pool
+
+
+## This class provides a pool of infer requests that run asynchronously without holding the GIL.
+#  Input and output `numpy.ndarray` objects are bound to the requests without copying, so they must not be
+#  modified until the job is completed.
+cdef class AsyncInferPool:
+    ## There is no explicit class constructor. To make a valid `AsyncInferPool` instance, use
+    #  `create_async_pool()` method of the `ExecutableNetwork` class.
+    def __init__(self):
+        self._jobs = {}
+        self._ready = []
+        self._py_callback = None
+        self._next_job_id = 0
+        self._input_descs = {}
+        self._output_descs = {}
+
+    def __dealloc__(self):
+        # running requests write to the bound arrays, so they are completed first
+        self.impl.reset()
+
+    ## Number of infer requests in the pool
+    def __len__(self):
+        return deref(self.impl).size()
+
+    ## Sets a callback function called with a list of completed jobs, each job is a tuple
+    #  `(job_id, status, userdata, outputs)`. The callback is called from the thread that
+    #  calls `submit()`, `get_completed()` or `wait_all()`, and jobs are not returned by `get_completed()`.
+    #  @param py_callback: Any defined or lambda function, None resets the callback
+    #  @return None
+    def set_completion_callback(self, py_callback):
+        self._py_callback = py_callback
+
+    ## Starts asynchronous inference on an idle request of the pool. If all requests are busy,
+    #  waits for completion of any of them.
+    #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects with input data
+    #  @param outputs: Optional dictionary that maps output layer names to `numpy.ndarray` objects the results are
+    #                  written to. Arrays for missed outputs are allocated by the pool
+    #  @param userdata: Any object passed back with the job results
+    #  @return Job id
+    cpdef submit(self, inputs, outputs=None, userdata=None):
+        cdef int request_id = deref(self.impl).getIdleRequestId()
+        while request_id < 0:
+            self._collect(WaitMode.RESULT_READY)
+            request_id = deref(self.impl).getIdleRequestId()
+
+        blobs = []
+        for name, array in inputs.items():
+            if name not in self._input_descs:
+                raise ValueError(f"No input with name {name} found in network")
+            blobs.append(Blob(self._input_descs[name], array))
+            deref(self.impl).setBlob(request_id, name.encode(), (<Blob> blobs[-1])._ptr)
+        output_arrays = {}
+        for name, tensor_desc in self._output_descs.items():
+            array = outputs.get(name) if outputs is not None else None
+            if array is None:
+                array = np.empty(tensor_desc.dims, dtype=format_map[tensor_desc.precision])
+            blobs.append(Blob(tensor_desc, array))
+            deref(self.impl).setBlob(request_id, name.encode(), (<Blob> blobs[-1])._ptr)
+            output_arrays[name] = array
+
+        job_id = self._next_job_id
+        self._next_job_id += 1
+        # blobs keep the bound arrays alive until the job is completed
+        self._jobs[job_id] = (userdata, output_arrays, blobs)
+        try:
+            deref(self.impl).startAsync(request_id, job_id)
+        except Exception:
+            del self._jobs[job_id]
+            raise
+        return job_id
+
+    cdef _collect(self, int64_t timeout):
+        cdef vector[C.InferCompletion] completions
+        cdef C.InferCompletion completion
+        with nogil:
+            completions = deref(self.impl).waitCompleted(0, timeout)
+        results = []
+        for completion in completions:
+            userdata, output_arrays, _ = self._jobs.pop(completion.job_id)
+            deref(self.impl).setRequestIdle(completion.request_id)
+            results.append((completion.job_id, completion.status, userdata, output_arrays))
+        if results:
+            if self._py_callback is not None:
+                self._py_callback(results)
+            else:
+                self._ready.extend(results)
+
+    ## Returns completed jobs as a list of tuples `(job_id, status, userdata, outputs)`, where `outputs` maps
+    #  output layer names to `numpy.ndarray` objects. Returns immediately if no jobs are running.
+    #  @param timeout: Time to wait for the first completed job in milliseconds, -1 (default) waits until it is completed
+    #  @return List of completed jobs
+    cpdef get_completed(self, timeout=None):
+        if timeout is None:
+            timeout = WaitMode.RESULT_READY
+        if not self._ready:
+            self._collect(<int64_t> timeout)
+        ready = self._ready
+        self._ready = []
+        return ready
+
+    ## Waits for completion of all submitted jobs
+    #  @return None
+    cpdef wait_all(self):
+        with nogil:
+            deref(self.impl).waitAll()
+        self._collect(WaitMode.STATUS_ONLY)
+
 ctypedef extern void (*cb_type)(void*, int) with gil
 
 ## This class provides an interface to infer requests of `ExecutableNetwork` and serves to handle infer requests execution
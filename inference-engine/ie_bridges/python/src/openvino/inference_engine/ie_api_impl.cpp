@@ -531,6 +531,114 @@ void InferenceEnginePython::IEExecNetwork::createInferRequests(int num_requests)
     }
 }
 
+std::unique_ptr<InferenceEnginePython::AsyncInferPool>
+InferenceEnginePython::IEExecNetwork::createAsyncPool(int num_requests) {
+    if (0 == num_requests) {
+        num_requests = getOptimalNumberOfRequests(actual);
+    }
+    if (num_requests < 0) {
+        IE_THROW() << "Incorrect number of requests specified: " << num_requests;
+    }
+    return InferenceEnginePython::make_unique<InferenceEnginePython::AsyncInferPool>(actual, num_requests);
+}
+
+void pool_completion_callback(InferenceEngine::IInferRequest::Ptr request, InferenceEngine::StatusCode code) {
+    InferenceEnginePython::AsyncInferPool::Slot *slot;
+    InferenceEngine::ResponseDesc dsc;
+    request->GetUserData(reinterpret_cast<void **>(&slot), &dsc);
+    slot->pool->onCompleted(*slot, code);
+}
+
+InferenceEnginePython::AsyncInferPool::AsyncInferPool(const InferenceEngine::IExecutableNetwork::Ptr &network,
+                                                      size_t num_requests) :
+        network(network), requests(num_requests), slots(num_requests) {
+    InferenceEngine::ResponseDesc response;
+    for (size_t i = 0; i < num_requests; ++i) {
+        slots[i] = {this, i, -1};
+        IE_CHECK_CALL(network->CreateInferRequest(requests[i], &response));
+        IE_CHECK_CALL(requests[i]->SetUserData(&slots[i], &response));
+        IE_CHECK_CALL(requests[i]->SetCompletionCallback(pool_completion_callback));
+        idle_ids.push_back(i);
+    }
+}
+
+InferenceEnginePython::AsyncInferPool::~AsyncInferPool() {
+    // callbacks of running requests refer to the pool
+    waitAll();
+}
+
+size_t InferenceEnginePython::AsyncInferPool::size() const {
+    return requests.size();
+}
+
+int InferenceEnginePython::AsyncInferPool::getIdleRequestId() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return idle_ids.empty() ? -1 : static_cast<int>(idle_ids.front());
+}
+
+void InferenceEnginePython::AsyncInferPool::setBlob(size_t request_id, const std::string &blob_name,
+                                                    const InferenceEngine::Blob::Ptr &blob_ptr) {
+    InferenceEngine::ResponseDesc response;
+    IE_CHECK_CALL(requests.at(request_id)->SetBlob(blob_name.c_str(), blob_ptr, &response));
+}
+
+void InferenceEnginePython::AsyncInferPool::startAsync(size_t request_id, int64_t job_id) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto idle = std::find(idle_ids.begin(), idle_ids.end(), request_id);
+        if (idle == idle_ids.end()) {
+            IE_THROW() << "Infer request " << request_id << " of the pool is busy";
+        }
+        idle_ids.erase(idle);
+        slots[request_id].job_id = job_id;
+        num_running++;
+    }
+    InferenceEngine::ResponseDesc response;
+    auto ret = requests[request_id]->StartAsync(&response);
+    if (ret != InferenceEngine::StatusCode::OK) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            num_running--;
+            idle_ids.push_front(request_id);
+        }
+        cv.notify_all();
+        IE_THROW() << response.msg;
+    }
+}
+
+void InferenceEnginePython::AsyncInferPool::onCompleted(const Slot &slot, InferenceEngine::StatusCode code) {
+    // notified under the lock, since the pool may be destroyed as soon as the last request is completed
+    std::lock_guard<std::mutex> lock(mutex);
+    completed.push_back({slot.index, slot.job_id, static_cast<int>(code)});
+    num_running--;
+    cv.notify_all();
+}
+
+std::vector<InferenceEnginePython::InferCompletion>
+InferenceEnginePython::AsyncInferPool::waitCompleted(size_t max_count, int64_t timeout) {
+    std::unique_lock<std::mutex> lock(mutex);
+    auto ready = [this] { return !completed.empty() || num_running == 0; };
+    if (timeout < 0) {
+        cv.wait(lock, ready);
+    } else if (timeout > 0) {
+        cv.wait_for(lock, std::chrono::milliseconds(timeout), ready);
+    }
+    size_t count = max_count == 0 ? completed.size() : std::min(max_count, completed.size());
+    std::vector<InferCompletion> result(completed.begin(), completed.begin() + count);
+    completed.erase(completed.begin(), completed.begin() + count);
+    return result;
+}
+
+void InferenceEnginePython::AsyncInferPool::setRequestIdle(size_t request_id) {
+    std::lock_guard<std::mutex> lock(mutex);
+    idle_ids.push_back(request_id);
+}
+
+void InferenceEnginePython::AsyncInferPool::waitAll() {
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [this] { return num_running == 0; });
+}
+
 InferenceEnginePython::IENetwork
 InferenceEnginePython::IECore::readNetwork(const std::string& modelPath, const std::string& binPath) {
     InferenceEngine::CNNNetwork net = actual.ReadNetwork(modelPath, binPath);
@@ -20,6 +20,7 @@
 #include <queue>
 #include <condition_variable>
 #include <mutex>
+#include <deque>
 
 #include <ie_extension.h>
 #include <ie_core.hpp>
@@ -127,6 +128,64 @@ struct InferRequestWrap {
 };
 
 
+struct InferCompletion {
+    size_t request_id;
+    int64_t job_id;
+    int status;
+};
+
+
+/**
+ * @brief Pool of infer requests completed without entering Python.
+ * Completion callbacks only queue the finished requests, Python thread collects them in batches,
+ * so the GIL is needed only to submit a job and to hand off the results.
+ */
+struct AsyncInferPool {
+    struct Slot {
+        AsyncInferPool* pool;
+        size_t index;
+        int64_t job_id;
+    };
+
+    InferenceEngine::IExecutableNetwork::Ptr network;
+    std::vector<InferenceEngine::IInferRequest::Ptr> requests;
+    std::vector<Slot> slots;
+    std::deque<size_t> idle_ids;
+    std::vector<InferCompletion> completed;
+    size_t num_running = 0;
+    std::mutex mutex;
+    std::condition_variable cv;
+
+    AsyncInferPool(const InferenceEngine::IExecutableNetwork::Ptr &network, size_t num_requests);
+    ~AsyncInferPool();
+
+    size_t size() const;
+
+    int getIdleRequestId();
+
+    void setBlob(size_t request_id, const std::string &blob_name, const InferenceEngine::Blob::Ptr &blob_ptr);
+
+    void startAsync(size_t request_id, int64_t job_id);
+
+    /**
+     * @brief Takes up to `max_count` (0 - all) completed jobs, waits for the first one `timeout` milliseconds
+     * (-1 - until it is completed). Returns immediately if no jobs are running
+     */
+    std::vector<InferCompletion> waitCompleted(size_t max_count, int64_t timeout);
+
+    /**
+     * @brief Returns request of the collected job to the pool
+     */
+    void setRequestIdle(size_t request_id);
+
+    void waitAll();
+
+    void onCompleted(const Slot &slot, InferenceEngine::StatusCode code);
+
+    using Ptr = std::unique_ptr<AsyncInferPool>;
+};
+
+
 struct IEExecNetwork {
     InferenceEngine::IExecutableNetwork::Ptr actual;
     std::vector<InferRequestWrap> infer_requests;
@@ -151,6 +210,8 @@ struct IEExecNetwork {
     int getIdleRequestId();
 
     void createInferRequests(int num_requests);
+
+    std::unique_ptr<AsyncInferPool> createAsyncPool(int num_requests);
 };
 
 
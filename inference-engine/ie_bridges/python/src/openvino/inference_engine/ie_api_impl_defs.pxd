@@ -156,6 +156,21 @@ cdef extern from "ie_api_impl.hpp" namespace "InferenceEnginePython":
         object getConfig(const string & metric_name) except +
         int wait(int num_requests, int64_t timeout)
         int getIdleRequestId()
+        unique_ptr[AsyncInferPool] createAsyncPool(int num_requests) except +
+
+    cdef cppclass InferCompletion:
+        size_t request_id
+        int64_t job_id
+        int status
+
+    cdef cppclass AsyncInferPool:
+        size_t size()
+        int getIdleRequestId()
+        void setBlob(size_t request_id, const string & blob_name, const CBlob.Ptr & blob_ptr) except +
+        void startAsync(size_t request_id, int64_t job_id) except +
+        vector[InferCompletion] waitCompleted(size_t max_count, int64_t timeout) except + nogil
+        void setRequestIdle(size_t request_id)
+        void waitAll() nogil
 
     cdef cppclass IENetwork:
         IENetwork() except +
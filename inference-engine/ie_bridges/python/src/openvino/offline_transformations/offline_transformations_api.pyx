@@ -5,6 +5,7 @@ from .cimport offline_transformations_api_impl_defs as C
 from ..inference_engine.ie_api cimport IENetwork
 
 from libcpp cimport bool
+from libcpp.vector cimport vector
 
 def ApplyMOCTransformations(IENetwork network, bool cf):
     C.ApplyMOCTransformations(network.impl, cf)
@@ -15,5 +16,17 @@ def ApplyLowLatencyTransformation(IENetwork network):
 def ApplyPruningTransformation(IENetwork network):
     C.ApplyPruningTransformation(network.impl)
 
+def GetPruningReport(IENetwork network):
+    cdef vector[C.PruningLayerStatistics] statistics = C.GetPruningReport(network.impl)
+    report = []
+    for i in range(statistics.size()):
+        report.append({"name": statistics[i].name.decode(),
+                       "type": statistics[i].type.decode(),
+                       "flops": statistics[i].flops,
+                       "pruned_flops": statistics[i].pruned_flops,
+                       "weights_bytes": statistics[i].weights_bytes,
+                       "pruned_weights_bytes": statistics[i].pruned_weights_bytes})
+    return report
+
 def CheckAPI():
     C.CheckAPI()
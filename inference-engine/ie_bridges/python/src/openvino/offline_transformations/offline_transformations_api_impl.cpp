@@ -39,6 +39,14 @@ void InferenceEnginePython::ApplyPruningTransformation(InferenceEnginePython::IE
     manager.run_passes(network.actual->getFunction());
 }
 
+std::vector<InferenceEnginePython::PruningLayerStatistics> InferenceEnginePython::GetPruningReport(InferenceEnginePython::IENetwork network) {
+    std::vector<PruningLayerStatistics> statistics;
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::pass::PruningReport>(statistics);
+    manager.run_passes(network.actual->getFunction());
+    return statistics;
+}
+
 
 void InferenceEnginePython::CheckAPI() {
     std::shared_ptr<ngraph::Function> f;
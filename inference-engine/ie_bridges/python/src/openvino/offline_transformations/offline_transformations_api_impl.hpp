@@ -4,17 +4,25 @@
 
 #pragma once
 
+#include <vector>
+
 #include "Python.h"
 #include "ie_api_impl.hpp"
 
+#include <pruning.hpp>
+
 namespace InferenceEnginePython {
 
+using PruningLayerStatistics = ngraph::pass::PruningReport::LayerStatistics;
+
 void ApplyMOCTransformations(InferenceEnginePython::IENetwork network, bool cf);
 
 void ApplyLowLatencyTransformation(InferenceEnginePython::IENetwork network);
 
 void ApplyPruningTransformation(InferenceEnginePython::IENetwork network);
 
+std::vector<PruningLayerStatistics> GetPruningReport(InferenceEnginePython::IENetwork network);
+
 void CheckAPI();
 
 };  // namespace InferenceEnginePython
@@ -1,14 +1,27 @@
 # Copyright (C) 2018-2021 Intel Corporation
 # SPDX-License-Identifier: Apache-2.0
 
+from libc.stdint cimport int64_t
 from libcpp cimport bool
+from libcpp.string cimport string
+from libcpp.vector cimport vector
 from ..inference_engine.ie_api_impl_defs cimport IENetwork
 
 cdef extern from "offline_transformations_api_impl.hpp" namespace "InferenceEnginePython":
+    cdef cppclass PruningLayerStatistics:
+        string name
+        string type
+        int64_t flops
+        int64_t pruned_flops
+        int64_t weights_bytes
+        int64_t pruned_weights_bytes
+
     cdef void ApplyMOCTransformations(IENetwork network, bool cf)
 
     cdef void ApplyLowLatencyTransformation(IENetwork network)
 
     cdef void ApplyPruningTransformation(IENetwork network)
 
+    cdef vector[PruningLayerStatistics] GetPruningReport(IENetwork network)
+
     cdef void CheckAPI()
\ No newline at end of file
@@ -0,0 +1,95 @@
+# Copyright (C) 2021 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+import numpy as np
+import os
+import pytest
+
+from openvino.inference_engine import ie_api as ie
+from conftest import model_path, image_path
+
+
+is_myriad = os.environ.get("TEST_DEVICE") == "MYRIAD"
+path_to_image = image_path()
+test_net_xml, test_net_bin = model_path(is_myriad)
+
+
+def read_image():
+    import cv2
+    n, c, h, w = (1, 3, 32, 32)
+    image = cv2.imread(path_to_image)
+    if image is None:
+        raise FileNotFoundError("Input image not found")
+
+    image = cv2.resize(image, (h, w)) / 255
+    image = image.transpose((2, 0, 1)).astype(np.float32)
+    image = image.reshape((n, c, h, w))
+    return image
+
+
+def load_pool(device, num_requests):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(model=test_net_xml, weights=test_net_bin)
+    exec_net = ie_core.load_network(net, device)
+    return exec_net.create_async_pool(num_requests)
+
+
+def test_pool_size(device):
+    pool = load_pool(device, 3)
+    assert len(pool) == 3
+
+
+def test_submit_more_jobs_than_requests(device):
+    pool = load_pool(device, 2)
+    img = read_image()
+    job_ids = [pool.submit({'data': img}, userdata=i) for i in range(7)]
+    assert len(set(job_ids)) == 7
+    pool.wait_all()
+    results = pool.get_completed()
+    assert sorted(job_id for job_id, _, _, _ in results) == sorted(job_ids)
+    for job_id, status, userdata, outputs in results:
+        assert status == ie.StatusCode.OK
+        assert job_ids[userdata] == job_id
+        assert np.argmax(outputs['fc_out'][0]) == 2
+
+
+def test_results_are_written_to_user_outputs(device):
+    pool = load_pool(device, 1)
+    img = read_image()
+    out = np.zeros((1, 10), dtype=np.float32)
+    pool.submit({'data': img}, outputs={'fc_out': out})
+    pool.wait_all()
+    (_, status, _, outputs), = pool.get_completed()
+    assert status == ie.StatusCode.OK
+    assert outputs['fc_out'] is out
+    assert np.argmax(out[0]) == 2
+
+
+def test_completion_callback_gets_batches(device):
+    pool = load_pool(device, 2)
+    completed = []
+    pool.set_completion_callback(lambda results: completed.extend(results))
+    img = read_image()
+    for _ in range(5):
+        pool.submit({'data': img})
+    pool.wait_all()
+    assert len(completed) == 5
+    assert pool.get_completed() == []
+
+
+def test_get_completed_returns_if_nothing_submitted(device):
+    pool = load_pool(device, 1)
+    assert pool.get_completed() == []
+
+
+def test_submit_unknown_input(device):
+    pool = load_pool(device, 1)
+    with pytest.raises(ValueError) as e:
+        pool.submit({'unknown': read_image()})
+    assert "No input with name unknown found in network" in str(e.value)
+
+
+def test_submit_wrong_precision(device):
+    pool = load_pool(device, 1)
+    with pytest.raises(ValueError):
+        pool.submit({'data': read_image().astype(np.float64)})
@@ -2,8 +2,10 @@
 # SPDX-License-Identifier: Apache-2.0
 
 from openvino.inference_engine import IECore, IENetwork
-from openvino.offline_transformations import ApplyMOCTransformations, ApplyLowLatencyTransformation, ApplyPruningTransformation
+from openvino.offline_transformations import ApplyMOCTransformations, ApplyLowLatencyTransformation, ApplyPruningTransformation, \
+    GetPruningReport
 
+import numpy as np
 import ngraph as ng
 from ngraph.impl.op import Parameter
 from ngraph.impl import Function, Shape, Type
@@ -49,4 +51,24 @@ def test_pruning_transformations():
 
     f = ng.function_from_cnn(net)
     assert f != None
-    assert len(f.get_ops()) == 3
\ No newline at end of file
+    assert len(f.get_ops()) == 3
+
+def test_pruning_report():
+    param = Parameter(Type.f32, Shape([1, 3, 22, 22]))
+    weights1 = np.ones((6, 3, 3, 3), dtype=np.float32)
+    weights1[:2] = 0
+    conv1 = ng.convolution(param, ng.constant(weights1), [1, 1], [0, 0], [0, 0], [1, 1])
+    weights2 = np.ones((4, 6, 3, 3), dtype=np.float32)
+    conv2 = ng.convolution(conv1, ng.constant(weights2), [1, 1], [0, 0], [0, 0], [1, 1])
+    func = Function([conv2], [param], 'test')
+    net = IENetwork(Function.to_capsule(func))
+
+    report = GetPruningReport(net)
+
+    assert [layer["type"] for layer in report] == ["Convolution", "Convolution"]
+    assert [layer["flops"] for layer in report] == [129600, 139968]
+    assert [layer["pruned_flops"] for layer in report] == [43200, 46656]
+    assert [layer["weights_bytes"] for layer in report] == [648, 864]
+    assert [layer["pruned_weights_bytes"] for layer in report] == [216, 288]
+    # the network itself is not pruned
+    assert len(ng.function_from_cnn(net).get_ops()) == 6
@@ -55,6 +55,21 @@ public:
     }
 };
 
+/**
+ * @brief Selects a set of variable states used by the following inference calls of the request
+ * @note Implemented on top of the plugin internal interface, so IInferRequest keeps its binary layout
+ * @param request An infer request created by an executable network
+ * @param sessionId Identifier of the session
+ */
+INFERENCE_ENGINE_API_CPP(void) SetStateSession(const IInferRequest::Ptr& request, size_t sessionId);
+
+/**
+ * @brief Releases variable states of a session which is not selected for the request
+ * @param request An infer request created by an executable network
+ * @param sessionId Identifier of the session to release
+ */
+INFERENCE_ENGINE_API_CPP(void) ReleaseStateSession(const IInferRequest::Ptr& request, size_t sessionId);
+
 }  // namespace details
 
 /**
@@ -218,6 +233,30 @@ public:
         CALL_STATUS_FNC(SetBatch, batch);
     }
 
+    /**
+     * @brief Selects a set of variable states used by the following inference calls of this request.
+     *
+     * Each session keeps its own variable states, so independent sequences can be interleaved on the same
+     * request without saving and restoring the states. A new session starts with default state values.
+     * Plugins which do not support sessions throw NotImplemented.
+     *
+     * @param sessionId Identifier of the session. Session 0 is selected by default
+     */
+    void SetStateSession(const size_t sessionId) {
+        if (actual == nullptr) IE_THROW() << "InferRequest was not initialized.";
+        details::SetStateSession(actual, sessionId);
+    }
+
+    /**
+     * @brief Releases variable states of a session that is not selected for this request.
+     *
+     * @param sessionId Identifier of the session to release
+     */
+    void ReleaseStateSession(const size_t sessionId) {
+        if (actual == nullptr) IE_THROW() << "InferRequest was not initialized.";
+        details::ReleaseStateSession(actual, sessionId);
+    }
+
     /**
      * @brief Start inference of specified input(s) in asynchronous mode
      *
@@ -98,6 +98,14 @@ DECLARE_GNA_CONFIG_KEY(PWL_UNIFORM_DESIGN);
 */
 DECLARE_GNA_CONFIG_KEY(PWL_MAX_ERROR_PERCENT);
 
+/**
+* @brief The option to specify a file used to persist designed PWL segments between application runs.
+* Segments found in the file are reused instead of running the optimized PWL design algorithm,
+* new segments are added to the file after network loading.
+* By default (in case of NO value set), segments are cached only in memory of the process.
+*/
+DECLARE_GNA_CONFIG_KEY(PWL_CACHE_FILE);
+
 /**
 * @brief By default, the GNA plugin uses one worker thread for inference computations.
 * This parameter allows you to create up to 127 threads for software modes.
@@ -25,6 +25,11 @@ namespace HeteroConfigParams {
  * @brief Shortcut for defining HETERO configuration keys
  */
 #define HETERO_CONFIG_KEY(name) InferenceEngine::HeteroConfigParams::_CONFIG_KEY(HETERO_##name)
+/**
+ * @def HETERO_CONFIG_VALUE(name)
+ * @brief Shortcut for defining HETERO configuration values
+ */
+#define HETERO_CONFIG_VALUE(name) InferenceEngine::HeteroConfigParams::HETERO_##name
 #define DECLARE_HETERO_CONFIG_KEY(name) DECLARE_CONFIG_KEY(HETERO_##name)
 #define DECLARE_HETERO_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(HETERO_##name)
 
@@ -35,5 +40,43 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key for choosing how layers are distributed between devices when no affinities are set.
+ * This option should be used with values:
+ * HETERO_FALLBACK_ORDER (default) - each layer is assigned to the first device in TARGET_FALLBACK that supports it;
+ * HETERO_MIN_COST - layers are assigned to devices so that the estimated execution time of layers plus the time of
+ * tensor transfers between devices is minimal.
+ */
+DECLARE_HETERO_CONFIG_KEY(PARTITION_POLICY);
+DECLARE_HETERO_CONFIG_VALUE(FALLBACK_ORDER);
+DECLARE_HETERO_CONFIG_VALUE(MIN_COST);
+
+/**
+ * @brief The key for choosing the source of per-layer execution time used by HETERO_MIN_COST partition policy.
+ * This option should be used with values:
+ * HETERO_ESTIMATE (default) - time is estimated from the number of operations of a layer;
+ * HETERO_CALIBRATE - each layer supported by several devices is loaded and executed on each of these devices
+ * during LoadNetwork() and the measured time is used.
+ */
+DECLARE_HETERO_CONFIG_KEY(OP_COSTS);
+DECLARE_HETERO_CONFIG_VALUE(ESTIMATE);
+DECLARE_HETERO_CONFIG_VALUE(CALIBRATE);
+
+/**
+ * @brief The key for limiting the number of subgraphs created by HETERO_MIN_COST partition policy.
+ * This option should be used with an integer value. "0" (default) means that the number is not limited.
+ */
+DECLARE_HETERO_CONFIG_KEY(MAX_SUBGRAPHS);
+
 }  // namespace HeteroConfigParams
+
+namespace Metrics {
+
+/**
+ * @brief ExecutableNetwork metric to get a std::string description of HETERO subgraphs: a device, a number of layers,
+ * an estimated and a measured average execution time of each subgraph. String value is "HETERO_PARTITION"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(HETERO_PARTITION, std::string);
+
+}  // namespace Metrics
 }  // namespace InferenceEngine
@@ -70,4 +70,16 @@ protected:
  */
 INFERENCE_ENGINE_API_CPP(std::shared_ptr<InferenceEngine::IAllocator>) CreateDefaultAllocator() noexcept;
 
+/**
+ * @brief Creates the Inference Engine allocator that places memory on the given NUMA node.
+ *
+ * Memory pages of allocated buffers are first touched by a thread pinned to the NUMA node, so on operating
+ * systems with the first-touch memory policy they reside on this node. If the thread can not be pinned
+ * (e.g. on Windows and macOS), the allocator behaves as the default one.
+ *
+ * @param numaNodeId The NUMA node id, one of returned by InferenceEngine::getAvailableNUMANodes
+ * @return The Inference Engine IAllocator* instance
+ */
+INFERENCE_ENGINE_API_CPP(std::shared_ptr<InferenceEngine::IAllocator>) CreateNUMAAllocator(int numaNodeId) noexcept;
+
 }  // namespace InferenceEngine
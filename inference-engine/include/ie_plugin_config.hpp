@@ -10,6 +10,8 @@
  */
 #pragma once
 
+#include <cstdint>
+#include <map>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -168,6 +170,57 @@ DECLARE_METRIC_KEY(DEVICE_THERMAL, float);
  */
 DECLARE_EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS, unsigned int);
 
+/**
+ * @brief Metric to get memory allocated by executable network on each NUMA node, in bytes.
+ *
+ * String value is "NUMA_NODES_MEMORY_USAGE". The value is a std::map<int, uint64_t> with NUMA node ids as keys
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(NUMA_NODES_MEMORY_USAGE, std::map<int, uint64_t>);
+
+/**
+ * @brief Metric to get layers of executable network which are executed with sparse weights.
+ *
+ * String value is "SPARSE_WEIGHTS_LAYERS". The value is a std::map<std::string, float> with layer names as keys
+ * and the share of zero weights of the layer as values
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(SPARSE_WEIGHTS_LAYERS, std::map<std::string, float>);
+
+/**
+ * @brief Metric to get logical processors assigned to each stream of executable network.
+ *
+ * String value is "STREAMS_PROCESSORS". The value is a std::vector<std::vector<int>> with ids of logical processors
+ * for each stream. The vector is empty if streams are not assigned to particular processors
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(STREAMS_PROCESSORS, std::vector<std::vector<int>>);
+
+/**
+ * @brief Metric to get the number of reorders executed per inference and bytes of tensors converted by them.
+ *
+ * String value is "LAYOUT_REORDERS". The value is a std::map<std::string, uint64_t> with the following keys:
+ * "GREEDY_COUNT" and "GREEDY_BYTES" are estimated for layouts chosen by each layer independently,
+ * "SELECTED_COUNT" and "SELECTED_BYTES" are estimated after the global layout selection,
+ * "INSERTED_COUNT" and "INSERTED_BYTES" describe reorders which are actually executed by the network
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(LAYOUT_REORDERS, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric to get the number of bytes moved by Concat and Split layers per inference.
+ *
+ * String value is "CONCAT_SPLIT_BYTES". The value is a std::map<std::string, uint64_t> with the following keys:
+ * "TOTAL_BYTES" is the size of all Concat outputs and Split inputs, "COPIED_BYTES" is the part of it which is
+ * actually copied, i.e. belongs to layers not executed in-place
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CONCAT_SPLIT_BYTES, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric to get lookups of the runtime primitive cache made while primitives of executable network were created.
+ *
+ * String value is "RUNTIME_CACHE_STATISTIC". The value is a std::map<std::string, uint64_t> with the following keys:
+ * "HITS" and "MISSES" are the numbers of primitives taken from the cache and compiled for it,
+ * "UNCACHED" is the number of primitives compiled without the cache because they point to layer data
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(RUNTIME_CACHE_STATISTIC, std::map<std::string, uint64_t>);
+
 }  // namespace Metrics
 
 /**
@@ -229,6 +282,21 @@ DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_NUMA);
 DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_AUTO);
 DECLARE_CONFIG_KEY(CPU_THROUGHPUT_STREAMS);
 
+/**
+ * @brief The name for placement of CPU streams on hybrid CPUs with performance and efficient cores.
+ *
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * - CPU_CORES_ANY (default) does not take core types into account
+ * - CPU_CORES_PERFORMANCE places all streams on performance cores
+ * - CPU_CORES_HYBRID_AWARE places single (latency) stream on performance cores and distributes
+ *   multiple (throughput) streams over all cores, so that every stream runs on cores of the same type
+ * The option has no effect on CPUs with cores of single type and if threads are bound to NUMA nodes
+ */
+DECLARE_CONFIG_VALUE(CPU_CORES_ANY);
+DECLARE_CONFIG_VALUE(CPU_CORES_PERFORMANCE);
+DECLARE_CONFIG_VALUE(CPU_CORES_HYBRID_AWARE);
+DECLARE_CONFIG_KEY(CPU_CORES_PLACEMENT);
+
 /**
  * @brief Optimize GPU plugin execution to maximize throughput.
  *
@@ -372,6 +440,61 @@ DECLARE_CONFIG_KEY(DUMP_EXEC_GRAPH_AS_DOT);
  */
 DECLARE_CONFIG_KEY(ENFORCE_BF16);
 
+/**
+ * @brief The name for setting the capacity of the CPU runtime primitive cache
+ *
+ * The cache is process-wide and shared by all networks and streams loaded to the CPU plugin, so
+ * primitives with identical descriptors, attributes and ISA are JIT-compiled only once.
+ * Least recently used primitives are evicted when the number of entries exceeds the capacity.
+ * The value is a non-negative integer, 0 disables the cache. Default value is 1024.
+ * The capacity passed to Core::LoadNetwork is applied to the whole process as well.
+ * Primitives with depthwise or quantization post-ops fused by the plugin are not cached, the usage is reported by
+ * the RUNTIME_CACHE_STATISTIC executable network metric.
+ */
+DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_CAPACITY);
+
+/**
+ * @brief The name for setting the number of input shapes the CPU plugin keeps compiled graphs for
+ *
+ * When the value is positive, input blobs of an infer request may have dimensions that differ from the
+ * network input dimensions (the rank and layout must match). The network is reshaped and compiled for
+ * the new shapes on the first inference, and compiled graphs for the most recently used input shapes are
+ * kept, so repeated shapes are not recompiled. Output blobs are reallocated to match the inferred shapes,
+ * output blobs set by the user must have the inferred dimensions.
+ * The value is a non-negative integer, 0 (default) disables reshaping at inference time.
+ */
+DECLARE_CONFIG_KEY(CPU_SHAPES_CACHE_CAPACITY);
+
+/**
+ * @brief The name for setting the file the CPU plugin writes an execution timeline to
+ *
+ * When the value is a non-empty path, begin and end times of every graph node, inference stage and
+ * asynchronous pipeline stage are recorded for all streams and requests of the executable network.
+ * The timeline is written in Chrome trace JSON format (viewable in chrome://tracing or Perfetto UI)
+ * when the executable network is destroyed. Empty string (default) disables tracing.
+ */
+DECLARE_CONFIG_KEY(CPU_TRACE_FILE);
+
+/**
+ * @brief The name for setting the share of zero weights at which the CPU plugin executes FullyConnected layers
+ * with sparse weights
+ *
+ * FP32 FullyConnected layers with constant weights whose share of zero values is greater than the threshold
+ * keep only the non-zero weights and skip multiplications by zeros. The value is a floating point number
+ * in the [0, 1] range, 1 (default) disables the sparse execution. The layers which use sparse weights are
+ * reported by the SPARSE_WEIGHTS_LAYERS executable network metric.
+ */
+DECLARE_CONFIG_KEY(CPU_SPARSE_WEIGHTS_THRESHOLD);
+
+/**
+ * @brief The name for setting whether the CPU plugin selects layouts of layers for the whole network
+ *
+ * With YES layouts chosen by each layer independently are reconsidered to reduce the amount of data
+ * converted by reorders between layers, taking into account the efficiency of layer implementations.
+ * The effect is reported by the LAYOUT_REORDERS executable network metric. The default value is NO.
+ */
+DECLARE_CONFIG_KEY(CPU_GLOBAL_LAYOUT_SELECTION);
+
 /**
  * @brief This key defines the directory which will be used to store any data cached by plugins.
  *
@@ -0,0 +1,161 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+#include "gna_plugin_log.hpp"
+#include "pwl_cache.hpp"
+
+using namespace GNAPluginNS;
+using namespace GNAPluginNS::backend;
+
+namespace {
+// keys of the first version hashed the whole arguments union
+const char pwlCacheMagic[] = {'G', 'N', 'A', 'P', 'W', 'L', 'C', '2'};
+
+template <class T>
+void writeBits(const T& value, std::ostream& os) {
+    os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <class T>
+bool readBits(T& value, std::istream& is) {
+    return static_cast<bool>(is.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+}  // namespace
+
+PwlCache& PwlCache::instance() {
+    static PwlCache cache;
+    return cache;
+}
+
+std::string PwlCache::makeKey(const DnnActivation& activation,
+                              float scale_in,
+                              float scale_out,
+                              float pwlMaxErrorPercent,
+                              bool low_precision) {
+    std::string key;
+    auto append = [&key](const void* ptr, size_t size) {
+        key.append(static_cast<const char*>(ptr), size);
+    };
+    // only first elements of FQ ranges are used by PWL design
+    auto appendFQ = [&append](const FakeQuantizeParams& fq) {
+        append(&fq.set, sizeof(fq.set));
+        if (fq.set) {
+            append(&fq.levels, sizeof(fq.levels));
+            append(fq.input_low, sizeof(float));
+            append(fq.input_high, sizeof(float));
+        }
+    };
+
+    append(&activation.type, sizeof(activation.type));
+    // only the union member of the activation type is initialized
+    switch (activation.type) {
+        case kActRelu:
+        case kActLeakyRelu:
+            append(&activation.args.lrelu.negative_slope, sizeof(float));
+            break;
+        case kActKaldiLstmClipping:
+            append(&activation.args.clamp.low, sizeof(float));
+            append(&activation.args.clamp.high, sizeof(float));
+            break;
+        case kActPow:
+            append(&activation.args.pow.exponent, sizeof(float));
+            append(&activation.args.pow.scale, sizeof(float));
+            append(&activation.args.pow.offset, sizeof(float));
+            break;
+        default:
+            break;
+    }
+    appendFQ(activation.fqParams);
+    appendFQ(activation.srcFQParams);
+    append(&scale_in, sizeof(scale_in));
+    append(&scale_out, sizeof(scale_out));
+    append(&pwlMaxErrorPercent, sizeof(pwlMaxErrorPercent));
+    append(&low_precision, sizeof(low_precision));
+    return key;
+}
+
+bool PwlCache::find(const std::string& key, std::vector<gna_pwl_segment_t>& segments) const {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto entry = entries.find(key);
+    if (entry == entries.end()) {
+        return false;
+    }
+    segments = entry->second;
+    return true;
+}
+
+void PwlCache::insert(const std::string& key, const std::vector<gna_pwl_segment_t>& segments) {
+    std::lock_guard<std::mutex> lock(mtx);
+    entries.emplace(key, segments);
+}
+
+void PwlCache::load(const std::string& path) {
+    std::ifstream is(path, std::ios::in | std::ios::binary);
+    if (!is.good()) {
+        return;
+    }
+
+    char magic[sizeof(pwlCacheMagic)];
+    uint64_t count = 0;
+    if (!is.read(magic, sizeof(magic)) || std::memcmp(magic, pwlCacheMagic, sizeof(magic)) != 0 || !readBits(count, is)) {
+        gnawarn() << "PWL cache file " << path << " has unsupported format and is ignored\n";
+        return;
+    }
+
+    decltype(entries) loaded;
+    for (uint64_t i = 0; i < count; i++) {
+        uint32_t keySize = 0, segmentsCount = 0;
+        if (!readBits(keySize, is)) break;
+        std::string key(keySize, '\0');
+        if (!is.read(&key[0], keySize) || !readBits(segmentsCount, is)) break;
+        std::vector<gna_pwl_segment_t> segments(segmentsCount);
+        if (!is.read(reinterpret_cast<char*>(segments.data()), segmentsCount * sizeof(gna_pwl_segment_t))) break;
+        loaded.emplace(std::move(key), std::move(segments));
+    }
+    if (loaded.size() != count) {
+        gnawarn() << "PWL cache file " << path << " is truncated and is ignored\n";
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mtx);
+    entries.insert(loaded.begin(), loaded.end());
+    storedCount[path] = loaded.size();
+}
+
+void PwlCache::save(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto stored = storedCount.find(path);
+    if (stored != storedCount.end() && stored->second == entries.size()) {
+        return;
+    }
+
+    std::ofstream os(path, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!os.good()) {
+        gnawarn() << "Cannot open PWL cache file " << path << " for writing, the cache is not stored\n";
+        return;
+    }
+    os.write(pwlCacheMagic, sizeof(pwlCacheMagic));
+    writeBits(static_cast<uint64_t>(entries.size()), os);
+    for (auto&& entry : entries) {
+        writeBits(static_cast<uint32_t>(entry.first.size()), os);
+        os.write(entry.first.data(), entry.first.size());
+        writeBits(static_cast<uint32_t>(entry.second.size()), os);
+        os.write(reinterpret_cast<const char*>(entry.second.data()), entry.second.size() * sizeof(gna_pwl_segment_t));
+    }
+    if (!os.good()) {
+        gnawarn() << "Cannot write PWL cache file " << path << ", the cache is not stored\n";
+        return;
+    }
+    storedCount[path] = entries.size();
+}
+
+void PwlCache::clear() {
+    std::lock_guard<std::mutex> lock(mtx);
+    entries.clear();
+    storedCount.clear();
+}
@@ -0,0 +1,56 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "backend/dnn_types.h"
+#include "backend/gna_types.h"
+
+namespace GNAPluginNS {
+namespace backend {
+/**
+ * @brief process wide storage of designed PWL segments.
+ * Networks usually have many activations with same function and scale factors,
+ * so the iterative segments search is done once per unique set of design parameters
+ */
+class PwlCache {
+public:
+    static PwlCache& instance();
+
+    /**
+     * @brief builds key from everything affecting the designed segments
+     */
+    static std::string makeKey(const DnnActivation& activation,
+                               float scale_in,
+                               float scale_out,
+                               float pwlMaxErrorPercent,
+                               bool low_precision);
+
+    bool find(const std::string& key, std::vector<gna_pwl_segment_t>& segments) const;
+    void insert(const std::string& key, const std::vector<gna_pwl_segment_t>& segments);
+
+    /**
+     * @brief adds entries stored in the file, missing or incompatible file is ignored
+     */
+    void load(const std::string& path);
+    /**
+     * @brief stores all entries to the file if it misses some of them, a file that cannot be written is only reported
+     */
+    void save(const std::string& path);
+
+    void clear();
+
+private:
+    mutable std::mutex mtx;
+    std::unordered_map<std::string, std::vector<gna_pwl_segment_t>> entries;
+    // number of entries stored in the file, entries of the file are always subset of the cached ones
+    std::unordered_map<std::string, size_t> storedCount;
+};
+}  // namespace backend
+}  // namespace GNAPluginNS
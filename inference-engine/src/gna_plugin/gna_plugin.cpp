@@ -32,6 +32,7 @@
 #include "frontend/model_quantizer.hpp"
 #include "gna_fused_iterator.hpp"
 #include "backend/am_intel_dnn.hpp"
+#include "backend/pwl_cache.hpp"
 #include "memory/gna_allocator.hpp"
 #include "memory/gna_memory_state.hpp"
 #include "gna_model_serial.hpp"
@@ -866,11 +867,19 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
         inputsDesc->getPtrInputsGlobal(input.first).resize(gnaFlags->gna_lib_async_threads_num);
     }
 
+    if (!config.pwlCacheFile.empty()) {
+        backend::PwlCache::instance().load(config.pwlCacheFile);
+    }
+
     // CreatingLayer primitives
     for (auto & layer : sortedNoMem) {
         graphCompiler.CreateLayerPrimitive(layer);
     }
 
+    if (!config.pwlCacheFile.empty()) {
+        backend::PwlCache::instance().save(config.pwlCacheFile);
+    }
+
     for (auto& inputLayer : inputLayers) {
         auto layerInfo = LayerInfo(inputLayer);
         if (layerInfo.isInput() && 0 == inputsDesc->bytes_allocated_for_input[inputLayer->name]) {
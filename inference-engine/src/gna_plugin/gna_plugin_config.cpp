@@ -174,6 +174,8 @@ void Config::UpdateFromMap(const std::map<std::string, std::string>& config) {
                     << ", should be greater than 0 and less than 100";
             }
             gnaFlags.pwlMaxErrorPercent = max_error;
+        } else if (key == GNA_CONFIG_KEY(PWL_CACHE_FILE)) {
+            pwlCacheFile = value;
         } else if (key == CONFIG_KEY(PERF_COUNT)) {
             if (value == PluginConfigParams::YES) {
                 gnaFlags.performance_counting = true;
@@ -272,6 +274,7 @@ void Config::AdjustKeyMapValues() {
     keyConfigMap[GNA_CONFIG_KEY(PWL_UNIFORM_DESIGN)] =
             gnaFlags.uniformPwlDesign ? PluginConfigParams::YES: PluginConfigParams::NO;
     keyConfigMap[GNA_CONFIG_KEY(PWL_MAX_ERROR_PERCENT)] = std::to_string(gnaFlags.pwlMaxErrorPercent);
+    keyConfigMap[GNA_CONFIG_KEY(PWL_CACHE_FILE)] = pwlCacheFile;
     keyConfigMap[CONFIG_KEY(PERF_COUNT)] =
             gnaFlags.performance_counting ? PluginConfigParams::YES: PluginConfigParams::NO;
     keyConfigMap[GNA_CONFIG_KEY(LIB_N_THREADS)] = std::to_string(gnaFlags.gna_lib_async_threads_num);
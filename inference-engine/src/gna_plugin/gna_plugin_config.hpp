@@ -33,6 +33,7 @@ struct Config {
         gnaPrecision = r.gnaPrecision;
         dumpXNNPath = r.dumpXNNPath;
         dumpXNNGeneration = r.dumpXNNGeneration;
+        pwlCacheFile = r.pwlCacheFile;
 #if GNA_LIB_VER == 1
         gna_proc_type = r.gna_proc_type;
 #else
@@ -54,6 +55,7 @@ struct Config {
 
     std::string dumpXNNPath;
     std::string dumpXNNGeneration;
+    std::string pwlCacheFile;
 
 #if GNA_LIB_VER == 1
     intel_gna_proc_t gna_proc_type = static_cast<intel_gna_proc_t>(GNA_SOFTWARE & GNA_HARDWARE);
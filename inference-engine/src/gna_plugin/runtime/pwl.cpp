@@ -28,6 +28,7 @@
 #include "pwl.h"
 #include "gna_plugin_log.hpp"
 #include "backend/dnn_types.h"
+#include "backend/pwl_cache.hpp"
 #include "gna_slope_scale.h"
 #include "round_float_define.hpp"
 
@@ -502,6 +503,12 @@ void PwlDesignOpt(const DnnActivation activation_type,
                     const float scale_out,
                     const float pwlMaxErrorPercent,
                     const bool low_precision) {
+    auto& cache = GNAPluginNS::backend::PwlCache::instance();
+    const auto cacheKey = cache.makeKey(activation_type, scale_in, scale_out, pwlMaxErrorPercent, low_precision);
+    if (cache.find(cacheKey, ptr_segment)) {
+        return;
+    }
+
     std::vector<pwl_t> pwl;
     double err_pct = 0.0;
     auto minInputStats = 0.0f;
@@ -606,8 +613,9 @@ void PwlDesignOpt(const DnnActivation activation_type,
             break;
         }
         default:
-            break;
+            return;
     }
+    cache.insert(cacheKey, ptr_segment);
 }
 
 void PwlDesign(const DnnActivation activation_type,
@@ -885,58 +893,63 @@ void PwlApply16(intel_dnn_component_t *component, uint32_t num_subset_size) {
     }
 }
 
+PwlSegments16 PwlDecodeSegments16(const intel_piecewiselinear_t& pwl) {
+    PwlSegments16 decoded;
+    if (pwl.num_segments == 0) {
+        return decoded;
+    }
+    // padding to power of two size makes the per element search a fixed number of branch free steps,
+    // which the compiler is able to vectorize across columns
+    uint32_t num_padded = 1;
+    while (num_padded < pwl.num_segments) {
+        num_padded <<= 1;
+    }
+    decoded.xbase.assign(num_padded, std::numeric_limits<int64_t>::max());
+    decoded.segments.assign(num_padded, PwlSegments16::Segment{0, 0, 0});
+    for (uint32_t k = 0; k < pwl.num_segments; k++) {
+        const auto& segment = pwl.ptr_segments[k];
+        decoded.xbase[k] = (int32_t) (segment.xBase & XBASEMASK);
+        decoded.segments[k] = {segment.yBase, segment.slope, ((segment.xBase & ~XBASEMASK) + 1) * 8};
+    }
+    return decoded;
+}
+
+void PwlApply16(intel_dnn_component_t *component,
+                uint32_t num_row_start,
+                uint32_t num_row_end,
+                uint32_t num_col_start,
+                uint32_t num_col_end) {
+    PwlApply16(component, PwlDecodeSegments16(component->op.pwl), num_row_start, num_row_end, num_col_start, num_col_end);
+}
+
 void PwlApply16(intel_dnn_component_t *component,
+                const PwlSegments16& segments,
                 uint32_t num_row_start,
                 uint32_t num_row_end,
                 uint32_t num_col_start,
                 uint32_t num_col_end) {
     uint32_t num_saturate = 0;
-    uint32_t num_segments = component->op.pwl.num_segments;
-    if (num_segments > 0) {
-        gna_pwl_segment_t *ptr_segment = component->op.pwl.ptr_segments;
+    const uint32_t num_padded = static_cast<uint32_t>(segments.xbase.size());
+    if (num_padded > 0) {
+        const int64_t *ptr_xbase = segments.xbase.data();
+        const PwlSegments16::Segment *ptr_segment = segments.segments.data();
+
         for (int i = num_row_start; i <= num_row_end; i++) {
             int32_t *ptr_input = reinterpret_cast<int32_t *>(component->ptr_inputs) + i * component->num_columns_in;
             int16_t *ptr_output = reinterpret_cast<int16_t *>(component->ptr_outputs) + i * component->num_columns_in;
             for (int j = num_col_start; j <= num_col_end; j++) {
-                int32_t xbase = (int32_t) (ptr_segment[0].xBase & XBASEMASK);
-                int32_t input = ptr_input[j];
-                if (input <= xbase) {
-                    ptr_output[j] = ptr_segment[0].yBase;
-                } else {
-                    uint32_t slope_shift;
-                    int16_t slope, ybase;
-                    int64_t diff, prod, prod_shift, sum;
-                    uint32_t k = num_segments / 2;
-                    uint32_t k_upper = num_segments;
-                    uint32_t k_lower = 0;
-                    while (k_upper > k_lower + 1) {
-                        xbase = (int32_t) (ptr_segment[k].xBase & XBASEMASK);
-                        if (xbase > input) {
-                            k_upper = k;
-                            k = (k + k_lower) / 2;
-                        } else {
-                            k_lower = k;
-                            k = (k_upper + k) / 2;
-                        }
-                    }
-                    xbase = (int32_t) (ptr_segment[k].xBase & XBASEMASK);
-                    slope_shift = ((ptr_segment[k].xBase & ~XBASEMASK) + 1) * 8;
-                    slope = ptr_segment[k].slope;
-                    ybase = ptr_segment[k].yBase;
-                    diff = (int64_t) input - (int64_t) xbase;
-                    prod = diff * slope;
-                    prod_shift = prod >> slope_shift;
-                    sum = prod_shift + (int64_t) ybase;
-                    if (sum > 32767LL) {
-                        ptr_output[j] = 32767;
-                        num_saturate++;
-                    } else if (sum < -32768LL) {
-                        ptr_output[j] = -32768;
-                        num_saturate++;
-                    } else {
-                        ptr_output[j] = (int16_t) sum;
-                    }
+                const int64_t input = ptr_input[j];
+                // last segment starting not above the input
+                uint32_t k = 0;
+                for (uint32_t step = num_padded >> 1; step > 0; step >>= 1) {
+                    k = (ptr_xbase[k + step] <= input) ? k + step : k;
+                }
+                int64_t sum = (((input - ptr_xbase[k]) * ptr_segment[k].slope) >> ptr_segment[k].slope_shift) + ptr_segment[k].ybase;
+                if (input <= ptr_xbase[0]) {
+                    sum = ptr_segment[0].ybase;
                 }
+                num_saturate += (sum > 32767LL || sum < -32768LL) ? 1 : 0;
+                ptr_output[j] = (int16_t) std::min<int64_t>(std::max<int64_t>(sum, -32768), 32767);
             }
         }
     }
@@ -83,12 +83,35 @@ double calculate_error_pct(const DnnActivation& activation_type,
                            const double offset,
                            const int samples);
 
+/**
+ * @brief 16-bit PWL segments decoded for the branch free search, padded to a power of two size.
+ * Segments of a component are decoded once and used for all its rows
+ */
+struct PwlSegments16 {
+    struct Segment {
+        int64_t ybase;
+        int64_t slope;
+        uint32_t slope_shift;
+    };
+    // start of each segment, padding segments start above any input
+    std::vector<int64_t> xbase;
+    std::vector<Segment> segments;
+};
+
+PwlSegments16 PwlDecodeSegments16(const intel_piecewiselinear_t& pwl);
+
 void PwlApply16(intel_dnn_component_t *component, const uint32_t num_subset_size);
 void PwlApply16(intel_dnn_component_t *component,
                 const uint32_t num_row_start,
                 const uint32_t num_row_end,
                 const uint32_t num_col_start,
                 const uint32_t num_col_end);
+void PwlApply16(intel_dnn_component_t *component,
+                const PwlSegments16& segments,
+                const uint32_t num_row_start,
+                const uint32_t num_row_end,
+                const uint32_t num_col_start,
+                const uint32_t num_col_end);
 void PwlApply32(intel_dnn_component_t *component, const uint32_t num_subset_size);
 void PwlApply32(intel_dnn_component_t *component,
                 const uint32_t num_row_start,
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <chrono>
 #include <utility>
 #include <memory>
 #include "hetero_async_infer_request.hpp"
@@ -18,24 +19,32 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const InferRequestInternal::Ptr
     _pipeline.clear();
     for (std::size_t requestId = 0; requestId < _heteroInferRequest->_inferRequests.size(); ++requestId) {
         struct RequestExecutor : ITaskExecutor {
-            explicit RequestExecutor(InferRequest* inferRequest) : _inferRequest{inferRequest} {
+            RequestExecutor(InferRequest* inferRequest, const HeteroInferRequest::StageStatistics::Ptr& statistics) :
+                _inferRequest{inferRequest}, _statistics{statistics} {
                 _inferRequest->SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
                 [this] (InferRequest, StatusCode sts) mutable {
                     _status = sts;
+                    if (_statistics) {
+                        _statistics->Record(std::chrono::steady_clock::now() - _start);
+                    }
                     auto capturedTask = std::move(_task);
                     capturedTask();
                 });
             }
             void run(Task task) override {
                 _task = std::move(task);
+                _start = std::chrono::steady_clock::now();
                 _inferRequest->StartAsync();
             };
-            InferRequest*   _inferRequest = nullptr;
-            StatusCode      _status = StatusCode::OK;
-            Task            _task;
+            InferRequest*                               _inferRequest = nullptr;
+            HeteroInferRequest::StageStatistics::Ptr    _statistics;
+            std::chrono::steady_clock::time_point       _start;
+            StatusCode                                  _status = StatusCode::OK;
+            Task                                        _task;
         };
 
-        auto requestExecutor = std::make_shared<RequestExecutor>(_heteroInferRequest->_inferRequests[requestId]._request.get());
+        auto& subRequest = _heteroInferRequest->_inferRequests[requestId];
+        auto requestExecutor = std::make_shared<RequestExecutor>(subRequest._request.get(), subRequest._statistics);
         _pipeline.emplace_back(requestExecutor, [requestExecutor] {
             if (StatusCode::OK != requestExecutor->_status) {
                 IE_EXCEPTION_SWITCH(requestExecutor->_status, ExceptionType,
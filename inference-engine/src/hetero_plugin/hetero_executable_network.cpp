@@ -11,6 +11,7 @@
 
 #include <vector>
 #include <deque>
+#include <functional>
 #include <map>
 #include <utility>
 #include <fstream>
@@ -20,6 +21,12 @@
 #include <unordered_set>
 #include <array>
 #include <cstdint>
+#include <chrono>
+#include <iomanip>
+#include <limits>
+#include <numeric>
+#include <set>
+#include <sstream>
 
 #include "transformations/serialize.hpp"
 #include "ie_ngraph_utils.hpp"
@@ -34,6 +41,9 @@
 #include <ngraph/op/result.hpp>
 #include <ngraph/op/parameter.hpp>
 #include <ngraph/op/util/op_types.hpp>
+#include <ngraph/op/convolution.hpp>
+#include <ngraph/op/group_conv.hpp>
+#include <ngraph/op/matmul.hpp>
 #include <ngraph/rt_info.hpp>
 #include <ngraph/pass/visualize_tree.hpp>
 
@@ -46,6 +56,421 @@ using namespace InferenceEngine::HeteroConfigParams;
 template<typename T>
 using NodeMap = std::unordered_map<ngraph::Node*, T>;
 
+namespace {
+
+// Cost model of HETERO_MIN_COST partition policy. All times are in nanoseconds
+constexpr double estimatedOpsPerNs = 50.;
+constexpr double transferNsPerByte = 0.25;
+constexpr double transferLatencyNs = 20000.;
+constexpr int calibrationIterations = 5;
+constexpr int maxPartitionPasses = 16;
+
+bool IsComputeNode(const std::shared_ptr<ngraph::Node>& node) {
+    return !ngraph::op::is_constant(node) && !ngraph::op::is_parameter(node) && !ngraph::op::is_output(node);
+}
+
+std::size_t TensorBytes(const ngraph::Output<ngraph::Node>& output) {
+    return output.get_partial_shape().is_static()
+         ? ngraph::shape_size(output.get_shape()) * output.get_element_type().size()
+         : 0;
+}
+
+double TransferTime(std::size_t bytes) {
+    return transferLatencyNs + transferNsPerByte * bytes;
+}
+
+// Number of multiply-accumulate operations for convolutions and matrix multiplications
+// and number of output elements for other layers
+double EstimateWork(const ngraph::Node& node) {
+    double work = 0.;
+    for (auto&& output : node.outputs()) {
+        if (output.get_partial_shape().is_static()) {
+            work += ngraph::shape_size(output.get_shape());
+        }
+    }
+    auto GetStaticInputShape = [&] (std::size_t index, ngraph::Shape& shape) {
+        if (index >= node.get_input_size() || node.get_input_partial_shape(index).is_dynamic()) {
+            return false;
+        }
+        shape = node.get_input_shape(index);
+        return true;
+    };
+    ngraph::Shape shape;
+    if (ngraph::is_type<ngraph::op::v1::Convolution>(&node) && GetStaticInputShape(1, shape) && shape.size() > 1) {
+        work *= ngraph::shape_size(shape) / std::max<std::size_t>(shape[0], 1);
+    } else if (ngraph::is_type<ngraph::op::v1::GroupConvolution>(&node) && GetStaticInputShape(1, shape) && shape.size() > 2) {
+        work *= ngraph::shape_size(shape) / std::max<std::size_t>(shape[0] * shape[1], 1);
+    } else if (ngraph::is_type<ngraph::op::v0::MatMul>(&node) && GetStaticInputShape(0, shape) && !shape.empty()) {
+        auto transposeA = static_cast<const ngraph::op::v0::MatMul&>(node).get_transpose_a();
+        work *= (transposeA && shape.size() > 1) ? shape[shape.size() - 2] : shape.back();
+    }
+    return std::max(work, 1.);
+}
+
+std::string OpSignature(const ngraph::Node& node) {
+    std::stringstream signature;
+    signature << node.get_type_info().name << '.' << node.get_type_info().version;
+    for (auto&& input : node.inputs()) {
+        signature << (ngraph::op::is_constant(input.get_source_output().get_node()) ? " const " : " ")
+                  << input.get_element_type() << input.get_partial_shape();
+    }
+    for (auto&& output : node.outputs()) {
+        signature << " -> " << output.get_element_type() << output.get_partial_shape();
+    }
+    return signature.str();
+}
+
+// Returns the best of several execution times of a single layer network or negative value if it can not be measured
+double MeasureOpTime(ICore*                                     core,
+                     const ngraph::Node&                        node,
+                     const std::string&                         device,
+                     const std::map<std::string, std::string>&  config) {
+    ngraph::ParameterVector parameters;
+    ngraph::OutputVector inputs;
+    for (auto&& input : node.inputs()) {
+        auto source = input.get_source_output();
+        if (ngraph::op::is_constant(source.get_node())) {
+            inputs.emplace_back(source.get_node()->clone_with_new_inputs({}));
+        } else {
+            parameters.emplace_back(
+                std::make_shared<ngraph::op::Parameter>(source.get_element_type(), source.get_partial_shape()));
+            inputs.emplace_back(parameters.back());
+        }
+    }
+    if (parameters.empty()) {
+        return -1.;
+    }
+    auto op = node.clone_with_new_inputs(inputs);
+    ngraph::ResultVector results;
+    for (auto&& output : op->outputs()) {
+        results.emplace_back(std::make_shared<ngraph::op::Result>(output));
+    }
+    try {
+        auto executableNetwork = core->LoadNetwork(
+            CNNNetwork{std::make_shared<ngraph::Function>(results, parameters)}, device, config);
+        auto request = executableNetwork.CreateInferRequest();
+        request.Infer();
+        auto best = std::numeric_limits<double>::max();
+        for (int i = 0; i < calibrationIterations; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            request.Infer();
+            best = std::min(best, std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count());
+        }
+        return best;
+    } catch (const std::exception&) {
+        return -1.;
+    }
+}
+
+// Assignment of layers to devices that minimizes execution time of layers plus time of tensor transfers between devices
+struct CostPartition {
+    struct Tensor {
+        int                 _producer;
+        std::vector<int>    _consumers;
+        double              _transferTime;
+    };
+
+    static constexpr double unsupported = std::numeric_limits<double>::infinity();
+
+    std::vector<std::vector<double>>    _times;         // [layer][device]
+    std::vector<Tensor>                 _tensors;
+    std::vector<std::vector<int>>       _layerTensors;  // tensors produced or consumed by layer
+    std::vector<int>                    _devices;       // chosen device of each layer
+
+    double TensorTime(const Tensor& tensor) const {
+        std::set<int> targetDevices;
+        for (auto&& consumer : tensor._consumers) {
+            if (_devices[consumer] != _devices[tensor._producer]) {
+                targetDevices.insert(_devices[consumer]);
+            }
+        }
+        return targetDevices.size() * tensor._transferTime;
+    }
+
+    double Time(const std::vector<int>& layers) const {
+        std::set<int> tensors;
+        double time = 0.;
+        for (auto&& layer : layers) {
+            time += _times[layer][_devices[layer]];
+            tensors.insert(_layerTensors[layer].begin(), _layerTensors[layer].end());
+        }
+        for (auto&& tensor : tensors) {
+            time += TensorTime(_tensors[tensor]);
+        }
+        return time;
+    }
+
+    double MoveDelta(const std::vector<int>& layers, int device) {
+        auto before = Time(layers);
+        std::vector<int> prevDevices;
+        for (auto&& layer : layers) {
+            prevDevices.push_back(_devices[layer]);
+            _devices[layer] = device;
+        }
+        auto after = Time(layers);
+        for (std::size_t i = 0; i < layers.size(); ++i) {
+            _devices[layers[i]] = prevDevices[i];
+        }
+        return after - before;
+    }
+
+    void Move(const std::vector<int>& layers, int device) {
+        for (auto&& layer : layers) {
+            _devices[layer] = device;
+        }
+    }
+
+    bool CanMove(const std::vector<int>& layers, int device) const {
+        return std::all_of(layers.begin(), layers.end(), [&] (int layer) {
+            return _devices[layer] != device && _times[layer][device] != unsupported;
+        });
+    }
+
+    bool IsAdjacent(const std::vector<int>& layers, int device) const {
+        return std::any_of(layers.begin(), layers.end(), [&] (int layer) {
+            return std::any_of(_layerTensors[layer].begin(), _layerTensors[layer].end(), [&] (int tensor) {
+                auto& consumers = _tensors[tensor]._consumers;
+                return _devices[_tensors[tensor]._producer] == device ||
+                       std::any_of(consumers.begin(), consumers.end(), [&] (int consumer) {
+                           return _devices[consumer] == device;
+                       });
+            });
+        });
+    }
+
+    // Connected groups of layers assigned to the same device
+    std::vector<std::vector<int>> Components() const {
+        std::vector<int> parents(_devices.size());
+        std::iota(parents.begin(), parents.end(), 0);
+        std::function<int(int)> Root = [&] (int layer) {
+            return parents[layer] == layer ? layer : (parents[layer] = Root(parents[layer]));
+        };
+        for (auto&& tensor : _tensors) {
+            for (auto&& consumer : tensor._consumers) {
+                if (_devices[consumer] == _devices[tensor._producer]) {
+                    parents[Root(consumer)] = Root(tensor._producer);
+                }
+            }
+        }
+        std::map<int, std::vector<int>> components;
+        for (int layer = 0; layer < static_cast<int>(_devices.size()); ++layer) {
+            components[Root(layer)].push_back(layer);
+        }
+        std::vector<std::vector<int>> result;
+        for (auto&& component : components) {
+            result.emplace_back(std::move(component.second));
+        }
+        return result;
+    }
+
+    // Applies the best improving move of each group of layers to another device
+    bool Improve(const std::vector<std::vector<int>>& groups) {
+        bool improved = false;
+        for (auto&& group : groups) {
+            int bestDevice = -1;
+            double bestDelta = -1.;
+            for (int device = 0; device < static_cast<int>(_times.front().size()); ++device) {
+                if (CanMove(group, device)) {
+                    auto delta = MoveDelta(group, device);
+                    if (delta < bestDelta) {
+                        bestDelta = delta;
+                        bestDevice = device;
+                    }
+                }
+            }
+            if (bestDevice >= 0) {
+                Move(group, bestDevice);
+                improved = true;
+            }
+        }
+        return improved;
+    }
+
+    void Optimize(std::size_t maxSubgraphs) {
+        if (_devices.empty()) {
+            return;
+        }
+        std::vector<std::vector<int>> layers;
+        for (int layer = 0; layer < static_cast<int>(_devices.size()); ++layer) {
+            layers.push_back({layer});
+        }
+        // Single layer moves remove cheap transfers, moves of whole groups remove ping-pong between devices
+        for (int pass = 0; pass < maxPartitionPasses; ++pass) {
+            bool improved = Improve(layers);
+            improved = Improve(Components()) || improved;
+            if (!improved) {
+                break;
+            }
+        }
+        // Merge groups with the lowest cost penalty until the number of groups fits the limit
+        for (auto components = Components(); maxSubgraphs != 0 && components.size() > maxSubgraphs; components = Components()) {
+            std::vector<int>* bestComponent = nullptr;
+            int bestDevice = -1;
+            auto bestDelta = unsupported;
+            for (auto&& component : components) {
+                for (int device = 0; device < static_cast<int>(_times.front().size()); ++device) {
+                    if (CanMove(component, device) && IsAdjacent(component, device)) {
+                        auto delta = MoveDelta(component, device);
+                        if (delta < bestDelta) {
+                            bestDelta = delta;
+                            bestDevice = device;
+                            bestComponent = &component;
+                        }
+                    }
+                }
+            }
+            if (bestComponent == nullptr) {
+                break;
+            }
+            Move(*bestComponent, bestDevice);
+        }
+    }
+};
+
+constexpr double CostPartition::unsupported;
+
+}  // namespace
+
+QueryNetworkResult HeteroExecutableNetwork::QueryNetworkByCost(const InferenceEngine::CNNNetwork&          network,
+                                                               const std::shared_ptr<ngraph::Function>&    function) {
+    auto itOpCosts = _config.find(HETERO_CONFIG_KEY(OP_COSTS));
+    bool calibrate = false;
+    if (itOpCosts != _config.end()) {
+        if (itOpCosts->second == HETERO_CONFIG_VALUE(CALIBRATE)) {
+            calibrate = true;
+        } else if (itOpCosts->second != HETERO_CONFIG_VALUE(ESTIMATE)) {
+            IE_THROW() << "Unsupported value " << itOpCosts->second << " for " << HETERO_CONFIG_KEY(OP_COSTS);
+        }
+    }
+    std::size_t maxSubgraphs = 0;
+    auto itMaxSubgraphs = _config.find(HETERO_CONFIG_KEY(MAX_SUBGRAPHS));
+    if (itMaxSubgraphs != _config.end()) {
+        int value = -1;
+        try {
+            value = std::stoi(itMaxSubgraphs->second);
+        } catch (...) {}
+        if (value < 0) {
+            IE_THROW() << "Wrong value " << itMaxSubgraphs->second << " for " << HETERO_CONFIG_KEY(MAX_SUBGRAPHS)
+                       << ". Expected non negative integer";
+        }
+        maxSubgraphs = static_cast<std::size_t>(value);
+    }
+
+    auto& targetFallback = _config.at("TARGET_FALLBACK");
+    auto fallbackDevices = DeviceIDParser::getHeteroDevices(targetFallback);
+    auto metaDevices = _heteroPlugin->GetDevicePlugins(targetFallback, _config);
+    std::vector<QueryNetworkResult> queryResults;
+    for (auto&& device : fallbackDevices) {
+        queryResults.emplace_back(_heteroPlugin->GetCore()->QueryNetwork(network, device, metaDevices[device]));
+    }
+
+    // Layers that are supported at least by one device. The initial assignment is the fallback order one
+    CostPartition partition;
+    std::vector<std::shared_ptr<ngraph::Node>> layers;
+    NodeMap<int> layerIds;
+    for (auto&& node : function->get_ordered_ops()) {
+        if (!IsComputeNode(node)) {
+            continue;
+        }
+        std::vector<double> times(fallbackDevices.size(), CostPartition::unsupported);
+        int firstDevice = -1;
+        for (int device = static_cast<int>(fallbackDevices.size()) - 1; device >= 0; --device) {
+            if (contains(queryResults[device].supportedLayersMap, node->get_friendly_name())) {
+                times[device] = -1.;
+                firstDevice = device;
+            }
+        }
+        if (firstDevice >= 0) {
+            layerIds.emplace(node.get(), static_cast<int>(layers.size()));
+            layers.push_back(node);
+            partition._times.emplace_back(std::move(times));
+            partition._devices.push_back(firstDevice);
+        }
+    }
+
+    // Layer times are measured on devices if requested. Other layers are estimated using the median measured time
+    // per operation of the device
+    std::vector<double> nsPerOp(fallbackDevices.size(), 1. / estimatedOpsPerNs);
+    if (calibrate) {
+        std::map<std::pair<std::string, int>, double> measuredTimes;
+        std::vector<std::vector<double>> measuredNsPerOp(fallbackDevices.size());
+        for (std::size_t layer = 0; layer < layers.size(); ++layer) {
+            auto& times = partition._times[layer];
+            if (std::count(times.begin(), times.end(), CostPartition::unsupported) + 1 >= static_cast<long>(times.size())) {
+                continue;
+            }
+            auto signature = OpSignature(*layers[layer]);
+            for (int device = 0; device < static_cast<int>(fallbackDevices.size()); ++device) {
+                if (times[device] == CostPartition::unsupported) {
+                    continue;
+                }
+                auto itTime = measuredTimes.find({signature, device});
+                if (itTime == measuredTimes.end()) {
+                    auto config = metaDevices[fallbackDevices[device]];
+                    config.emplace(CONFIG_KEY_INTERNAL(FORCE_DISABLE_CACHE), "");
+                    auto time = MeasureOpTime(_heteroPlugin->GetCore(), *layers[layer], fallbackDevices[device], config);
+                    itTime = measuredTimes.emplace(std::make_pair(signature, device), time).first;
+                    if (time >= 0.) {
+                        measuredNsPerOp[device].push_back(time / EstimateWork(*layers[layer]));
+                    }
+                }
+                times[device] = itTime->second;
+            }
+        }
+        for (std::size_t device = 0; device < fallbackDevices.size(); ++device) {
+            auto& values = measuredNsPerOp[device];
+            if (!values.empty()) {
+                std::nth_element(values.begin(), values.begin() + values.size() / 2, values.end());
+                nsPerOp[device] = values[values.size() / 2];
+            }
+        }
+    }
+    for (std::size_t layer = 0; layer < layers.size(); ++layer) {
+        for (std::size_t device = 0; device < fallbackDevices.size(); ++device) {
+            auto& time = partition._times[layer][device];
+            if (time < 0.) {
+                time = EstimateWork(*layers[layer]) * nsPerOp[device];
+            }
+        }
+    }
+
+    // Tensors passed between layers
+    partition._layerTensors.resize(layers.size());
+    for (std::size_t layer = 0; layer < layers.size(); ++layer) {
+        for (auto&& output : layers[layer]->outputs()) {
+            std::set<int> consumers;
+            for (auto&& targetInput : output.get_target_inputs()) {
+                auto itConsumer = layerIds.find(targetInput.get_node());
+                if (itConsumer != layerIds.end()) {
+                    consumers.insert(itConsumer->second);
+                }
+            }
+            if (consumers.empty()) {
+                continue;
+            }
+            int tensor = static_cast<int>(partition._tensors.size());
+            partition._tensors.push_back({static_cast<int>(layer),
+                                          std::vector<int>(consumers.begin(), consumers.end()),
+                                          TransferTime(TensorBytes(output))});
+            partition._layerTensors[layer].push_back(tensor);
+            for (auto&& consumer : consumers) {
+                partition._layerTensors[consumer].push_back(tensor);
+            }
+        }
+    }
+
+    partition.Optimize(maxSubgraphs);
+
+    QueryNetworkResult result;
+    for (std::size_t layer = 0; layer < layers.size(); ++layer) {
+        auto device = partition._devices[layer];
+        result.supportedLayersMap.emplace(layers[layer]->get_friendly_name(), fallbackDevices[device]);
+        _estimatedOpTimes.emplace(layers[layer]->get_friendly_name(), partition._times[layer][device]);
+    }
+    result.rc = StatusCode::OK;
+    return result;
+}
+
 HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwork&     network,
                                                  const Engine::Configs&                 config,
                                                  Engine*                                plugin):
@@ -62,6 +487,16 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
 #ifndef NDEBUG
     dumpDotFile  = true;
 #endif
+    auto itPartitionPolicy = _config.find(HETERO_CONFIG_KEY(PARTITION_POLICY));
+    bool minCostPartition = false;
+    if (itPartitionPolicy != _config.end()) {
+        if (itPartitionPolicy->second == HETERO_CONFIG_VALUE(MIN_COST)) {
+            minCostPartition = true;
+        } else if (itPartitionPolicy->second != HETERO_CONFIG_VALUE(FALLBACK_ORDER)) {
+            IE_THROW() << "Unsupported value " << itPartitionPolicy->second
+                       << " for " << HETERO_CONFIG_KEY(PARTITION_POLICY);
+        }
+    }
     QueryNetworkResult queryNetworkResult;
     auto orderedOps = clonedFunction->get_ordered_ops();
     bool allEmpty = true;
@@ -81,7 +516,8 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
     if (queryNetworkResult.supportedLayersMap.empty()) {
         auto it = _config.find("TARGET_FALLBACK");
         if (it != _config.end()) {
-            queryNetworkResult = _heteroPlugin->QueryNetwork(network, _config);
+            queryNetworkResult = minCostPartition ? QueryNetworkByCost(network, clonedFunction)
+                                                  : _heteroPlugin->QueryNetwork(network, _config);
         } else {
             IE_THROW() << "The 'TARGET_FALLBACK' option was not defined for heterogeneous plugin";
         }
@@ -394,6 +830,27 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
                 itClonedOutput->second->setLayout(externalOutput.second->getLayout());
             }
         }
+        // estimated time of layers and of input transfers from other devices
+        if (!_estimatedOpTimes.empty()) {
+            double estimatedTime = 0.;
+            for (auto&& node : subFunctions[id]->get_ops()) {
+                auto itTime = _estimatedOpTimes.find(node->get_friendly_name());
+                if (IsComputeNode(node) && itTime != _estimatedOpTimes.end()) {
+                    estimatedTime += itTime->second;
+                }
+            }
+            for (auto&& parameter : subgraph._parameters) {
+                auto itPrevResult = subgraphParameterToPrevResult.find(parameter.get());
+                if (itPrevResult != subgraphParameterToPrevResult.end()) {
+                    auto itAffinity = affinities.find(itPrevResult->second->input_value(0).get_node());
+                    if (itAffinity == affinities.end() || itAffinity->second != subgraph._affinity) {
+                        estimatedTime += TransferTime(TensorBytes(parameter->output(0)));
+                    }
+                }
+            }
+            networks[id]._estimatedTime = estimatedTime;
+        }
+        networks[id]._statistics = std::make_shared<HeteroInferRequest::StageStatistics>();
         ++id;
     }
     if (dumpDotFile) {
@@ -540,6 +997,8 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&
             deviceName,
             loaded ? cnnnetwork : CNNNetwork{},
             executableNetwork,
+            0.,
+            std::make_shared<HeteroInferRequest::StageStatistics>(),
         });
     }
 
@@ -647,6 +1106,7 @@ InferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
         HeteroInferRequest::SubRequestDesc desc;
         desc._network = subnetwork._network;
         desc._profilingTask = openvino::itt::handle("Infer" + std::to_string(index++));
+        desc._statistics = subnetwork._statistics;
         inferRequests.push_back(desc);
     }
     return std::make_shared<HeteroInferRequest>(networkInputs,
@@ -673,6 +1133,12 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetConfig(const std::string
         auto it = _config.find(name);
         IE_ASSERT(it != _config.end());
         result = it->second == YES ? true : false;
+    } else if (name == HETERO_CONFIG_KEY(PARTITION_POLICY) ||
+               name == HETERO_CONFIG_KEY(OP_COSTS) ||
+               name == HETERO_CONFIG_KEY(MAX_SUBGRAPHS)) {
+        auto it = _config.find(name);
+        IE_ASSERT(it != _config.end());
+        result = it->second;
     } else {
         // find config key among plugin config keys
         for (auto&& desc : networks) {
@@ -734,7 +1200,8 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string
             METRIC_KEY(NETWORK_NAME),
             METRIC_KEY(SUPPORTED_METRICS),
             METRIC_KEY(SUPPORTED_CONFIG_KEYS),
-            METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)
+            METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
+            METRIC_KEY(HETERO_PARTITION)
         };
 
         {
@@ -757,6 +1224,9 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string
         std::vector<std::string> heteroConfigKeys = {
             "TARGET_FALLBACK",
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+            HETERO_CONFIG_KEY(PARTITION_POLICY),
+            HETERO_CONFIG_KEY(OP_COSTS),
+            HETERO_CONFIG_KEY(MAX_SUBGRAPHS),
             CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)
         };
 
@@ -784,6 +1254,8 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string
             value = std::max(value, desc._network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
         }
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, value);
+    } else if (EXEC_NETWORK_METRIC_KEY(HETERO_PARTITION) == name) {
+        IE_SET_METRIC_RETURN(HETERO_PARTITION, PartitionReport());
     } else {
         // find metric key among plugin metrics
         for (auto&& desc : networks) {
@@ -800,6 +1272,54 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string
     }
 }
 
+std::string HeteroExecutableNetwork::PartitionReport() const {
+    std::stringstream report;
+    report << std::fixed << std::setprecision(1);
+    double totalEstimatedTime = 0., totalMeasuredTime = 0.;
+    bool estimated = true, measured = true;
+    for (std::size_t id = 0; id < networks.size(); ++id) {
+        auto& desc = networks[id];
+        report << "subgraph" << id << ": device=" << desc._device;
+        auto subFunction = desc._clonedNetwork.getFunction();
+        if (subFunction != nullptr) {
+            auto ops = subFunction->get_ops();
+            report << " layers=" << std::count_if(ops.begin(), ops.end(), IsComputeNode);
+        }
+        report << " estimated=";
+        if (desc._estimatedTime > 0.) {
+            report << desc._estimatedTime / 1000. << "us";
+            totalEstimatedTime += desc._estimatedTime;
+        } else {
+            report << "n/a";
+            estimated = false;
+        }
+        report << " measured=";
+        auto count = desc._statistics ? desc._statistics->_count.load() : 0;
+        if (count != 0) {
+            auto measuredTime = static_cast<double>(desc._statistics->_totalTime.load()) / count;
+            report << measuredTime / 1000. << "us (" << count << " runs)";
+            totalMeasuredTime += measuredTime;
+        } else {
+            report << "n/a";
+            measured = false;
+        }
+        report << '\n';
+    }
+    report << "total: estimated=";
+    if (estimated) {
+        report << totalEstimatedTime / 1000. << "us";
+    } else {
+        report << "n/a";
+    }
+    report << " measured=";
+    if (measured) {
+        report << totalMeasuredTime / 1000. << "us";
+    } else {
+        report << "n/a";
+    }
+    return report.str();
+}
+
 bool HeteroExecutableNetwork::ImportExportSupported(const std::string& deviceName) const {
     std::vector<std::string> supportedMetricKeys = _heteroPlugin->GetCore()->GetMetric(
             deviceName, METRIC_KEY(SUPPORTED_METRICS));
@@ -64,11 +64,16 @@ private:
     void InitCNNImpl(const InferenceEngine::CNNNetwork&    network);
     void InitNgraph(const InferenceEngine::CNNNetwork&     network);
     bool ImportExportSupported(const std::string& deviceName) const;
+    InferenceEngine::QueryNetworkResult QueryNetworkByCost(const InferenceEngine::CNNNetwork&          network,
+                                                           const std::shared_ptr<ngraph::Function>&    function);
+    std::string PartitionReport() const;
 
     struct NetworkDesc {
         std::string                                 _device;
         InferenceEngine::CNNNetwork                 _clonedNetwork;
         InferenceEngine::ExecutableNetwork          _network;
+        double                                      _estimatedTime;  // nanoseconds, 0 if not estimated
+        HeteroInferRequest::StageStatistics::Ptr    _statistics;
     };
     std::vector<NetworkDesc> networks;
 
@@ -76,6 +81,7 @@ private:
     std::string                         _name;
     std::map<std::string, std::string>  _config;
     std::unordered_map<std::string, std::string> _blobNameMap;
+    std::unordered_map<std::string, double> _estimatedOpTimes;
 };
 
 }  // namespace HeteroPlugin
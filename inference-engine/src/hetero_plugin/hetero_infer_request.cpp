@@ -87,7 +87,11 @@ void HeteroInferRequest::InferImpl() {
         OV_ITT_SCOPED_TASK(itt::domains::HeteroPlugin, desc._profilingTask);
         auto &r = desc._request;
         assert(nullptr != r);
+        auto start = std::chrono::steady_clock::now();
         r->Infer();
+        if (desc._statistics) {
+            desc._statistics->Record(std::chrono::steady_clock::now() - start);
+        }
     }
 }
 
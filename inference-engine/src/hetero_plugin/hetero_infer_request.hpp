@@ -9,6 +9,9 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <map>
 #include <string>
 #include <vector>
@@ -26,10 +29,24 @@ class HeteroInferRequest : public InferenceEngine::InferRequestInternal {
 public:
     typedef std::shared_ptr<HeteroInferRequest> Ptr;
 
+    /**
+     * @brief Accumulated execution time of a subgraph shared by all infer requests of a network
+     */
+    struct StageStatistics {
+        using Ptr = std::shared_ptr<StageStatistics>;
+        void Record(std::chrono::steady_clock::duration duration) {
+            _totalTime += std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+            _count++;
+        }
+        std::atomic<std::uint64_t>  _totalTime{0};  // nanoseconds
+        std::atomic<std::uint64_t>  _count{0};
+    };
+
     struct SubRequestDesc {
         InferenceEngine::ExecutableNetwork  _network;
         InferenceEngine::InferRequest::Ptr  _request;
         openvino::itt::handle_t             _profilingTask;
+        StageStatistics::Ptr                _statistics;
     };
     using SubRequestsList = std::vector<SubRequestDesc>;
 
@@ -25,6 +25,9 @@ Engine::Engine() {
     _pluginName = "HETERO";
     _config[KEY_EXCLUSIVE_ASYNC_REQUESTS] = YES;
     _config[HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)] = NO;
+    _config[HETERO_CONFIG_KEY(PARTITION_POLICY)] = HETERO_CONFIG_VALUE(FALLBACK_ORDER);
+    _config[HETERO_CONFIG_KEY(OP_COSTS)] = HETERO_CONFIG_VALUE(ESTIMATE);
+    _config[HETERO_CONFIG_KEY(MAX_SUBGRAPHS)] = "0";
 }
 
 namespace {
@@ -165,6 +168,9 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (METRIC_KEY(SUPPORTED_CONFIG_KEYS) == name) {
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, std::vector<std::string>{
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+            HETERO_CONFIG_KEY(PARTITION_POLICY),
+            HETERO_CONFIG_KEY(OP_COSTS),
+            HETERO_CONFIG_KEY(MAX_SUBGRAPHS),
             "TARGET_FALLBACK",
             CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)});
     } else if (METRIC_KEY(FULL_DEVICE_NAME) == name) {
@@ -207,6 +213,12 @@ Parameter Engine::GetConfig(const std::string& name, const std::map<std::string,
         IE_ASSERT(it != _config.end());
         bool dump = it->second == YES;
         return { dump };
+    } else if (name == HETERO_CONFIG_KEY(PARTITION_POLICY) ||
+               name == HETERO_CONFIG_KEY(OP_COSTS) ||
+               name == HETERO_CONFIG_KEY(MAX_SUBGRAPHS)) {
+        auto it = _config.find(name);
+        IE_ASSERT(it != _config.end());
+        return { it->second };
     } else if (name == "TARGET_FALLBACK") {
         auto it = _config.find("TARGET_FALLBACK");
         if (it == _config.end()) {
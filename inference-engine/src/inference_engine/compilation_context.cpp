@@ -4,6 +4,14 @@
 
 #include "compilation_context.hpp"
 
+#include <cstring>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 #include <sys/types.h>
 #include <sys/stat.h>
 
@@ -17,11 +25,16 @@
 #include "transformations/serialize.hpp"
 #include "cpp/ie_cnn_network.h"
 #include "details/ie_exception.hpp"
+#include "ie_parallel.hpp"
 
 #include "ngraph/variant.hpp"
 #include "ngraph/opsets/opset6.hpp"
+#include "ngraph/op/util/sub_graph_base.hpp"
+#include "ngraph/op/util/variable.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "transformations/rt_info/dequantization_attribute.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
+#include "transformations/rt_info/inference_precision_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
 #include "file_utils.h"
 
@@ -65,6 +78,312 @@ public:
 
 //////////////////////////////////////////////////
 
+namespace {
+
+// Constant buffers are hashed by chunks of fixed size, so the result does not depend on the number of threads
+constexpr std::size_t constantHashChunkSize = 1 << 20;
+
+inline uint64_t rotl64(uint64_t value, int shift) {
+    return (value << shift) | (value >> (64 - shift));
+}
+
+// 64-bit hash of a byte block. Four independent lanes keep several multiplications in flight
+// and allow the compiler to vectorize the main loop
+uint64_t hashBytes(const char* data, std::size_t size, uint64_t seed) {
+    constexpr uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+    constexpr uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+    uint64_t lanes[4] = {seed + prime1 + prime2, seed + prime2, seed, seed - prime1};
+    std::size_t i = 0;
+    for (; i + sizeof(lanes) <= size; i += sizeof(lanes)) {
+        uint64_t words[4];
+        std::memcpy(words, data + i, sizeof(words));
+        for (int lane = 0; lane < 4; ++lane) {
+            lanes[lane] = rotl64(lanes[lane] + words[lane] * prime2, 31) * prime1;
+        }
+    }
+    uint64_t result = rotl64(lanes[0], 1) + rotl64(lanes[1], 7) + rotl64(lanes[2], 12) + rotl64(lanes[3], 18);
+    for (; i < size; ++i) {
+        result = (result ^ static_cast<uint8_t>(data[i])) * prime1;
+    }
+    result ^= size;
+    result ^= result >> 33;
+    result *= prime2;
+    result ^= result >> 29;
+    return result;
+}
+
+uint64_t hashBuffer(const ngraph::runtime::AlignedBuffer& buffer) {
+    const auto data = static_cast<const char*>(buffer.get_ptr());
+    const auto size = buffer.size();
+    const auto chunks = (size + constantHashChunkSize - 1) / constantHashChunkSize;
+    if (chunks <= 1) {
+        return hashBytes(data, size, 0);
+    }
+    std::vector<uint64_t> chunkHashes(chunks);
+    parallel_for(chunks, [&](std::size_t chunk) {
+        const auto offset = chunk * constantHashChunkSize;
+        chunkHashes[chunk] = hashBytes(data + offset, std::min(constantHashChunkSize, size - offset), chunk);
+    });
+    return hashBytes(reinterpret_cast<const char*>(chunkHashes.data()), chunks * sizeof(uint64_t), size);
+}
+
+// Memoizes hashes of constant buffers, e.g. when the same network is loaded to several devices. Only buffers
+// owned by constants are memoized: their data is written only while the constant is constructed. Shared buffers
+// (e.g. over the weights blob of ReadNetwork) reference memory which can be changed by the user, so they are always
+// hashed again. Small buffers are cheaper to hash again than to track
+class ConstantHashCache final {
+    static constexpr std::size_t minCachedSize = 64 * 1024;
+
+    std::mutex m_mutex;
+    std::unordered_map<const ngraph::runtime::AlignedBuffer*,
+                       std::pair<std::weak_ptr<ngraph::runtime::AlignedBuffer>, uint64_t>> m_hashes;
+    std::size_t m_purgeSize = 1024;
+
+public:
+    uint64_t get(const std::shared_ptr<ngraph::runtime::AlignedBuffer>& buffer) {
+        if (buffer->size() < minCachedSize || typeid(*buffer) != typeid(ngraph::runtime::AlignedBuffer)) {
+            return hashBuffer(*buffer);
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_hashes.find(buffer.get());
+            if (it != m_hashes.end() && it->second.first.lock() == buffer) {
+                return it->second.second;
+            }
+        }
+        const auto hash = hashBuffer(*buffer);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_hashes.size() >= m_purgeSize) {
+            for (auto it = m_hashes.begin(); it != m_hashes.end();) {
+                it = it->second.first.expired() ? m_hashes.erase(it) : std::next(it);
+            }
+            m_purgeSize = std::max<std::size_t>(1024, m_hashes.size() * 2);
+        }
+        m_hashes[buffer.get()] = {buffer, hash};
+        return hash;
+    }
+
+    static ConstantHashCache& instance() {
+        static ConstantHashCache cache;
+        return cache;
+    }
+};
+
+bool hashFunction(const ngraph::Function& function, std::size_t& seed);
+
+// Hashes attributes of an operation. Attributes of unknown types make the hash unreliable, this is reported
+// by isSupported() and the caller falls back to serialization
+class HashAttributeVisitor final : public ngraph::AttributeVisitor {
+    std::size_t& m_seed;
+    bool m_supported = true;
+
+    template <typename T>
+    void hashValue(const std::string& name, const T& value) {
+        m_seed = hash_combine(m_seed, name);
+        m_seed = hash_combine(m_seed, value);
+    }
+
+    template <typename T>
+    void hashValues(const std::string& name, const std::vector<T>& values) {
+        m_seed = hash_combine(m_seed, name);
+        m_seed = hash_combine(m_seed, values.size());
+        for (const auto& value : values) {
+            m_seed = hash_combine(m_seed, value);
+        }
+    }
+
+public:
+    explicit HashAttributeVisitor(std::size_t& seed) : m_seed(seed) {}
+
+    bool isSupported() const {
+        return m_supported;
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        using namespace ngraph;
+        using SubGraphOp = op::util::SubGraphOp;
+        m_seed = hash_combine(m_seed, name);
+        if (auto a = as_type<AttributeAdapter<std::shared_ptr<runtime::AlignedBuffer>>>(&adapter)) {
+            const auto& buffer = a->get();
+            m_seed = hash_combine(m_seed, buffer ? ConstantHashCache::instance().get(buffer) : uint64_t{0});
+        } else if (auto a = as_type<AttributeAdapter<std::shared_ptr<Variable>>>(&adapter)) {
+            m_seed = hash_combine(m_seed, a->get()->get_info().variable_id);
+        } else if (auto a = as_type<AttributeAdapter<std::vector<std::shared_ptr<SubGraphOp::InputDescription>>>>(&adapter)) {
+            for (const auto& description : a->get()) {
+                m_seed = hash_combine(m_seed, std::string(description->get_type_info().name));
+                m_seed = hash_combine(m_seed, description->m_input_index);
+                m_seed = hash_combine(m_seed, description->m_body_parameter_index);
+                if (auto slice = as_type_ptr<SubGraphOp::SliceInputDescription>(description)) {
+                    for (auto value : {slice->m_start, slice->m_stride, slice->m_part_size, slice->m_end, slice->m_axis}) {
+                        m_seed = hash_combine(m_seed, value);
+                    }
+                } else if (auto merged = as_type_ptr<SubGraphOp::MergedInputDescription>(description)) {
+                    m_seed = hash_combine(m_seed, merged->m_body_value_index);
+                }
+            }
+        } else if (auto a = as_type<AttributeAdapter<std::vector<std::shared_ptr<SubGraphOp::OutputDescription>>>>(&adapter)) {
+            for (const auto& description : a->get()) {
+                m_seed = hash_combine(m_seed, std::string(description->get_type_info().name));
+                m_seed = hash_combine(m_seed, description->m_body_value_index);
+                m_seed = hash_combine(m_seed, description->m_output_index);
+                if (auto concat = as_type_ptr<SubGraphOp::ConcatOutputDescription>(description)) {
+                    for (auto value : {concat->m_start, concat->m_stride, concat->m_part_size, concat->m_end, concat->m_axis}) {
+                        m_seed = hash_combine(m_seed, value);
+                    }
+                } else if (auto body = as_type_ptr<SubGraphOp::BodyOutputDescription>(description)) {
+                    m_seed = hash_combine(m_seed, body->m_iteration);
+                }
+            }
+        } else if (auto a = as_type<AttributeAdapter<op::v5::Loop::SpecialBodyPorts>>(&adapter)) {
+            m_seed = hash_combine(m_seed, a->get().current_iteration_input_idx);
+            m_seed = hash_combine(m_seed, a->get().body_condition_output_idx);
+        } else {
+            m_supported = false;
+        }
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int8_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int16_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int32_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint8_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint16_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint32_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint64_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<float>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int8_t>>& adapter) override {
+        hashValues(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int16_t>>& adapter) override {
+        hashValues(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        hashValues(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        hashValues(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        hashValues(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint16_t>>& adapter) override {
+        hashValues(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint32_t>>& adapter) override {
+        hashValues(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        hashValues(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        hashValues(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<double>>& adapter) override {
+        hashValues(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        hashValues(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::shared_ptr<ngraph::Function>>& adapter) override {
+        m_seed = hash_combine(m_seed, name);
+        m_supported = hashFunction(*adapter.get(), m_seed) && m_supported;
+    }
+};
+
+// Hashes operations in topological order: type, name, producers of inputs, outputs and attributes.
+// Nodes are referenced by their position in this order, so the hash does not depend on addresses
+bool hashFunction(const ngraph::Function& function, std::size_t& seed) {
+    std::unordered_map<const ngraph::Node*, std::size_t> nodeIds;
+    auto nodeId = [&](const ngraph::Node* node) {
+        auto it = nodeIds.find(node);
+        return it != nodeIds.end() ? it->second : nodeIds.size();
+    };
+    for (const auto& op : function.get_ordered_ops()) {
+        nodeIds.emplace(op.get(), nodeIds.size());
+        const auto& typeInfo = op->get_type_info();
+        seed = hash_combine(seed, std::string(typeInfo.name));
+        seed = hash_combine(seed, typeInfo.version);
+        seed = hash_combine(seed, op->get_friendly_name());
+        for (const auto& input : op->inputs()) {
+            const auto source = input.get_source_output();
+            seed = hash_combine(seed, nodeId(source.get_node()));
+            seed = hash_combine(seed, source.get_index());
+        }
+        for (const auto& output : op->outputs()) {
+            std::stringstream shape;
+            shape << output.get_partial_shape();
+            seed = hash_combine(seed, output.get_element_type().get_type_name());
+            seed = hash_combine(seed, shape.str());
+            const auto& names = output.get_tensor().get_names();
+            for (const auto& name : std::set<std::string>(names.begin(), names.end())) {
+                seed = hash_combine(seed, name);
+            }
+        }
+        HashAttributeVisitor visitor(seed);
+        if (!op->visit_attributes(visitor) || !visitor.isSupported()) {
+            return false;
+        }
+    }
+    for (const auto& parameter : function.get_parameters()) {
+        seed = hash_combine(seed, nodeId(parameter.get()));
+    }
+    for (const auto& result : function.get_results()) {
+        seed = hash_combine(seed, nodeId(result.get()));
+    }
+    for (const auto& sink : function.get_sinks()) {
+        seed = hash_combine(seed, nodeId(sink.get()));
+    }
+    return true;
+}
+
+std::size_t computeSerializedHash(const CNNNetwork& network) {
+    OstreamHashWrapper xmlHash;
+    OstreamHashWrapper binHash;
+    std::ostream xml(&xmlHash);
+    std::ostream bin(&binHash);
+
+    CNNNetwork net(network);
+    ngraph::pass::Serialize serializer(xml, bin,
+        ngraph::pass::Serialize::Version::IR_V10);
+    serializer.run_on_function(net.getFunction());
+
+    size_t seed {};
+    seed = hash_combine(seed, xmlHash.getResult());
+    seed = hash_combine(seed, binHash.getResult());
+    return seed;
+}
+
+}  // namespace
+
+//////////////////////////////////////////////////
+
 std::string NetworkCompilationContext::calculateFileInfo(const std::string& filePath) {
     size_t seed {};
     auto absPath = filePath;
@@ -88,23 +407,16 @@ std::string NetworkCompilationContext::calculateFileInfo(const std::string& file
 std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
                                const std::map<std::string, std::string>& compileOptions) {
     OV_ITT_SCOPED_TASK(itt::domains::IE_LT, "NetworkCompilationContext::computeHash - CNN");
-    OstreamHashWrapper xmlHash;
-    OstreamHashWrapper binHash;
-    std::ostream xml(&xmlHash);
-    std::ostream bin(&binHash);
-
     IE_ASSERT(network.getFunction());
 
-    // 1. Serialize
-    CNNNetwork net(network);
-    ngraph::pass::Serialize serializer(xml, bin,
-        ngraph::pass::Serialize::Version::IR_V10);
-    serializer.run_on_function(net.getFunction());
-
-    // 2. Compute hash on serialized data and options
+    // 1. Hash topology, attributes and constants directly, operations with attributes of unknown types
+    // are hashed via serialization
     size_t seed {};
-    seed = hash_combine(seed, xmlHash.getResult());
-    seed = hash_combine(seed, binHash.getResult());
+    if (!hashFunction(*network.getFunction(), seed)) {
+        seed = computeSerializedHash(network);
+    }
+
+    // 2. Add options
 
     for (const auto& kvp : compileOptions) {
         seed = hash_combine(seed, kvp.first + kvp.second);
@@ -126,6 +438,8 @@ std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
                 seed = hash_combine(seed, fNames->get().getNames());
             } else if (auto prim = std::dynamic_pointer_cast<ngraph::VariantWrapper<ngraph::PrimitivesPriority>>(rtMapData.second)) {
                 seed = hash_combine(seed, prim->get().getPrimitivesPriority());
+            } else if (auto precision = std::dynamic_pointer_cast<ngraph::VariantWrapper<ngraph::InferencePrecision>>(rtMapData.second)) {
+                seed = hash_combine(seed, precision->get().getInferencePrecision());
             }
         }
     }
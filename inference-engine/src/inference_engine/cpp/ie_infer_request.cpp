@@ -0,0 +1,31 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+
+#include "cpp/ie_infer_request.hpp"
+#include "cpp_interfaces/base/ie_infer_async_request_base.hpp"
+
+namespace InferenceEngine {
+namespace details {
+
+static std::shared_ptr<IAsyncInferRequestInternal> getRequestImpl(const IInferRequest::Ptr& request) {
+    auto requestBase = std::dynamic_pointer_cast<InferRequestBase>(request);
+    if (requestBase == nullptr)
+        IE_THROW(NotImplemented) << "Variable state sessions are not supported by the infer request";
+    auto impl = requestBase->GetImpl();
+    IE_ASSERT(impl != nullptr);
+    return impl;
+}
+
+void SetStateSession(const IInferRequest::Ptr& request, size_t sessionId) {
+    getRequestImpl(request)->SetStateSession(sessionId);
+}
+
+void ReleaseStateSession(const IInferRequest::Ptr& request, size_t sessionId) {
+    getRequestImpl(request)->ReleaseStateSession(sessionId);
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
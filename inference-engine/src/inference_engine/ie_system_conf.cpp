@@ -9,6 +9,10 @@
 #include <iostream>
 #include <vector>
 
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
 # define XBYAK_NO_OP_NAMES
 # define XBYAK_UNDEF_JNL
 # include <xbyak/xbyak_util.h>
@@ -96,6 +100,71 @@ std::vector<int> getAvailableNUMANodes() { return {0}; }
 #endif
 #endif
 
+#if !defined(__linux__)
+// for Linux the topology is read from sysfs (see lin_system_conf.cpp), other OSes do not report it yet
+CPUTopology readCPUTopology(const std::string&) { return {}; }
+#endif
+
+#if defined(__linux__) && (defined(__x86_64__) || defined(__i386__) || defined(_M_X64))
+// Fallback for kernels that do not expose hybrid PMUs: queries CPUID hybrid leaf 0x1A on each processor
+static void detectCoreTypesByCPUID(CPUTopology& topology) {
+    unsigned int regs[4] = {};
+    Xbyak::util::Cpu::getCpuidEx(0, 0, regs);
+    const unsigned int maxLeaf = regs[0];
+    Xbyak::util::Cpu::getCpuidEx(7, 0, regs);
+    const bool isHybrid = (regs[3] >> 15) & 1;
+    if (!isHybrid || maxLeaf < 0x1A)
+        return;
+
+    cpu_set_t original;
+    CPU_ZERO(&original);
+    if (sched_getaffinity(0, sizeof(original), &original) != 0)
+        return;
+    for (auto&& processor : topology.processors) {
+        cpu_set_t mask;
+        CPU_ZERO(&mask);
+        CPU_SET(processor.id, &mask);
+        if (sched_setaffinity(0, sizeof(mask), &mask) != 0)
+            continue;
+        Xbyak::util::Cpu::getCpuidEx(0x1A, 0, regs);
+        constexpr unsigned int intelAtom = 0x20;
+        if ((regs[0] >> 24) == intelAtom)
+            processor.type = CPUCoreType::EFFICIENT;
+    }
+    sched_setaffinity(0, sizeof(original), &original);
+}
+#endif
+
+CPUTopology getCPUTopology() {
+    // processors and their core types are read once, while the affinity of the process may change, so it is applied on each call
+    static const CPUTopology systemTopology = [] {
+        CPUTopology result;
+#if defined(__linux__)
+        result = readCPUTopology("/sys");
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+        if (!result.isHybrid())
+            detectCoreTypesByCPUID(result);
+#endif
+#endif
+        return result;
+    }();
+
+    CPUTopology topology = systemTopology;
+#if defined(__linux__)
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    if (sched_getaffinity(0, sizeof(mask), &mask) == 0) {
+        std::vector<CPUProcessor> available;
+        for (auto&& processor : topology.processors) {
+            if (CPU_ISSET(processor.id, &mask))
+                available.push_back(processor);
+        }
+        topology.processors = available;
+    }
+#endif
+    return topology;
+}
+
 #if ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
 std::vector<int> getAvailableNUMANodes() {
 #if TBB_INTERFACE_VERSION >= 11100
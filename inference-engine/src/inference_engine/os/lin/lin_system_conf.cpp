@@ -2,8 +2,11 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <fstream>
 #include <map>
+#include <set>
+#include <sstream>
 #include <string>
 #include <vector>
 #include <iostream>
@@ -61,7 +64,91 @@ std::vector<int> getAvailableNUMANodes() {
     return nodes;
 }
 #endif
+namespace {
+// Parses list of processors in sysfs format, e.g. "0-3,8,10-11". Returns empty vector for invalid list
+std::vector<int> parseProcessorsList(const std::string& list) {
+    std::vector<int> processors;
+    std::stringstream stream(list);
+    std::string range;
+    while (std::getline(stream, range, ',')) {
+        int first = 0, last = 0;
+        char dash = 0;
+        std::stringstream rangeStream(range);
+        if (!(rangeStream >> first)) {
+            return {};
+        }
+        last = first;
+        if ((rangeStream >> dash) && !(dash == '-' && (rangeStream >> last))) {
+            return {};
+        }
+        for (int processor = first; processor <= last; processor++) {
+            processors.push_back(processor);
+        }
+    }
+    return processors;
+}
+
+std::string readFirstLine(const std::string& path) {
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    return line;
+}
+}  // namespace
+
+CPUTopology readCPUTopology(const std::string& sysfsRoot) {
+    CPUTopology topology;
+    const std::string cpuDir = sysfsRoot + "/devices/system/cpu/";
+    for (auto&& id : parseProcessorsList(readFirstLine(cpuDir + "online"))) {
+        CPUProcessor processor;
+        processor.id = id;
+        const auto siblings = parseProcessorsList(readFirstLine(cpuDir + "cpu" + std::to_string(id) + "/topology/thread_siblings_list"));
+        processor.coreId = siblings.empty() ? id : *std::min_element(siblings.begin(), siblings.end());
+        topology.processors.push_back(processor);
+    }
+
+    // Hybrid Intel CPUs register separate PMU for efficient (Atom) cores
+    const auto efficientProcessors = parseProcessorsList(readFirstLine(sysfsRoot + "/devices/cpu_atom/cpus"));
+    if (!efficientProcessors.empty()) {
+        for (auto&& processor : topology.processors) {
+            if (std::find(efficientProcessors.begin(), efficientProcessors.end(), processor.id) != efficientProcessors.end()) {
+                processor.type = CPUCoreType::EFFICIENT;
+            }
+        }
+        return topology;
+    }
+
+    // Heterogeneous ARM CPUs report relative core performance as a capacity
+    std::vector<int> capacities;
+    for (auto&& processor : topology.processors) {
+        std::stringstream capacity(readFirstLine(cpuDir + "cpu" + std::to_string(processor.id) + "/cpu_capacity"));
+        int value = 0;
+        if (!(capacity >> value)) {
+            return topology;
+        }
+        capacities.push_back(value);
+    }
+    if (!capacities.empty()) {
+        const int maxCapacity = *std::max_element(capacities.begin(), capacities.end());
+        for (size_t i = 0; i < topology.processors.size(); i++) {
+            if (capacities[i] < maxCapacity) {
+                topology.processors[i].type = CPUCoreType::EFFICIENT;
+            }
+        }
+    }
+    return topology;
+}
+
 int getNumberOfCPUCores() {
+    const auto topology = getCPUTopology();
+    if (!topology.processors.empty()) {
+        std::set<int> cores;
+        for (auto&& processor : topology.processors) {
+            cores.insert(processor.coreId);
+        }
+        return static_cast<int>(cores.size());
+    }
+
     unsigned numberOfProcessors = cpu._processors;
     unsigned totalNumberOfCpuCores = cpu._cores;
     IE_ASSERT(totalNumberOfCpuCores != 0);
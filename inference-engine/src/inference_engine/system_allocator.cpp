@@ -4,8 +4,94 @@
 
 #include "system_allocator.hpp"
 
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#include "threading/ie_thread_affinity.hpp"
+
 namespace InferenceEngine {
 
+/**
+ * Memory pages are not backed until the first write, so writing a byte per page from a thread
+ * pinned to the NUMA node places the whole buffer on this node. The thread is started once per node
+ * and lives while allocators of the node exist.
+ */
+class NUMAMemoryAllocator::FirstTouchWorker {
+public:
+    explicit FirstTouchWorker(int numaNodeId) : _thread([this, numaNodeId] { run(numaNodeId); }) {}
+
+    ~FirstTouchWorker() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _condVar.notify_all();
+        _thread.join();
+    }
+
+    void touch(void* data, size_t size) {
+        std::lock_guard<std::mutex> callLock(_callMutex);
+        std::unique_lock<std::mutex> lock(_mutex);
+        _data = static_cast<volatile char*>(data);
+        _size = size;
+        _condVar.notify_all();
+        _condVar.wait(lock, [this] { return _data == nullptr; });
+    }
+
+    static std::shared_ptr<FirstTouchWorker> get(int numaNodeId) {
+        static std::mutex mutex;
+        static std::map<int, std::weak_ptr<FirstTouchWorker>> workers;
+        std::lock_guard<std::mutex> lock(mutex);
+        auto worker = workers[numaNodeId].lock();
+        if (!worker) {
+            worker = std::make_shared<FirstTouchWorker>(numaNodeId);
+            workers[numaNodeId] = worker;
+        }
+        return worker;
+    }
+
+private:
+    void run(int numaNodeId) {
+        PinCurrentThreadToSocket(numaNodeId);
+        constexpr size_t pageSize = 4096;
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (true) {
+            _condVar.wait(lock, [this] { return _stop || _data != nullptr; });
+            if (_stop)
+                return;
+            for (size_t offset = 0; offset < _size; offset += pageSize)
+                _data[offset] = 0;
+            _data = nullptr;
+            _condVar.notify_all();
+        }
+    }
+
+    std::mutex _callMutex;
+    std::mutex _mutex;
+    std::condition_variable _condVar;
+    volatile char* _data = nullptr;
+    size_t _size = 0;
+    bool _stop = false;
+    std::thread _thread;
+};
+
+NUMAMemoryAllocator::NUMAMemoryAllocator(int numaNodeId) : _worker(FirstTouchWorker::get(numaNodeId)) {}
+
+void* NUMAMemoryAllocator::alloc(size_t size) noexcept {
+    auto handle = SystemMemoryAllocator::alloc(size);
+    if (handle == nullptr)
+        return nullptr;
+
+    try {
+        _worker->touch(handle, size);
+    } catch (...) {
+        // memory is still valid, the pages are placed by the operating system on the first access
+    }
+    return handle;
+}
+
 INFERENCE_ENGINE_API_CPP(std::shared_ptr<IAllocator>) CreateDefaultAllocator() noexcept {
     try {
         return std::make_shared<SystemMemoryAllocator>();
@@ -14,4 +100,12 @@ INFERENCE_ENGINE_API_CPP(std::shared_ptr<IAllocator>) CreateDefaultAllocator() n
     }
 }
 
+INFERENCE_ENGINE_API_CPP(std::shared_ptr<IAllocator>) CreateNUMAAllocator(int numaNodeId) noexcept {
+    try {
+        return std::make_shared<NUMAMemoryAllocator>(numaNodeId);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
 }  // namespace InferenceEngine
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <iostream>
+#include <memory>
 
 #include "ie_allocator.hpp"
 
@@ -35,4 +36,16 @@ public:
     }
 };
 
+class NUMAMemoryAllocator : public SystemMemoryAllocator {
+public:
+    explicit NUMAMemoryAllocator(int numaNodeId);
+
+    void* alloc(size_t size) noexcept override;
+
+private:
+    class FirstTouchWorker;
+    // pinned thread shared by all allocators of the NUMA node
+    std::shared_ptr<FirstTouchWorker> _worker;
+};
+
 }  // namespace InferenceEngine
\ No newline at end of file
@@ -32,6 +32,8 @@ struct CPUStreamsExecutor::Impl {
             int     _ncpus                  = 0;
             int     _threadBindingStep      = 0;
             int     _offset                 = 0;
+            std::vector<int> _processors;
+            bool    _bindToProcessor        = false;
             Observer(tbb::task_arena&    arena,
                      CpuSet              mask,
                      int                 ncpus,
@@ -45,8 +47,26 @@ struct CPUStreamsExecutor::Impl {
                 _threadBindingStep(threadBindingStep),
                 _offset{streamId * threadsPerStream  + threadBindingOffset} {
             }
+            Observer(tbb::task_arena&    arena,
+                     CpuSet              mask,
+                     int                 ncpus,
+                     std::vector<int>    processors,
+                     bool                bindToProcessor) :
+                tbb::task_scheduler_observer(arena),
+                _mask{std::move(mask)},
+                _ncpus(ncpus),
+                _processors{std::move(processors)},
+                _bindToProcessor{bindToProcessor} {
+            }
             void on_scheduler_entry(bool) override {
-                PinThreadToVacantCore(_offset + tbb::this_task_arena::current_thread_index(), _threadBindingStep, _ncpus, _mask);
+                if (_processors.empty()) {
+                    PinThreadToVacantCore(_offset + tbb::this_task_arena::current_thread_index(), _threadBindingStep, _ncpus, _mask);
+                } else if (_bindToProcessor) {
+                    const auto threadIndex = static_cast<std::size_t>(tbb::this_task_arena::current_thread_index());
+                    PinCurrentThreadToProcessors({_processors[threadIndex % _processors.size()]});
+                } else {
+                    PinCurrentThreadToProcessors(_processors);
+                }
             }
             void on_scheduler_exit(bool) override {
                 PinCurrentThreadByMask(_ncpus, _mask);
@@ -70,6 +90,11 @@ struct CPUStreamsExecutor::Impl {
                     (_streamId % _impl->_config._streams)/
                     ((_impl->_config._streams + _impl->_usedNumaNodes.size() - 1)/_impl->_usedNumaNodes.size()))
                 : _impl->_usedNumaNodes.at(_streamId % _impl->_usedNumaNodes.size());
+            // processors assigned to the stream according to core types on hybrid CPUs
+            const auto& streamsProcessors = _impl->_config._streamsProcessors;
+            const auto processors = streamsProcessors.empty()
+                ? std::vector<int>{} : streamsProcessors[_streamId % streamsProcessors.size()];
+            const bool bindToProcessor = ThreadBindingType::CORES == _impl->_config._threadBindingType;
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
             auto concurrency = (0 == _impl->_config._threadsPerStream) ? tbb::task_arena::automatic : _impl->_config._threadsPerStream;
             if (ThreadBindingType::NUMA == _impl->_config._threadBindingType) {
@@ -78,6 +103,15 @@ struct CPUStreamsExecutor::Impl {
 #else
                 _taskArena.reset(new tbb::task_arena{concurrency});
 #endif
+            } else if (!processors.empty()) {
+                _taskArena.reset(new tbb::task_arena{concurrency});
+                CpuSet processMask;
+                int    ncpus = 0;
+                std::tie(processMask, ncpus) = GetProcessMask();
+                if (nullptr != processMask) {
+                    _observer.reset(new Observer{*_taskArena, std::move(processMask), ncpus, processors, bindToProcessor});
+                    _observer->observe(true);
+                }
             } else if ((0 != _impl->_config._threadsPerStream) || (ThreadBindingType::CORES == _impl->_config._threadBindingType)) {
                 _taskArena.reset(new tbb::task_arena{concurrency});
                 if (ThreadBindingType::CORES == _impl->_config._threadBindingType) {
@@ -98,7 +132,15 @@ struct CPUStreamsExecutor::Impl {
             }
 #elif IE_THREAD == IE_THREAD_OMP
             omp_set_num_threads(_impl->_config._threadsPerStream);
-            if (!checkOpenMpEnvVars(false) && (ThreadBindingType::NONE != _impl->_config._threadBindingType)) {
+            if (!checkOpenMpEnvVars(false) && !processors.empty()) {
+                parallel_nt(_impl->_config._threadsPerStream, [&] (int threadIndex, int threadsPerStream) {
+                    if (bindToProcessor) {
+                        PinCurrentThreadToProcessors({processors[threadIndex % processors.size()]});
+                    } else {
+                        PinCurrentThreadToProcessors(processors);
+                    }
+                });
+            } else if (!checkOpenMpEnvVars(false) && (ThreadBindingType::NONE != _impl->_config._threadBindingType)) {
                 CpuSet processMask;
                 int    ncpus = 0;
                 std::tie(processMask, ncpus) = GetProcessMask();
@@ -110,7 +152,9 @@ struct CPUStreamsExecutor::Impl {
                 }
             }
 #elif IE_THREAD == IE_THREAD_SEQ
-            if (ThreadBindingType::NUMA == _impl->_config._threadBindingType) {
+            if (!processors.empty()) {
+                PinCurrentThreadToProcessors(bindToProcessor ? std::vector<int>{processors.front()} : processors);
+            } else if (ThreadBindingType::NUMA == _impl->_config._threadBindingType) {
                 PinCurrentThreadToSocket(_numaNodeId);
             } else if (ThreadBindingType::CORES == _impl->_config._threadBindingType) {
                 CpuSet processMask;
@@ -35,7 +35,9 @@ IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStre
             executorConfig._threadsPerStream == config._threadsPerStream &&
             executorConfig._threadBindingType == config._threadBindingType &&
             executorConfig._threadBindingStep == config._threadBindingStep &&
-            executorConfig._threadBindingOffset == config._threadBindingOffset)
+            executorConfig._threadBindingOffset == config._threadBindingOffset &&
+            executorConfig._coresPlacement == config._coresPlacement &&
+            executorConfig._streamsProcessors == config._streamsProcessors)
             return executor;
     }
     auto newExec = std::make_shared<CPUStreamsExecutor>(config);
@@ -10,6 +10,7 @@
 #include "ie_parameter.hpp"
 #include <string>
 #include <algorithm>
+#include <set>
 #include <vector>
 #include <thread>
 
@@ -22,6 +23,7 @@ std::vector<std::string> IStreamsExecutor::Config::SupportedKeys() {
         CONFIG_KEY(CPU_THROUGHPUT_STREAMS),
         CONFIG_KEY(CPU_BIND_THREAD),
         CONFIG_KEY(CPU_THREADS_NUM),
+        CONFIG_KEY(CPU_CORES_PLACEMENT),
         CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM),
     };
 }
@@ -92,6 +94,17 @@ void IStreamsExecutor::Config::SetConfig(const std::string& key, const std::stri
                                    << ". Expected only positive numbers (#threads)";
             }
             _threads = val_i;
+        } else if (key == CONFIG_KEY(CPU_CORES_PLACEMENT)) {
+            if (value == CONFIG_VALUE(CPU_CORES_ANY)) {
+                _coresPlacement = IStreamsExecutor::CoresPlacement::ANY;
+            } else if (value == CONFIG_VALUE(CPU_CORES_PERFORMANCE)) {
+                _coresPlacement = IStreamsExecutor::CoresPlacement::PERFORMANCE;
+            } else if (value == CONFIG_VALUE(CPU_CORES_HYBRID_AWARE)) {
+                _coresPlacement = IStreamsExecutor::CoresPlacement::HYBRID_AWARE;
+            } else {
+                IE_THROW() << "Wrong value for property key " << CONFIG_KEY(CPU_CORES_PLACEMENT)
+                                   << ". Expected only CPU_CORES_ANY/CPU_CORES_PERFORMANCE/CPU_CORES_HYBRID_AWARE";
+            }
         } else if (key == CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM)) {
             int val_i;
             try {
@@ -127,6 +140,18 @@ Parameter IStreamsExecutor::Config::GetConfig(const std::string& key) {
         return {_streams};
     } else if (key == CONFIG_KEY(CPU_THREADS_NUM)) {
         return {_threads};
+    } else if (key == CONFIG_KEY(CPU_CORES_PLACEMENT)) {
+        switch (_coresPlacement) {
+            case IStreamsExecutor::CoresPlacement::ANY:
+                return {CONFIG_VALUE(CPU_CORES_ANY)};
+            break;
+            case IStreamsExecutor::CoresPlacement::PERFORMANCE:
+                return {CONFIG_VALUE(CPU_CORES_PERFORMANCE)};
+            break;
+            case IStreamsExecutor::CoresPlacement::HYBRID_AWARE:
+                return {CONFIG_VALUE(CPU_CORES_HYBRID_AWARE)};
+            break;
+        }
     } else if (key == CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM)) {
         return {_threadsPerStream};
     } else {
@@ -136,6 +161,12 @@ Parameter IStreamsExecutor::Config::GetConfig(const std::string& key) {
 }
 
 IStreamsExecutor::Config IStreamsExecutor::Config::MakeDefaultMultiThreaded(const IStreamsExecutor::Config& initial) {
+    return MakeDefaultMultiThreaded(initial, getCPUTopology());
+}
+
+namespace {
+// Default configuration which does not take core types into account
+IStreamsExecutor::Config MakeHomogeneousMultiThreaded(const IStreamsExecutor::Config& initial) {
     const auto envThreads = parallel_get_env_threads();
     const auto& numaNodes = getAvailableNUMANodes();
     const auto numaNodesNum = numaNodes.size();
@@ -148,4 +179,70 @@ IStreamsExecutor::Config IStreamsExecutor::Config::MakeDefaultMultiThreaded(cons
     return streamExecutorConfig;
 }
 
+// Logical processors of the cores of given type: first processors of all physical cores go first, then hyper-threads
+std::vector<int> GetProcessorsPool(const CPUTopology& topology, CPUCoreType type, int& physicalCores) {
+    std::vector<int> pool, siblings;
+    std::set<int> cores;
+    for (auto&& processor : topology.processors) {
+        if (processor.type != type)
+            continue;
+        if (cores.insert(processor.coreId).second) {
+            pool.push_back(processor.id);
+        } else {
+            siblings.push_back(processor.id);
+        }
+    }
+    physicalCores = static_cast<int>(pool.size());
+    pool.insert(pool.end(), siblings.begin(), siblings.end());
+    return pool;
+}
+}  // namespace
+
+IStreamsExecutor::Config IStreamsExecutor::Config::MakeDefaultMultiThreaded(const IStreamsExecutor::Config& initial,
+                                                                            const CPUTopology& topology) {
+    auto streamExecutorConfig = initial;
+    streamExecutorConfig._streamsProcessors.clear();
+    if (CoresPlacement::ANY == streamExecutorConfig._coresPlacement ||
+        ThreadBindingType::NUMA == streamExecutorConfig._threadBindingType ||
+        !topology.isHybrid()) {
+        return MakeHomogeneousMultiThreaded(streamExecutorConfig);
+    }
+
+    // latency stream is placed on performance cores only, throughput streams are placed on all cores if requested
+    const bool isLatency = streamExecutorConfig._streams <= 1;
+    const bool useEfficientCores = !isLatency && CoresPlacement::HYBRID_AWARE == streamExecutorConfig._coresPlacement;
+    std::vector<std::vector<int>> pools;
+    int performanceCores = 0, efficientCores = 0;
+    pools.push_back(GetProcessorsPool(topology, CPUCoreType::PERFORMANCE, performanceCores));
+    int logicalProcessors = static_cast<int>(pools.back().size());
+    if (useEfficientCores) {
+        pools.push_back(GetProcessorsPool(topology, CPUCoreType::EFFICIENT, efficientCores));
+        logicalProcessors += static_cast<int>(pools.back().size());
+    }
+
+    const auto envThreads = parallel_get_env_threads();
+    const auto hwCores = isLatency ? performanceCores : logicalProcessors;
+    const auto threads = streamExecutorConfig._threads ? streamExecutorConfig._threads : (envThreads ? envThreads : hwCores);
+    const auto streams = std::max(1, streamExecutorConfig._streams);
+    streamExecutorConfig._threadsPerStream = std::max(1, threads / streams);
+
+    // streams are not split between cores of different types, so the stream that does not fit the rest of the pool
+    // is placed to the next pool, streams are placed from the beginning again if all pools are exhausted
+    const auto threadsPerStream = static_cast<std::size_t>(streamExecutorConfig._threadsPerStream);
+    std::size_t pool = 0, offset = 0;
+    for (int stream = 0; stream < streams; ++stream) {
+        if (offset + threadsPerStream > pools[pool].size()) {
+            do {
+                pool = (pool + 1) % pools.size();
+            } while (pool != 0 && threadsPerStream > pools[pool].size());
+            offset = 0;
+        }
+        const auto first = pools[pool].begin() + offset;
+        const auto last = pools[pool].begin() + std::min(offset + threadsPerStream, pools[pool].size());
+        streamExecutorConfig._streamsProcessors.emplace_back(first, last);
+        offset += threadsPerStream;
+    }
+    return streamExecutorConfig;
+}
+
 }  //  namespace InferenceEngine
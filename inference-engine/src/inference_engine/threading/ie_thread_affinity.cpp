@@ -8,6 +8,7 @@
 #include <cerrno>
 #include <utility>
 #include <tuple>
+#include <vector>
 
 
 #if !(defined(__APPLE__) || defined(_WIN32))
@@ -71,6 +72,28 @@ bool PinThreadToVacantCore(int thrIdx, int hyperthreads, int ncores, const CpuSe
     return res;
 }
 
+bool PinCurrentThreadToProcessors(const std::vector<int>& processors) {
+    int ncpus = 0;
+    CpuSet mask;
+    std::tie(mask, ncpus) = GetProcessMask();
+    if (nullptr == mask)
+        return false;
+    CpuSet targetMask{CPU_ALLOC(ncpus)};
+    const size_t size = CPU_ALLOC_SIZE(ncpus);
+    CPU_ZERO_S(size, targetMask.get());
+    for (auto&& processor : processors) {
+        if (processor >= 0 && processor < ncpus)
+            CPU_SET_S(processor, size, targetMask.get());
+    }
+    // respect the user-defined mask for the entire process
+    CPU_AND_S(size, targetMask.get(), targetMask.get(), mask.get());
+    bool res = false;
+    if (CPU_COUNT_S(size, targetMask.get())) {  //  if we have non-zero mask to set
+        res = PinCurrentThreadByMask(ncpus, targetMask);
+    }
+    return res;
+}
+
 bool PinCurrentThreadToSocket(int socket) {
     const int sockets = InferenceEngine::getAvailableNUMANodes().size();
     const int cores = InferenceEngine::getNumberOfCPUCores();
@@ -106,6 +129,9 @@ bool PinThreadToVacantCore(int thrIdx, int hyperthreads, int ncores, const CpuSe
 bool PinCurrentThreadByMask(int ncores, const CpuSet& procMask) {
     return false;
 }
+bool PinCurrentThreadToProcessors(const std::vector<int>& processors) {
+    return false;
+}
 bool PinCurrentThreadToSocket(int socket) {
     return false;
 }
@@ -48,6 +48,7 @@
 #include <ngraph/opsets/opset5.hpp>
 #include "transformations/utils/utils.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
+#include "transformations/rt_info/inference_precision_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
 #include "cpp/ie_cnn_network.h"
 
@@ -1812,8 +1813,11 @@ void convertFunctionToICNNNetwork(const std::shared_ptr<const ::ngraph::Function
     const auto isInternalConstLayer = [](const std::shared_ptr<::ngraph::op::Constant> &constLayer,
                                          const std::shared_ptr<::ngraph::Node> &consumerLayer,
                                          bool keep_constants) -> bool {
+        // FullyConnected with non-constant weights (e.g. weights decompression subgraph) keeps its bias as an input
+        const bool isFullyConnectedWithConstWeights = ::ngraph::as_type_ptr<::ngraph::op::FullyConnected>(consumerLayer) &&
+                                                      ::ngraph::is_type<::ngraph::op::Constant>(consumerLayer->get_input_node_ptr(1));
         if (((::ngraph::as_type_ptr<::ngraph::op::ConvolutionIE>(consumerLayer) ||
-            ::ngraph::as_type_ptr<::ngraph::op::FullyConnected>(consumerLayer)) && !keep_constants) ||
+            isFullyConnectedWithConstWeights) && !keep_constants) ||
             ::ngraph::as_type_ptr<::ngraph::op::v1::BinaryConvolution>(consumerLayer) ||
             ::ngraph::as_type_ptr<::ngraph::op::DeconvolutionIE>(consumerLayer) ||
             ::ngraph::as_type_ptr<::ngraph::op::v1::DeformableConvolution>(consumerLayer) ||
@@ -1993,6 +1997,11 @@ void convertFunctionToICNNNetwork(const std::shared_ptr<const ::ngraph::Function
             cnnLayer->params["PrimitivesPriority"] = primitivesPriority;
         }
 
+        std::string inferencePrecision = ::ngraph::getInferencePrecision(layer);
+        if (!inferencePrecision.empty()) {
+            cnnLayer->params["InferencePrecision"] = inferencePrecision;
+        }
+
         // Copy runtime info attributes from Nodes to CNNLayers if they have VariantWrapper<std::string> type
         using VariantString = ::ngraph::VariantWrapper<std::string>;
         for (const auto &rt : rt_info) {
@@ -21,6 +21,38 @@
 NGRAPH_RTTI_DEFINITION(ngraph::pass::ConvertMatMulToFCorGemm, "ConvertMatMulToFCorGemm", 0);
 NGRAPH_RTTI_DEFINITION(ngraph::pass::ConvertMatMulToFC, "ConvertMatMulToFC", 0);
 
+namespace {
+// Checks that weights are produced by decompression subgraph marked as dequantization:
+// Constant(u8/i8) -> Convert -> [Subtract|Add(Constant)] -> Multiply(Constant).
+// Such weights are kept compressed, so plugin can decide how to execute FullyConnected on them.
+bool is_decompressed_weights(const ngraph::Output<ngraph::Node>& weights) {
+    using namespace ngraph;
+    auto get_data_input = [](const std::shared_ptr<Node>& node) -> std::shared_ptr<Node> {
+        if (is_type<opset1::Constant>(node->get_input_node_ptr(1)))
+            return node->get_input_node_shared_ptr(0);
+        if (is_type<opset1::Constant>(node->get_input_node_ptr(0)))
+            return node->get_input_node_shared_ptr(1);
+        return nullptr;
+    };
+
+    auto multiply = std::dynamic_pointer_cast<opset1::Multiply>(weights.get_node_shared_ptr());
+    if (!multiply || multiply->get_rt_info().count("DEQUANTIZATION") == 0)
+        return false;
+
+    auto parent = get_data_input(multiply);
+    if (parent && (is_type<opset1::Subtract>(parent) || is_type<opset1::Add>(parent))) {
+        parent = get_data_input(parent);
+    }
+
+    auto convert = std::dynamic_pointer_cast<opset1::Convert>(parent);
+    if (!convert || !is_type<opset1::Constant>(convert->get_input_node_ptr(0)))
+        return false;
+
+    const auto precision = convert->get_input_element_type(0);
+    return precision == element::u8 || precision == element::i8;
+}
+}  // namespace
+
 ngraph::pass::ConvertMatMulToFC::ConvertMatMulToFC() {
     auto matmul = pattern::wrap_type<opset1::MatMul>({pattern::any_input(pattern::has_static_shape()),
                                                       pattern::any_input(pattern::has_static_shape())},
@@ -108,11 +140,12 @@ ngraph::pass::ConvertMatMulToFC::ConvertMatMulToFC() {
         // vector of new nGraph operations
         NodeVector new_ops;
 
-        // Check that if second inputs is Constant operation and it's shape without ones dimensions has length <= 2
-        // we replace MatMul with FullyConnected operation.
+        // Check that if second inputs is Constant operation (or FakeQuantize / decompression subgraph on weights)
+        // and it's shape without ones dimensions has length <= 2 we replace MatMul with FullyConnected operation.
         // Otherwise we replace MatMul with Gemm.
         if ((std::dynamic_pointer_cast<opset1::Constant>    (fc_input_b.get_node_shared_ptr())  ||
-             std::dynamic_pointer_cast<opset1::FakeQuantize>(fc_input_b.get_node_shared_ptr())) &&
+             std::dynamic_pointer_cast<opset1::FakeQuantize>(fc_input_b.get_node_shared_ptr())  ||
+             is_decompressed_weights(fc_input_b)) &&
             std::count_if(shape_b.begin(), shape_b.end(), [](size_t x) {
                 return x != 1;
             }) <= 2) {
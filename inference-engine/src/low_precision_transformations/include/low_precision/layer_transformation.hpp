@@ -8,10 +8,12 @@
 #include <limits>
 #include <list>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include <ngraph/ngraph.hpp>
 #include <ngraph/pass/graph_rewrite.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
 
 #include "iparams_manager.hpp"
 #include "ilayer_transformations_manager.hpp"
@@ -253,6 +255,9 @@ public:
     virtual void registerMatcherIn(ngraph::pass::GraphRewrite& pass, TransformationContext& context) const = 0;
     virtual bool transform(TransformationContext& context, ngraph::pattern::Matcher &m) const = 0;
 
+    // return readable transformation class name which is used as a key in transformation statistics
+    std::string getName() const;
+
     void setParamsManager(IParamsManager* paramsManager) noexcept;
     void setLayerTransformationsManager(ILayerTransformationsManager* layerTransformationsManager) noexcept;
 
@@ -346,14 +351,8 @@ protected:
 
     template <typename Operation>
     void addSingleNodePattern(ngraph::pass::GraphRewrite& pass, TransformationContext& context) const {
-        using namespace ngraph;
-
-        auto is_op_type = [](std::shared_ptr<Node> n) {
-            return !!as_type_ptr<Operation>(n);
-        };
-        auto p_node = std::make_shared<pattern::op::Label>(element::f32, Shape{}, is_op_type);
-
-        addPattern(pass, context, p_node);
+        // type based pattern root allows GraphRewrite to skip the matcher for operations of other types
+        addPattern(pass, context, ngraph::pattern::wrap_type<Operation>());
     }
 };
 
@@ -12,6 +12,7 @@
 
 #include <ngraph/ngraph.hpp>
 #include <ngraph/pattern/matcher.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
 #include <ngraph/opsets/opset1.hpp>
 #include "ngraph_ops/type_relaxed.hpp"
 #include <ngraph/rt_info.hpp>
@@ -225,9 +226,10 @@ std::shared_ptr<Node> NetworkHelper::setOutDataPrecision(std::shared_ptr<Operati
     }
 }
 
+// Pattern root is type based: GraphRewrite runs the matcher for operations of type T only
 template <typename T>
 std::shared_ptr<Node> make_op_pattern(const ngraph::NodeVector& args) {
-    return std::make_shared<ngraph::pattern::op::Any>(element::undefined, PartialShape{}, [](std::shared_ptr<Node> n) {return !!as_type_ptr<T>(n); }, args);
+    return ngraph::pattern::wrap_type<T>(as_output_vector(args));
 }
 
 template <typename T>
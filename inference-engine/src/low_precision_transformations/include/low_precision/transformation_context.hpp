@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <chrono>
+#include <map>
 #include <string>
 #include <unordered_set>
 #include <ngraph/ngraph.hpp>
@@ -13,6 +15,17 @@ namespace ngraph {
 namespace pass {
 namespace low_precision {
 
+/**
+ * @brief Accumulated matcher callback statistics of one transformation.
+ */
+struct TransformationStatistics {
+    // Number of operations matched by transformation patterns
+    size_t matched = 0ul;
+    // Number of operations which were transformed
+    size_t transformed = 0ul;
+    std::chrono::nanoseconds duration{0};
+};
+
 class TRANSFORMATIONS_API TransformationContext {
 public:
     explicit TransformationContext(std::shared_ptr<Function> function);
@@ -28,6 +41,10 @@ public:
     // To avoid FakeQuantize operation double handling by FakeQuantizeTransformation after ConcatTransformation, FakeQuantizeTransformation
     // has to use this member.
     std::unordered_set<std::string> quantizedFakeQuantizeNames;
+
+    // Statistics are collected by transformation name if enabled
+    bool collectStatistics = false;
+    std::map<std::string, TransformationStatistics> statistics;
 };
 
 } // namespace low_precision
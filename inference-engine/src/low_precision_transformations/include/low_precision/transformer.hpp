@@ -5,9 +5,12 @@
 #pragma once
 
 #include <algorithm>
+#include <chrono>
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <ngraph/ngraph.hpp>
@@ -271,6 +274,17 @@ private:
         std::vector<StandaloneCleanup>& transformations) noexcept;
 };
 
+/**
+ * @brief Time spent in low precision transformation stages and in each transformation during the last
+ * LowPrecisionTransformer::transform call.
+ */
+struct LowPrecisionStatistics {
+    // stage name and duration in execution order
+    std::vector<std::pair<std::string, std::chrono::nanoseconds>> stages;
+    // key is transformation class name
+    std::map<std::string, TransformationStatistics> transformations;
+};
+
 /**
  * @brief low precision transformation component.
   */
@@ -284,6 +298,10 @@ public:
     LowPrecisionTransformer(const LowPrecisionTransformations& transformations);
     void transform(std::shared_ptr<Function> network);
 
+    // Statistics collection is disabled by default to avoid time measurement in each matcher callback
+    void setCollectStatistics(const bool collectStatistics);
+    const LowPrecisionStatistics& getStatistics() const;
+
     // IParamsManager interface implementation
     std::vector<element::Type> getPrecisionsOnActivations(const Node& op) const noexcept override;
 
@@ -293,6 +311,13 @@ public:
 
 private:
     LowPrecisionTransformations transformations;
+    // transformations by operation type name, used in manager interfaces to avoid lookups in all transformation maps
+    std::unordered_map<std::string, std::vector<LayerTransformationPtr>> transformationsByType;
+    bool collectStatistics = false;
+    LowPrecisionStatistics statistics;
+
+    void initTransformationsByType();
+    const std::vector<LayerTransformationPtr>& findTransformations(const Node& op) const noexcept;
 
     void registerAllMatchers(
         std::map<std::string, LayerTransformationPtr> transformations,
@@ -7,7 +7,9 @@
 
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <cstdlib>
 #include <limits>
 #include <map>
 #include <memory>
@@ -17,6 +19,10 @@
 #include <vector>
 #include <queue>
 
+#ifndef _WIN32
+#include <cxxabi.h>
+#endif
+
 namespace ngraph {
 namespace pass {
 namespace low_precision {
@@ -447,10 +453,38 @@ void LayerTransformation::updateOutput(
     }
 }
 
+std::string LayerTransformation::getName() const {
+    const LayerTransformation* transformation = this;
+    std::string name = typeid(*transformation).name();
+#ifndef _WIN32
+    int status;
+    char* demangledName = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+    if (demangledName != nullptr) {
+        name = demangledName;
+        std::free(demangledName);
+    }
+#endif
+    return name;
+}
+
 void LayerTransformation::addPattern(ngraph::pass::GraphRewrite& pass, TransformationContext& context, std::shared_ptr<Node> patternRoot) const {
-    ngraph::graph_rewrite_callback internal_callback = [this, &context](ngraph::pattern::Matcher &m) {
+    const std::string name = getName();
+    ngraph::graph_rewrite_callback internal_callback = [this, &context, name](ngraph::pattern::Matcher &m) {
+        std::chrono::steady_clock::time_point start;
+        if (context.collectStatistics) {
+            start = std::chrono::steady_clock::now();
+        }
+
         const bool result = transform(context, m);
-        (void)result;
+
+        if (context.collectStatistics) {
+            TransformationStatistics& statistics = context.statistics[name];
+            statistics.duration += std::chrono::steady_clock::now() - start;
+            ++statistics.matched;
+            if (result) {
+                ++statistics.transformed;
+            }
+        }
 #ifdef LPT_DISPLAY_PRECISION
         if (result) {
             auto operationNode = m.get_match_root();
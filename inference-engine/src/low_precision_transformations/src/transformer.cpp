@@ -6,11 +6,13 @@
 #include "low_precision/network_helper.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <limits>
 #include <map>
 #include <memory>
 #include <iostream>
+#include <set>
 #include <string>
 #include <typeinfo>
 #include <unordered_set>
@@ -20,6 +22,7 @@
 #include "ngraph_ops/type_relaxed.hpp"
 #include "ngraph/pass/constant_folding.hpp"
 #include "ngraph/opsets/opset6.hpp"
+#include "ngraph/pattern/op/wrap_type.hpp"
 
 // branch specific transformations
 #include "low_precision/concat.hpp"
@@ -277,17 +280,16 @@ bool LowPrecisionTransformer::isFunctionQuantized(const std::shared_ptr<Function
     return false;
 }
 
-LowPrecisionTransformer::LowPrecisionTransformer(): transformations(LowPrecisionTransformer::getAllTransformations()) {}
+LowPrecisionTransformer::LowPrecisionTransformer(): transformations(LowPrecisionTransformer::getAllTransformations()) {
+    initTransformationsByType();
+}
 
 template <typename BaseOp>
 void make_matcher_type_relaxed(ngraph::pass::GraphRewrite* transformation) {
     using namespace ngraph;
 
-    auto is_op_type = [](std::shared_ptr<Node> n) {
-        return !!as_type_ptr<BaseOp>(n);
-    };
-
-    auto p_node = std::make_shared<pattern::op::Label>(element::f32, Shape{}, is_op_type);
+    // type based root: matcher is executed for BaseOp operations only
+    auto p_node = pattern::wrap_type<BaseOp>();
 
     ngraph::graph_rewrite_callback callback = [](ngraph::pattern::Matcher &m) {
         auto l_node = std::dynamic_pointer_cast<BaseOp>(m.get_match_root());
@@ -341,25 +343,75 @@ TypeRelaxedReplacer::TypeRelaxedReplacer() {
 }
 
 LowPrecisionTransformer::LowPrecisionTransformer(const LowPrecisionTransformations& transformations)
-    : transformations(transformations) {}
+    : transformations(transformations) {
+    initTransformationsByType();
+}
+
+void LowPrecisionTransformer::initTransformationsByType() {
+    std::set<std::string> types;
+    for (const auto& it : transformations.branchSpecificTransformations) {
+        types.insert(it.first);
+    }
+    for (const auto& it : transformations.transformations) {
+        types.insert(it.first);
+    }
+    for (const auto& it : transformations.cleanupTransformations) {
+        types.insert(it.first);
+    }
+    for (const auto& it : transformations.standaloneCleanupTransformations) {
+        types.insert(it.typeName);
+    }
+
+    transformationsByType.clear();
+    for (const auto& type : types) {
+        transformationsByType.emplace(type, transformations.find(type));
+    }
+}
+
+const std::vector<LayerTransformationPtr>& LowPrecisionTransformer::findTransformations(const Node& op) const noexcept {
+    static const std::vector<LayerTransformationPtr> empty;
+    const auto it = transformationsByType.find(op.get_type_name());
+    return it == transformationsByType.end() ? empty : it->second;
+}
+
+void LowPrecisionTransformer::setCollectStatistics(const bool collectStatistics) {
+    this->collectStatistics = collectStatistics;
+}
+
+const LowPrecisionStatistics& LowPrecisionTransformer::getStatistics() const {
+    return statistics;
+}
 
 void LowPrecisionTransformer::transform(std::shared_ptr<Function> network) {
+    statistics = LowPrecisionStatistics();
     if (!isFunctionQuantized(network)) {
         return;
     }
 
+    auto stageStart = std::chrono::steady_clock::now();
+    auto finishStage = [&](const std::string& name) {
+        if (collectStatistics) {
+            const auto stageEnd = std::chrono::steady_clock::now();
+            statistics.stages.emplace_back(name, stageEnd - stageStart);
+            stageStart = stageEnd;
+        }
+    };
+
     ngraph::pass::ConstantFolding constantFolding;
     constantFolding.run_on_function(network);
+    finishStage("ConstantFolding");
 
     transformations.setParamsManager(this);
     transformations.setLayerTransformationsManager(this);
 
     TransformationContext context(network);
+    context.collectStatistics = collectStatistics;
 
     // Extend necessary operations with polymorphic semantics
     {
         TypeRelaxedReplacer pass;
         pass.run_on_function(network);
+        finishStage("TypeRelaxedReplacer");
     }
 
     {
@@ -367,6 +419,7 @@ void LowPrecisionTransformer::transform(std::shared_ptr<Function> network) {
         GraphRewrite pass;
         registerAllMatchers(transformations.branchSpecificTransformations, pass, context);
         pass.run_on_function(network);
+        finishStage("BranchSpecific");
     }
 
     {
@@ -374,6 +427,7 @@ void LowPrecisionTransformer::transform(std::shared_ptr<Function> network) {
         GraphRewrite pass;
         registerAllMatchers(transformations.decompositionTransformations, pass, context);
         pass.run_on_function(network);
+        finishStage("Decomposition");
     }
 
     {
@@ -381,6 +435,7 @@ void LowPrecisionTransformer::transform(std::shared_ptr<Function> network) {
         GraphRewrite pass;
         registerAllMatchers(transformations.transformations, pass, context);
         pass.run_on_function(network);
+        finishStage("Transformations");
     }
 
     {
@@ -388,19 +443,25 @@ void LowPrecisionTransformer::transform(std::shared_ptr<Function> network) {
         GraphRewrite pass;
         registerAllMatchers(transformations.cleanupTransformations, pass, context);
         pass.run_on_function(network);
+        finishStage("Cleanup");
     }
 
     {
         // Step #4: standalone cleanup transformations execution
-
+        // Transformations are not fused in one traversal: each of them has to see the function updated by previous ones,
+        // e.g. FuseMultiplyToFakeQuantize has to handle all Multiply operations before MultiplyToGroupConvolution.
         for (auto it : transformations.standaloneCleanupTransformations) {
             GraphRewrite pass;
             it.transformation->registerMatcherIn(pass, context);
             pass.run_on_function(network);
         }
+        finishStage("StandaloneCleanup");
     }
 
     network->validate_nodes_and_infer_types();
+    finishStage("Validation");
+
+    statistics.transformations = std::move(context.statistics);
 }
 
 std::vector<element::Type> LowPrecisionTransformer::precisionIntersection(
@@ -421,8 +482,7 @@ std::vector<element::Type> LowPrecisionTransformer::precisionIntersection(
 }
 
 std::vector<element::Type> LowPrecisionTransformer::getPrecisionsOnActivations(const Node& op) const noexcept {
-    const std::string operantionType = LowPrecisionTransformations::getType(op);
-    const std::vector<LayerTransformationPtr> transformation = transformations.find(operantionType);
+    const std::vector<LayerTransformationPtr>& transformation = findTransformations(op);
     if (transformation.empty()) {
         return std::vector<element::Type>();
     }
@@ -435,8 +495,7 @@ std::vector<element::Type> LowPrecisionTransformer::getPrecisionsOnActivations(c
 }
 
 bool LowPrecisionTransformer::isQuantized(const std::shared_ptr<Node>& layer) const noexcept {
-    const std::string operantionType = LowPrecisionTransformations::getType(*layer);
-    const std::vector<LayerTransformationPtr> transformation = transformations.find(operantionType);
+    const std::vector<LayerTransformationPtr>& transformation = findTransformations(*layer);
     if (transformation.empty()) {
         return false;
     }
@@ -450,8 +509,7 @@ bool LowPrecisionTransformer::isQuantized(const std::shared_ptr<Node>& layer) co
 }
 
 bool LowPrecisionTransformer::isPrecisionPreserved(const std::shared_ptr<Node>& layer) const noexcept {
-    const std::string operantionType = LowPrecisionTransformations::getType(*layer);
-    const std::vector<LayerTransformationPtr> transformation = transformations.find(operantionType);
+    const std::vector<LayerTransformationPtr>& transformation = findTransformations(*layer);
     if (transformation.empty()) {
         return false;
     }
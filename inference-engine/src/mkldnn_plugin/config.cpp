@@ -105,6 +105,50 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_ENFORCE_BF16
                     << ". Expected only YES/NO";
             }
+        } else if (key == PluginConfigParams::KEY_CPU_RUNTIME_CACHE_CAPACITY) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_RUNTIME_CACHE_CAPACITY
+                                    << ". Expected only non-negative integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_RUNTIME_CACHE_CAPACITY
+                                    << ". Expected only non-negative integer numbers";
+            runtimeCacheCapacity = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_SHAPES_CACHE_CAPACITY) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SHAPES_CACHE_CAPACITY
+                                    << ". Expected only non-negative integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SHAPES_CACHE_CAPACITY
+                                    << ". Expected only non-negative integer numbers";
+            shapesCacheCapacity = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_TRACE_FILE) {
+            traceFile = val;
+        } else if (key == PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD) {
+            float val_f = -1.f;
+            try {
+                val_f = std::stof(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD
+                                    << ". Expected only floating point numbers in [0, 1] range";
+            }
+            if (!(val_f >= 0.f && val_f <= 1.f))
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD
+                                    << ". Expected only floating point numbers in [0, 1] range";
+            sparseWeightsThreshold = val_f;
+        } else if (key == PluginConfigParams::KEY_CPU_GLOBAL_LAYOUT_SELECTION) {
+            if (val == PluginConfigParams::YES) globalLayoutSelection = true;
+            else if (val == PluginConfigParams::NO) globalLayoutSelection = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_GLOBAL_LAYOUT_SELECTION
+                                   << ". Expected only YES/NO";
         } else {
             IE_THROW(NotFound) << "Unsupported property " << key << " by CPU plugin";
         }
@@ -128,6 +172,8 @@ void Config::updateProperties() {
                 _config.insert({ PluginConfigParams::KEY_CPU_BIND_THREAD, PluginConfigParams::NUMA });
             break;
         }
+        _config.insert({ PluginConfigParams::KEY_CPU_CORES_PLACEMENT,
+                         streamExecutorConfig.GetConfig(PluginConfigParams::KEY_CPU_CORES_PLACEMENT).as<std::string>() });
         if (collectPerfCounters == true)
             _config.insert({ PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::YES });
         else
@@ -145,6 +191,14 @@ void Config::updateProperties() {
         _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(streamExecutorConfig._streams) });
         _config.insert({ PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(streamExecutorConfig._threads) });
         _config.insert({ PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT, dumpToDot });
+        _config.insert({ PluginConfigParams::KEY_CPU_RUNTIME_CACHE_CAPACITY, std::to_string(runtimeCacheCapacity) });
+        _config.insert({ PluginConfigParams::KEY_CPU_SHAPES_CACHE_CAPACITY, std::to_string(shapesCacheCapacity) });
+        _config.insert({ PluginConfigParams::KEY_CPU_TRACE_FILE, traceFile });
+        _config.insert({ PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD, std::to_string(sparseWeightsThreshold) });
+        if (globalLayoutSelection)
+            _config.insert({ PluginConfigParams::KEY_CPU_GLOBAL_LAYOUT_SELECTION, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_GLOBAL_LAYOUT_SELECTION, PluginConfigParams::NO });
         if (enforceBF16)
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES });
         else
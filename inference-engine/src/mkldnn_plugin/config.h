@@ -25,6 +25,11 @@ struct Config {
     std::string dumpQuantizedGraphToDot = "";
     std::string dumpQuantizedGraphToIr = "";
     int batchLimit = 0;
+    int runtimeCacheCapacity = 1024;
+    int shapesCacheCapacity = 0;
+    std::string traceFile = "";
+    float sparseWeightsThreshold = 1.f;
+    bool globalLayoutSelection = false;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
 
 #if defined(__arm__) || defined(__aarch64__)
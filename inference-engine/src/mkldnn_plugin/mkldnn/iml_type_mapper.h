@@ -31,6 +31,8 @@ enum impl_desc_type {
     reorder = 1<<19,
     // winograd
     winograd = 1<<20,
+    // sparse weights
+    sparse = 1<<21,
     // real types
     ref_any             = ref  | any,
 
@@ -40,6 +42,7 @@ enum impl_desc_type {
     gemm_avx2           = gemm | avx2,
     gemm_avx            = gemm | avx,
     gemm_sse42          = gemm | sse42,
+    gemm_sparse         = gemm | sparse,
 
     jit_gemm            = jit | gemm,
 
@@ -4,12 +4,30 @@
 
 #include "mkldnn_async_infer_request.h"
 #include <memory>
+#include <string>
+#include <threading/ie_istreams_executor.hpp>
 
 MKLDNNPlugin::MKLDNNAsyncInferRequest::MKLDNNAsyncInferRequest(const InferenceEngine::InferRequestInternal::Ptr& inferRequest,
                                                                const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
                                                                const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor)
     : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor) {
-    static_cast<MKLDNNInferRequest*>(inferRequest.get())->SetAsyncRequest(this);
+    auto syncRequest = static_cast<MKLDNNInferRequest*>(inferRequest.get());
+    syncRequest->SetAsyncRequest(this);
+
+    if (auto tracer = syncRequest->GetTracer()) {
+        const auto requestId = syncRequest->GetRequestId();
+        for (size_t i = 0; i < _pipeline.size(); i++) {
+            auto& stage = _pipeline[i];
+            auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(stage.first.get());
+            auto nameId = tracer->RegisterName("Pipeline stage " + std::to_string(i));
+            auto task = std::move(stage.second);
+            stage.second = [tracer, streamsExecutor, nameId, requestId, task] {
+                MKLDNNTraceScope traceStage(tracer, MKLDNNTracer::Pipeline, nameId,
+                                            streamsExecutor ? streamsExecutor->GetStreamId() : 0, requestId);
+                task();
+            };
+        }
+    }
 }
 
 MKLDNNPlugin::MKLDNNAsyncInferRequest::~MKLDNNAsyncInferRequest() {
@@ -12,6 +12,7 @@
 #include "mkldnn_memory_state.h"
 #include "mkldnn_itt.h"
 #include "nodes/mkldnn_memory_node.hpp"
+#include "nodes/mkldnn_fullyconnected_node.h"
 #include <legacy/ie_util_internal.hpp>
 #include <legacy/graph_tools.hpp>
 #include <threading/ie_executor_manager.hpp>
@@ -21,8 +22,10 @@
 #include <threading/ie_thread_affinity.hpp>
 #include <algorithm>
 #include <unordered_set>
+#include <set>
 #include <utility>
 #include <cstring>
+#include <fstream>
 #include <legacy/details/ie_cnn_network_tools.h>
 
 using namespace MKLDNNPlugin;
@@ -38,17 +41,93 @@ MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap network
 MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
                                      const Config &cfg,
                                      const MKLDNNExtensionManager::Ptr& extMgr,
-                                     NumaNodesWeights &numaNodesWeights) :
+                                     NumaNodesWeights &numaNodesWeights,
+                                     const ReshapeFunction &reshapeNetwork) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _cfg{cfg},
     _name{network.getName()},
-    _numaNodesWeights(numaNodesWeights) {
+    _numaNodesWeights(numaNodesWeights),
+    _reshapeNetwork(reshapeNetwork) {
     OV_ITT_TASK_CHAIN(taskChain, MKLDNNPlugin::itt::domains::MKLDNN_LT, "MKLDNNExecNetwork", "cloneNet");
 
     // we are cloning network if we have statistics and we can transform network.
     _clonedNetwork = cloneNetwork(network);
 
+    OV_ITT_TASK_NEXT(taskChain, "prepareNetwork");
+    PrepareNetwork(_clonedNetwork);
+
+    OV_ITT_TASK_SKIP(taskChain);
+
+    if (!_cfg.traceFile.empty()) {
+        _tracer = std::make_shared<MKLDNNTracer>();
+    }
+
+    if (cfg.exclusiveAsyncRequests) {
+        // special case when all InferRequests are muxed into a single queue
+        _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getExecutor("CPU");
+    } else {
+        auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig);
+        streamsExecutorConfig._name = "CPUStreamsExecutor";
+        _streamsProcessors = streamsExecutorConfig._streamsProcessors;
+        _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
+    }
+    if (0 != cfg.streamExecutorConfig._streams) {
+        _callbackExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
+            IStreamsExecutor::Config{"CPUCallbackExecutor", 1, 0, IStreamsExecutor::ThreadBindingType::NONE});
+    } else {
+        _callbackExecutor = _taskExecutor;
+    }
+
+    int streams = std::max(1, _cfg.streamExecutorConfig._streams);
+    std::vector<Task> tasks; tasks.resize(streams);
+    _graphs.resize(streams);
+    if (_cfg.streamExecutorConfig._streams != 0) {
+        for (auto&& task : tasks) {
+            task = [this] {
+                MKLDNNExecNetwork::GetGraph();
+            };
+        }
+        _taskExecutor->runAndWait(tasks);
+    } else {
+        MKLDNNExecNetwork::GetGraph();
+    }
+
+    // Streams use only one NUMA node, so requests blobs are placed there as well
+    if (getAvailableNUMANodes().size() > 1) {
+        std::set<int> numaNodeIds;
+        for (auto& graph : _graphs) {
+            numaNodeIds.insert(Graph::Lock(graph)._graph._numaNodeId);
+        }
+        if (numaNodeIds.size() == 1) {
+            _blobsAllocator = CreateNUMAAllocator(*numaNodeIds.begin());
+        }
+    }
+
+    // Save all MemoryLayer data tensors. Will use insight about mechanics
+    // of MemoryLayer implementation. It uses output edge of MemoryLayer
+    // producer as storage for tensor to keep it between infer calls.
+    if (_graphs.size() == 1) {
+        for (auto &node : GetGraph()._graph.GetNodes()) {
+            if (node->getType() == MemoryInput) {
+                auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
+                auto state_store = memoryNode->getStore();
+                auto state_name = memoryNode->getId();
+
+                // Remove suffix with pair ID. Internal information.
+                auto suffix_idx = state_name.find("/id=");
+                if (suffix_idx != std::string::npos)
+                    state_name = state_name.substr(0, suffix_idx);
+
+                memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
+            }
+        }
+    }
+}
+
+void MKLDNNExecNetwork::PrepareNetwork(CNNNetwork &network) {
+    OV_ITT_TASK_CHAIN(taskChain, MKLDNNPlugin::itt::domains::MKLDNN_LT, "PrepareNetwork", "changePrecisionBF16");
+
     if (_cfg.lpTransformsMode == Config::LPTransformsMode::On) {
         // Check if network is INT8 or Binary.
         // BF16 transformations were disabled since CPU plug-in doesn't support mixed precision execution:
@@ -63,10 +142,78 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
             iter++;
         }
 
+        // Per-layer precision plan (e.g. created by bf16_autotune tool) is kept in InferencePrecision runtime attribute.
+        // If the network has the plan, only layers marked as BF16 are executed in bfloat16.
+        bool hasPrecisionPlan = false;
+        for (CNNNetworkIterator planIter(network); planIter != CNNNetworkIterator(); planIter++) {
+            if ((*planIter)->params.count("InferencePrecision")) {
+                hasPrecisionPlan = true;
+                break;
+            }
+        }
+        auto isBF16Planned = [](const CNNLayerPtr& layer) {
+            // states are kept in FP32, so both Memory layers of a pair have the same precision
+            auto precision = layer->params.find("InferencePrecision");
+            return layer->type != "Memory" && precision != layer->params.end() && precision->second == "BF16";
+        };
+
+        // Layers take the execution precision from their inputs, so the precision of each data follows the plan of its
+        // consumers and the producer converts its output. Network inputs, outputs and states, and data consumed by layers
+        // with different plans keep FP32 and are converted to BF16 by an inserted Convert layer for the BF16 consumers.
+        auto applyPrecisionPlan = [&]() {
+            InputsDataMap inputs = network.getInputsInfo();
+            OutputsDataMap outputs = network.getOutputsInfo();
+            IE_SUPPRESS_DEPRECATED_START
+            auto icnnnet = static_cast<ICNNNetwork::Ptr>(network);
+            IE_SUPPRESS_DEPRECATED_END
+            auto implNetwork = std::dynamic_pointer_cast<details::CNNNetworkImpl>(icnnnet);
+            IE_ASSERT(implNetwork != nullptr);
+
+            for (auto& layer : details::CNNNetSortTopologically(network)) {
+                if (CaselessEq<std::string>()(layer->type, "const"))
+                    continue;
+                for (auto& data : layer->outData) {
+                    if (data->getPrecision() != Precision::FP32)
+                        continue;
+                    std::vector<CNNLayerPtr> bf16Consumers;
+                    for (auto& consumer : getInputTo(data)) {
+                        if (isBF16Planned(consumer.second))
+                            bf16Consumers.push_back(consumer.second);
+                    }
+                    if (bf16Consumers.empty())
+                        continue;
+
+                    const bool keepPrecision = inputs.count(data->getName()) || outputs.count(data->getName()) || layer->type == "Memory";
+                    if (!keepPrecision && bf16Consumers.size() == getInputTo(data).size()) {
+                        data->setPrecision(Precision::BF16);
+                        continue;
+                    }
+
+                    const std::string convertName = data->getName() + "_convert_bf16";
+                    auto convert = std::make_shared<CNNLayer>(LayerParams{convertName, "Convert", Precision::BF16});
+                    DataPtr convertedData(new Data(convertName, {Precision::BF16, data->getDims(), data->getLayout()}));
+                    getCreatorLayer(convertedData) = convert;
+                    convert->insData.push_back(data);
+                    convert->outData.push_back(convertedData);
+                    for (auto& consumer : bf16Consumers) {
+                        for (auto& insData : consumer->insData) {
+                            if (insData.lock() == data)
+                                insData = convertedData;
+                        }
+                        getInputTo(data).erase(consumer->name);
+                        getInputTo(convertedData)[consumer->name] = consumer;
+                    }
+                    getInputTo(data)[convertName] = convert;
+                    implNetwork->addData(convertName.c_str(), convertedData);
+                    implNetwork->addLayer(convert);
+                }
+            }
+        };
+
         auto changePrecisionBF16 = [&](Precision current, Precision target) {
-            InputsDataMap inputs = _clonedNetwork.getInputsInfo();
-            OutputsDataMap outputs = _clonedNetwork.getOutputsInfo();
-            CNNNetworkIterator iter(_clonedNetwork);
+            InputsDataMap inputs = network.getInputsInfo();
+            OutputsDataMap outputs = network.getOutputsInfo();
+            CNNNetworkIterator iter(network);
             while (iter != CNNNetworkIterator()) {
                 //  check, if memory output node needs to be transformed
                 if (current == Precision::FP32 &&
@@ -89,9 +236,11 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
 
         if (with_cpu_x86_avx512_core() && isFloatModel) {
             // If enforceBF16 flag was set, BF16 transformation applies for all layers supported by CPU plugin.
-            // Otherwise, only layers marked as BF16 in '_clonedNetwork' will be performed in bfloat16 mode.
+            // Otherwise, only layers marked as BF16 in 'network' will be performed in bfloat16 mode.
             // CPU plugin throws an exception, if marked as BF16 layers have not supported by CPU plugin.
-            if (cfg.enforceBF16 == true)
+            if (_cfg.enforceBF16 == true && hasPrecisionPlan)
+                applyPrecisionPlan();
+            else if (_cfg.enforceBF16 == true)
                 changePrecisionBF16(Precision::FP32, Precision::BF16);
         } else {
             changePrecisionBF16(Precision::BF16, Precision::FP32);
@@ -112,7 +261,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         getInputTo(newEdgeAfterLayer).clear();
 
         IE_SUPPRESS_DEPRECATED_START
-        auto icnnnet = static_cast<ICNNNetwork::Ptr>(_clonedNetwork);
+        auto icnnnet = static_cast<ICNNNetwork::Ptr>(network);
         IE_SUPPRESS_DEPRECATED_END
         auto implNetwork = std::dynamic_pointer_cast<details::CNNNetworkImpl>(icnnnet);
         IE_ASSERT(implNetwork != nullptr);
@@ -126,7 +275,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
 
     // The code block below transforms legacy layers to the form more compatible with opset1 in order to simplify future migration
     // TODO: remove after plug-in is migrated on opset1
-    auto all_layers = details::CNNNetSortTopologically(_clonedNetwork);
+    auto all_layers = details::CNNNetSortTopologically(network);
     for (auto &layer : all_layers) {
         if (layer->type == "ScaleShift" && layer->insData.size() == 1) {
             auto constDimsRank = layer->insData[0].lock()->getDims().size();
@@ -216,66 +365,70 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         }
     }
 
-    OV_ITT_TASK_SKIP(taskChain);
-
     if (_cfg.batchLimit > 1) {
         // check topology for applicability
-        if (!CanProcessDynBatch(_clonedNetwork)) {
+        if (!CanProcessDynBatch(network)) {
             IE_THROW() << "MKLDNNGraph::CreateGraph: such topology cannot be compiled for dynamic batch!";
         }
     }
+}
 
-    if (cfg.exclusiveAsyncRequests) {
-        // special case when all InferRequests are muxed into a single queue
-        _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getExecutor("CPU");
-    } else {
-        auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig);
-        streamsExecutorConfig._name = "CPUStreamsExecutor";
-        _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
-    }
-    if (0 != cfg.streamExecutorConfig._streams) {
-        _callbackExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
-            IStreamsExecutor::Config{"CPUCallbackExecutor", 1, 0, IStreamsExecutor::ThreadBindingType::NONE});
-    } else {
-        _callbackExecutor = _taskExecutor;
-    }
-
-    int streams = std::max(1, _cfg.streamExecutorConfig._streams);
-    std::vector<Task> tasks; tasks.resize(streams);
-    _graphs.resize(streams);
-    if (_cfg.streamExecutorConfig._streams != 0) {
-        for (auto&& task : tasks) {
-            task = [this] {
-                MKLDNNExecNetwork::GetGraph();
-            };
+MKLDNNExecNetwork::~MKLDNNExecNetwork() {
+    // infer requests keep the network alive, so all of them are finished here
+    if (_tracer) {
+        std::ofstream file(_cfg.traceFile);
+        if (file.is_open()) {
+            _tracer->Export(file);
         }
-        _taskExecutor->runAndWait(tasks);
-    } else {
-        MKLDNNExecNetwork::GetGraph();
     }
+}
 
-    // Save all MemoryLayer data tensors. Will use insight about mechanics
-    // of MemoryLayer implementation. It uses output edge of MemoryLayer
-    // producer as storage for tensor to keep it between infer calls.
-    if (_graphs.size() == 1) {
-        for (auto &node : GetGraph()._graph.GetNodes()) {
-            if (node->getType() == MemoryInput) {
-                auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-                auto state_store = memoryNode->getStore();
-                auto state_name = memoryNode->getId();
+MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
+    return GetGraph(_graphs, _clonedNetwork, _numaNodesWeights);
+}
 
-                // Remove suffix with pair ID. Internal information.
-                auto suffix_idx = state_name.find("/id=");
-                if (suffix_idx != std::string::npos)
-                    state_name = state_name.substr(0, suffix_idx);
+MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph(const InputShapes &inputShapes, ShapeGraphs::Ptr &holder) {
+    if (!IsReshapeEnabled())
+        IE_THROW() << "Reshaping at inference time is not enabled for network " << _name;
 
-                memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
-            }
+    ShapeGraphs::Ptr shapeGraphs;
+    {
+        std::lock_guard<std::mutex> lock{_shapeGraphsMutex};
+        auto found = std::find_if(_shapeGraphs.begin(), _shapeGraphs.end(),
+                                  [&](const std::pair<InputShapes, ShapeGraphs::Ptr> &entry) {
+                                      return entry.first == inputShapes;
+                                  });
+        if (found != _shapeGraphs.end()) {
+            _shapeGraphs.splice(_shapeGraphs.begin(), _shapeGraphs, found);
+            shapeGraphs = found->second;
+        }
+    }
+
+    if (!shapeGraphs) {
+        OV_ITT_SCOPED_TASK(MKLDNNPlugin::itt::domains::MKLDNN_LT, "ReshapeNetwork");
+        // network is prepared out of the lock, so the same shapes may be prepared twice by concurrent requests
+        shapeGraphs = std::make_shared<ShapeGraphs>();
+        shapeGraphs->_network = _reshapeNetwork(inputShapes);
+        PrepareNetwork(shapeGraphs->_network);
+        shapeGraphs->_graphs.resize(_graphs.size());
+
+        int capacity = 0;
+        {
+            std::lock_guard<std::mutex> lock{_cfgMutex};
+            capacity = _cfg.shapesCacheCapacity;
         }
+        std::lock_guard<std::mutex> lock{_shapeGraphsMutex};
+        _shapeGraphs.emplace_front(inputShapes, shapeGraphs);
+        while (_shapeGraphs.size() > static_cast<size_t>(std::max(capacity, 1)))
+            _shapeGraphs.pop_back();
     }
+    holder = shapeGraphs;
+
+    return GetGraph(holder->_graphs, holder->_network, holder->_numaNodesWeights);
 }
 
-MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
+MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph(std::deque<Graph> &graphs, const CNNNetwork &network,
+                                                           NumaNodesWeights &numaNodesWeights) {
     int streamId = 0;
     int numaNodeId = 0;
     auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
@@ -283,17 +436,19 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
         streamId = streamsExecutor->GetStreamId();
         numaNodeId = streamsExecutor->GetNumaNodeId();
     }
-    auto graphLock = Graph::Lock(_graphs[streamId % _graphs.size()]);
+    auto graphLock = Graph::Lock(graphs[streamId % graphs.size()]);
     if (!graphLock._graph.IsReady()) {
         std::exception_ptr exception;
         auto makeGraph = [&] {
             try {
-                auto localNetwork = cloneNetwork(_clonedNetwork);
+                auto localNetwork = cloneNetwork(network);
                 {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
                 }
-                graphLock._graph.CreateGraph(localNetwork, extensionManager, _numaNodesWeights[numaNodeId]);
+                graphLock._graph.CreateGraph(localNetwork, extensionManager, numaNodesWeights[numaNodeId]);
+                graphLock._graph._numaNodeId = numaNodeId;
+                graphLock._graph.setTracer(_tracer, streamId);
             } catch(...) {
                 exception = std::current_exception();
             }
@@ -321,6 +476,15 @@ void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &pr
             graphLock._graph.setProperty(properties);
         }
     }
+    std::lock_guard<std::mutex> lock{_shapeGraphsMutex};
+    for (auto& shapeGraphs : _shapeGraphs) {
+        for (auto& g : shapeGraphs.second->_graphs) {
+            auto graphLock = Graph::Lock(g);
+            if (graphLock._graph.IsReady()) {
+                graphLock._graph.setProperty(properties);
+            }
+        }
+    }
 }
 
 InferenceEngine::IInferRequest::Ptr MKLDNNExecNetwork::CreateInferRequest() {
@@ -359,6 +523,12 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(NUMA_NODES_MEMORY_USAGE));
+        metrics.push_back(METRIC_KEY(SPARSE_WEIGHTS_LAYERS));
+        metrics.push_back(METRIC_KEY(STREAMS_PROCESSORS));
+        metrics.push_back(METRIC_KEY(LAYOUT_REORDERS));
+        metrics.push_back(METRIC_KEY(CONCAT_SPLIT_BYTES));
+        metrics.push_back(METRIC_KEY(RUNTIME_CACHE_STATISTIC));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -373,6 +543,61 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == METRIC_KEY(NUMA_NODES_MEMORY_USAGE)) {
+        // buffers are collected by data pointers, so weights shared between streams are counted once
+        std::map<int, std::map<const void*, size_t>> allocatedMemory;
+        for (auto& graph : const_cast<MKLDNNExecNetwork*>(this)->_graphs) {
+            auto graphLock = Graph::Lock(graph);
+            if (graphLock._graph.IsReady()) {
+                graphLock._graph.GetAllocatedMemory(allocatedMemory[graphLock._graph._numaNodeId]);
+            }
+        }
+        std::map<int, uint64_t> memoryUsage;
+        for (auto& numaNodeMemory : allocatedMemory) {
+            uint64_t size = 0;
+            for (auto& buffer : numaNodeMemory.second) {
+                size += buffer.second;
+            }
+            memoryUsage[numaNodeMemory.first] = size;
+        }
+        IE_SET_METRIC_RETURN(NUMA_NODES_MEMORY_USAGE, memoryUsage);
+    } else if (name == METRIC_KEY(SPARSE_WEIGHTS_LAYERS)) {
+        std::map<std::string, float> sparseLayers;
+        auto graphLock = const_cast<MKLDNNExecNetwork*>(this)->GetGraph();
+        for (auto &node : graphLock._graph.GetNodes()) {
+            auto* fcNode = dynamic_cast<MKLDNNFullyConnectedNode*>(node.get());
+            if (fcNode && fcNode->isSparseWeights())
+                sparseLayers[node->getName()] = fcNode->getSparsityRate();
+        }
+        IE_SET_METRIC_RETURN(SPARSE_WEIGHTS_LAYERS, sparseLayers);
+    } else if (name == METRIC_KEY(STREAMS_PROCESSORS)) {
+        IE_SET_METRIC_RETURN(STREAMS_PROCESSORS, _streamsProcessors);
+    } else if (name == METRIC_KEY(LAYOUT_REORDERS)) {
+        MKLDNNGraph::ReordersStatistic greedy, selected, inserted;
+        auto graphLock = const_cast<MKLDNNExecNetwork*>(this)->GetGraph();
+        graphLock._graph.GetReordersStatistic(greedy, selected, inserted);
+        std::map<std::string, uint64_t> reorders = {
+            {"GREEDY_COUNT", greedy.count}, {"GREEDY_BYTES", greedy.bytes},
+            {"SELECTED_COUNT", selected.count}, {"SELECTED_BYTES", selected.bytes},
+            {"INSERTED_COUNT", inserted.count}, {"INSERTED_BYTES", inserted.bytes},
+        };
+        IE_SET_METRIC_RETURN(LAYOUT_REORDERS, reorders);
+    } else if (name == METRIC_KEY(CONCAT_SPLIT_BYTES)) {
+        size_t totalBytes = 0, copiedBytes = 0;
+        auto graphLock = const_cast<MKLDNNExecNetwork*>(this)->GetGraph();
+        graphLock._graph.GetConcatSplitCopiedBytes(totalBytes, copiedBytes);
+        std::map<std::string, uint64_t> bytes = {{"TOTAL_BYTES", totalBytes}, {"COPIED_BYTES", copiedBytes}};
+        IE_SET_METRIC_RETURN(CONCAT_SPLIT_BYTES, bytes);
+    } else if (name == METRIC_KEY(RUNTIME_CACHE_STATISTIC)) {
+        PrimitiveCache::Statistic statistic;
+        for (auto& graph : const_cast<MKLDNNExecNetwork*>(this)->_graphs) {
+            auto graphLock = Graph::Lock(graph);
+            if (graphLock._graph.IsReady())
+                graphLock._graph.GetPrimitiveCacheStatistic(statistic);
+        }
+        std::map<std::string, uint64_t> lookups = {
+            {"HITS", statistic.hits}, {"MISSES", statistic.misses}, {"UNCACHED", statistic.uncached}};
+        IE_SET_METRIC_RETURN(RUNTIME_CACHE_STATISTIC, lookups);
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
     }
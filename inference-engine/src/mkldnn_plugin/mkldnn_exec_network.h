@@ -13,7 +13,9 @@
 #include <vector>
 #include <memory>
 #include <map>
+#include <list>
 #include <string>
+#include <functional>
 #include <legacy/cnn_network_impl.hpp>
 #include <unordered_map>
 
@@ -22,6 +24,8 @@ namespace MKLDNNPlugin {
 class MKLDNNExecNetwork: public InferenceEngine::ExecutableNetworkThreadSafeDefault {
 public:
     typedef std::shared_ptr<MKLDNNExecNetwork> Ptr;
+    using InputShapes = std::map<std::string, InferenceEngine::SizeVector>;
+    using ReshapeFunction = std::function<InferenceEngine::CNNNetwork(const InputShapes&)>;
 
     InferenceEngine::InferRequestInternal::Ptr
     CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
@@ -30,9 +34,10 @@ public:
     InferenceEngine::IInferRequest::Ptr CreateInferRequest() override;
 
     MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
-                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
+                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing,
+                      const ReshapeFunction &reshapeNetwork = {});
 
-    ~MKLDNNExecNetwork() override = default;
+    ~MKLDNNExecNetwork() override;
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
@@ -54,8 +59,13 @@ protected:
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
     std::string                                 _name;
+    // Records execution timeline when the trace file is set
+    MKLDNNTracer::Ptr                           _tracer;
+    // Logical processors of each stream, empty if streams are not placed according to core types
+    std::vector<std::vector<int>>               _streamsProcessors;
     struct Graph : public MKLDNNGraph {
         std::mutex  _mutex;
+        int         _numaNodeId = 0;
         struct Lock : public std::unique_lock<std::mutex> {
             explicit Lock(Graph& graph) : std::unique_lock<std::mutex>(graph._mutex), _graph(graph) {}
             Graph&                          _graph;
@@ -64,6 +74,21 @@ protected:
     // WARNING: Do not use _graphs directly.
     std::deque<Graph>                           _graphs;
     NumaNodesWeights&                           _numaNodesWeights;
+    // Allocator for input and output blobs of infer requests, places them on the NUMA node of the streams
+    std::shared_ptr<InferenceEngine::IAllocator> _blobsAllocator;
+
+    // Graphs compiled for input shapes that differ from the network ones
+    struct ShapeGraphs {
+        typedef std::shared_ptr<ShapeGraphs> Ptr;
+        InferenceEngine::CNNNetwork             _network;
+        std::deque<Graph>                       _graphs;
+        // constant edges are shared by name, so reshaped graphs can not share weights with other shapes
+        NumaNodesWeights                        _numaNodesWeights;
+    };
+    ReshapeFunction                             _reshapeNetwork;
+    std::mutex                                  _shapeGraphsMutex;
+    // Most recently used shapes go first
+    std::list<std::pair<InputShapes, ShapeGraphs::Ptr>> _shapeGraphs;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -71,6 +96,18 @@ protected:
      */
     Graph::Lock GetGraph();
 
+    /* Returns graph compiled for the given input shapes in current stream.
+     * NOTE: Returned lock is valid while `holder` is alive since the entry may be evicted from the shapes cache
+     */
+    Graph::Lock GetGraph(const InputShapes &inputShapes, ShapeGraphs::Ptr &holder);
+
+    Graph::Lock GetGraph(std::deque<Graph> &graphs, const InferenceEngine::CNNNetwork &network,
+                         NumaNodesWeights &numaNodesWeights);
+
+    bool IsReshapeEnabled() const { return static_cast<bool>(_reshapeNetwork); }
+
+    void PrepareNetwork(InferenceEngine::CNNNetwork &network);
+
     bool CanProcessDynBatch(const InferenceEngine::CNNNetwork &network) const;
 };
 
@@ -13,6 +13,7 @@
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <cstring>
 
 #include "mkldnn_graph.h"
 #include "mkldnn_graph_dumper.h"
@@ -25,6 +26,8 @@
 #include <nodes/mkldnn_input_node.h>
 #include <nodes/mkldnn_reorder_node.h>
 #include <nodes/mkldnn_convert_node.h>
+#include <nodes/mkldnn_concat_node.h>
+#include <nodes/mkldnn_split_node.h>
 
 #include <legacy/graph_tools.hpp>
 #include <ie_algorithm.hpp>
@@ -340,6 +343,8 @@ void MKLDNNGraph::InitGraph() {
 
     InitDescriptors();
 
+    SelectLayouts();
+
     InitOptimalPrimitiveDescriptors();
 
     InitEdges();
@@ -378,6 +383,14 @@ void MKLDNNGraph::InitGraph() {
         }
         std::cout << " ]"  << std::endl;
     }
+    size_t concatSplitBytes = 0, concatSplitCopiedBytes = 0;
+    GetConcatSplitCopiedBytes(concatSplitBytes, concatSplitCopiedBytes);
+    std::cout << "concat/split bytes: " << concatSplitBytes << ", copied: " << concatSplitCopiedBytes << std::endl;
+    ReordersStatistic greedy, selected, inserted;
+    GetReordersStatistic(greedy, selected, inserted);
+    std::cout << "reorders greedy: " << greedy.count << " (" << greedy.bytes << " bytes)"
+              << ", selected: " << selected.count << " (" << selected.bytes << " bytes)"
+              << ", inserted: " << inserted.count << " (" << inserted.bytes << " bytes)" << std::endl;
 #endif
 
     ExecuteConstantNodesOnly();
@@ -440,6 +453,258 @@ void MKLDNNGraph::InitDescriptors() {
     }
 }
 
+static size_t getElementSize(const InferenceEngine::Precision& precision) {
+    // descriptors with unspecified precision take it from the neighbour node, so FP32 is assumed for the estimation
+    return precision == InferenceEngine::Precision::UNSPECIFIED ? sizeof(float) : precision.size();
+}
+
+// Returns bytes of the reorder which is required on the edge if its parent and child use the given primitive descriptors.
+// Reorders after constant nodes are executed once on the network loading, so they are not taken into account.
+static size_t getExpectedReorderBytes(const MKLDNNEdgePtr& edge, const PrimitiveDescInfo* parentPD, const PrimitiveDescInfo* childPD) {
+    if (parentPD == nullptr || childPD == nullptr || edge->getParent()->isConstant())
+        return 0;
+
+    const auto& outConfs = parentPD->getConfig().outConfs;
+    const auto& inConfs = childPD->getConfig().inConfs;
+    int inNum = edge->getInputNum();
+    int outNum = edge->getOutputNum();
+    if (outConfs.empty() || outNum < 0 || outNum >= inConfs.size())
+        return 0;
+    if (inNum < 0 || inNum >= outConfs.size())
+        inNum = 0;
+
+    // unspecified precision is taken from the neighbour node, so it matches any precision
+    auto parentDesc = outConfs[inNum].desc;
+    auto childDesc = inConfs[outNum].desc;
+    if (parentDesc.getPrecision() == InferenceEngine::Precision::UNSPECIFIED)
+        parentDesc.setPrecision(childDesc.getPrecision());
+    else if (childDesc.getPrecision() == InferenceEngine::Precision::UNSPECIFIED)
+        childDesc.setPrecision(parentDesc.getPrecision());
+
+    if (MKLDNNExtensionUtils::initTensorsAreEqual(parentDesc, childDesc))
+        return 0;
+    return static_cast<size_t>(edge->getDims().size()) * getElementSize(parentDesc.getPrecision());
+}
+
+// Blocked layouts have an inner block of channels, e.g. nChw8c and nChw16c
+static bool isBlockedLayout(const InferenceEngine::LayerConfig& config) {
+    const auto& confs = config.outConfs.empty() ? config.inConfs : config.outConfs;
+    if (confs.empty() || confs[0].desc.getLayout() != InferenceEngine::Layout::BLOCKED)
+        return false;
+    return confs[0].desc.getBlockingDesc().getBlockDims().size() > confs[0].desc.getDims().size();
+}
+
+MKLDNNGraph::ReordersStatistic MKLDNNGraph::EstimateReorders() {
+    ReordersStatistic reorders;
+    for (auto &edge : graphEdges) {
+        size_t bytes = getExpectedReorderBytes(edge, edge->getParent()->getSelectedPrimitiveDescriptor(),
+                                               edge->getChild()->getSelectedPrimitiveDescriptor());
+        if (bytes) {
+            reorders.count++;
+            reorders.bytes += bytes;
+        }
+    }
+    return reorders;
+}
+
+/**
+ * Nodes choose primitive descriptors one by one looking only at the already selected parents, so mixed graphs
+ * (e.g. blocked convolutions and planar only custom layers) get a reorder on each boundary between them.
+ * The pass reconsiders the choice for the whole graph. Every node is charged with the bytes of the reorders
+ * expected on its edges and with the loss of kernel efficiency: its output bytes multiplied by the distance of
+ * the implementation type from the best supported one in the primitives priority list, plus one if the node has
+ * blocked descriptors and the candidate is not blocked, since planar and channel-last kernels of the same
+ * implementation type are slower.
+ * Nodes are grouped into chains connected by single edges and the optimal primitive descriptors of a chain are
+ * found by dynamic programming with the rest of the graph fixed. The chains are revisited until the total cost
+ * stops decreasing, so the result is never worse than the greedy choice.
+ */
+void MKLDNNGraph::SelectLayouts() {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "MKLDNNGraph::SelectLayouts");
+
+    greedyReorders = selectedReorders = EstimateReorders();
+    if (!config.globalLayoutSelection || greedyReorders.count == 0)
+        return;
+
+    struct Candidate {
+        int index;
+        // holds the rank of implementation type until the best supported rank of the node is known
+        size_t kernelCost;
+    };
+    std::unordered_map<MKLDNNNode*, std::vector<Candidate>> candidates;
+
+    for (auto &node : graphNodes) {
+        auto type = node->getType();
+        // Concat and Split select primitive descriptors to be executed in-place, inputs and outputs keep user layouts
+        if (type == Input || type == Output || type == Reorder || type == Concat || type == Split || node->isConstant())
+            continue;
+        // implementations requested by user are kept
+        if (node->getCnnLayer() && node->getCnnLayer()->params.count("PrimitivesPriority"))
+            continue;
+
+        const auto& supportedPDs = node->getSupportedPrimitiveDescriptors();
+        if (supportedPDs.size() < 2 || node->getSelectedPrimitiveDescriptor() == nullptr)
+            continue;
+        bool inPlace = false;
+        for (const auto& pd : supportedPDs) {
+            for (const auto& configs : {pd.getConfig().inConfs, pd.getConfig().outConfs}) {
+                for (const auto& dc : configs) {
+                    inPlace = inPlace || dc.inPlace >= 0;
+                }
+            }
+        }
+        if (inPlace)
+            continue;
+
+        size_t outputBytes = 0;
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            auto childEdge = node->getChildEdgeAt(i);
+            const auto& outConfs = node->getSelectedPrimitiveDescriptor()->getConfig().outConfs;
+            int inNum = childEdge->getInputNum();
+            if (inNum >= 0 && inNum < outConfs.size())
+                outputBytes += static_cast<size_t>(childEdge->getDims().size()) * getElementSize(outConfs[inNum].desc.getPrecision());
+        }
+
+        const auto& priority = node->getPrimitivesPriority();
+        std::vector<Candidate> nodeCandidates;
+        std::vector<bool> nonBlocked;
+        size_t bestRank = priority.size();
+        bool hasSelected = false, hasBlocked = false;
+        for (size_t i = 0; i < supportedPDs.size(); i++) {
+            if (supportedPDs[i].getConfig().inConfs.size() > node->getParentEdges().size())
+                continue;
+            size_t rank = std::distance(priority.begin(), std::find(priority.begin(), priority.end(), supportedPDs[i].getImplementationType()));
+            if (rank == priority.size())
+                continue;
+            nodeCandidates.push_back({static_cast<int>(i), rank});
+            nonBlocked.push_back(!isBlockedLayout(supportedPDs[i].getConfig()));
+            hasBlocked = hasBlocked || !nonBlocked.back();
+            bestRank = std::min(bestRank, rank);
+            hasSelected = hasSelected || node->getSelectedPrimitiveDescriptor() == &supportedPDs[i];
+        }
+        if (nodeCandidates.size() < 2 || !hasSelected)
+            continue;
+        for (size_t c = 0; c < nodeCandidates.size(); c++) {
+            size_t layoutPenalty = hasBlocked && nonBlocked[c] ? 1 : 0;
+            nodeCandidates[c].kernelCost = (nodeCandidates[c].kernelCost - bestRank + layoutPenalty) * outputBytes;
+        }
+        candidates[node.get()] = nodeCandidates;
+    }
+
+    // chain link is the only non constant input edge of a node which is the only output edge of its parent
+    auto getChainLink = [&](const MKLDNNNodePtr& node) -> MKLDNNEdgePtr {
+        MKLDNNEdgePtr link;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto parentEdge = node->getParentEdgeAt(i);
+            if (parentEdge->getParent()->isConstant())
+                continue;
+            if (link)
+                return nullptr;
+            link = parentEdge;
+        }
+        if (!link || link->getParent()->getChildEdges().size() != 1 || !candidates.count(link->getParent().get()))
+            return nullptr;
+        return link;
+    };
+
+    // nodes of a chain and the edges between them, links[j] connects nodes[j - 1] and nodes[j]
+    struct Chain {
+        std::vector<MKLDNNNodePtr> nodes;
+        std::vector<MKLDNNEdgePtr> links;
+    };
+    std::vector<Chain> chains;
+    std::unordered_map<MKLDNNNode*, size_t> chainIds;
+    for (auto &node : graphNodes) {
+        if (!candidates.count(node.get()))
+            continue;
+        auto link = getChainLink(node);
+        if (link && chains[chainIds[link->getParent().get()]].nodes.back() == link->getParent()) {
+            chainIds[node.get()] = chainIds[link->getParent().get()];
+        } else {
+            link = nullptr;
+            chainIds[node.get()] = chains.size();
+            chains.push_back(Chain());
+        }
+        chains[chainIds[node.get()]].nodes.push_back(node);
+        chains[chainIds[node.get()]].links.push_back(link);
+    }
+
+    // cost of reorders on the node edges except the chain links, when the node uses the given primitive descriptor
+    auto getEdgesCost = [](const MKLDNNNodePtr& node, const PrimitiveDescInfo* pd, const MKLDNNEdgePtr& parentLink,
+                           const MKLDNNEdgePtr& childLink) -> size_t {
+        size_t cost = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto parentEdge = node->getParentEdgeAt(i);
+            if (parentEdge != parentLink)
+                cost += getExpectedReorderBytes(parentEdge, parentEdge->getParent()->getSelectedPrimitiveDescriptor(), pd);
+        }
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            auto childEdge = node->getChildEdgeAt(i);
+            if (childEdge != childLink)
+                cost += getExpectedReorderBytes(childEdge, pd, childEdge->getChild()->getSelectedPrimitiveDescriptor());
+        }
+        return cost;
+    };
+
+    const size_t maxSweeps = 8;
+    bool changed = true;
+    for (size_t sweep = 0; sweep < maxSweeps && changed; sweep++) {
+        changed = false;
+        for (auto &chain : chains) {
+            const size_t length = chain.nodes.size();
+            // cost[j][c] is the minimal cost of the chain prefix ending by the candidate c of the node j
+            std::vector<std::vector<size_t>> cost(length);
+            std::vector<std::vector<size_t>> from(length);
+            size_t currentCost = 0;
+            for (size_t j = 0; j < length; j++) {
+                const auto& node = chain.nodes[j];
+                const auto& nodeCandidates = candidates[node.get()];
+                MKLDNNEdgePtr childLink = j + 1 < length ? chain.links[j + 1] : nullptr;
+                const auto& supportedPDs = node->getSupportedPrimitiveDescriptors();
+                cost[j].resize(nodeCandidates.size());
+                from[j].resize(nodeCandidates.size(), 0);
+
+                for (size_t c = 0; c < nodeCandidates.size(); c++) {
+                    const auto* pd = &supportedPDs[nodeCandidates[c].index];
+                    size_t nodeCost = nodeCandidates[c].kernelCost + getEdgesCost(node, pd, chain.links[j], childLink);
+                    if (pd == node->getSelectedPrimitiveDescriptor()) {
+                        currentCost += nodeCost;
+                        if (j > 0)
+                            currentCost += getExpectedReorderBytes(chain.links[j], chain.nodes[j - 1]->getSelectedPrimitiveDescriptor(), pd);
+                    }
+                    if (j == 0) {
+                        cost[j][c] = nodeCost;
+                        continue;
+                    }
+                    const auto& prevNode = chain.nodes[j - 1];
+                    const auto& prevCandidates = candidates[prevNode.get()];
+                    cost[j][c] = std::numeric_limits<size_t>::max();
+                    for (size_t p = 0; p < prevCandidates.size(); p++) {
+                        size_t pathCost = cost[j - 1][p] + nodeCost +
+                                          getExpectedReorderBytes(chain.links[j], &prevNode->getSupportedPrimitiveDescriptors()[prevCandidates[p].index], pd);
+                        if (pathCost < cost[j][c]) {
+                            cost[j][c] = pathCost;
+                            from[j][c] = p;
+                        }
+                    }
+                }
+            }
+
+            auto best = std::min_element(cost[length - 1].begin(), cost[length - 1].end());
+            if (*best >= currentCost)
+                continue;
+            size_t c = std::distance(cost[length - 1].begin(), best);
+            for (size_t j = length; j-- > 0;) {
+                chain.nodes[j]->selectPrimitiveDescriptorByIndex(candidates[chain.nodes[j].get()][c].index);
+                c = from[j][c];
+            }
+            changed = true;
+        }
+    }
+
+    selectedReorders = EstimateReorders();
+}
+
 void MKLDNNGraph::InitOptimalPrimitiveDescriptors() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::InitOptimalPrimitiveDescriptors");
     for (auto &node : graphNodes) {
@@ -707,6 +972,15 @@ void MKLDNNGraph::AllocateWithReuse() {
 
     auto* workspace_ptr = static_cast<int8_t*>(memWorkspace->GetData());
 
+    // Graph is allocated inside the stream arena, so the workspace is first touched by the stream threads
+    // and operating systems with the first-touch policy place activations on the NUMA node of the stream
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(total_size, nthr, ithr, start, end);
+        if (end > start)
+            std::memset(workspace_ptr + start, 0, end - start);
+    });
+
     for (int i = 0; i < edge_clusters.size(); i++) {
         int count = 0;
         for (auto &edge : edge_clusters[i]) {
@@ -745,21 +1019,87 @@ void MKLDNNGraph::Allocate() {
 
     // Check all getters. Should work.
     for (auto& edge : graphEdges) edge->validate();
+
+    // Infer requests bind input edges to user blobs, so the graph memory is kept to restore them
+    for (auto& input : inputNodes)
+        inputsDefaultPtr[input.first] = input.second->getChildEdgeAt(0)->getMemory().GetPrimitive().get_data_handle();
 }
 
 void MKLDNNGraph::CreatePrimitives() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::CreatePrimitives");
+    PrimitiveCache::StatisticScope statisticScope(primitiveCacheStatistic);
     for (auto& node : graphNodes) {
         OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, node->profiling.createPrimitive);
         node->createPrimitive();
     }
 }
 
+void MKLDNNGraph::GetAllocatedMemory(std::map<const void*, size_t> &memory) {
+    if (memWorkspace)
+        memory[memWorkspace->GetData()] = memWorkspace->GetSize();
+
+    for (auto& edge : graphEdges) {
+        if (!edge->getParent()->isConstant() || edge->getStatus() != MKLDNNEdge::Status::Allocated)
+            continue;
+        const auto& memoryPtr = edge->getMemoryPtr();
+        if (memoryPtr && memoryPtr->GetData())
+            memory[memoryPtr->GetData()] = memoryPtr->GetSize();
+    }
+
+    for (auto& node : graphNodes) {
+        for (auto& memoryPtr : node->getInternalBlobMemory()) {
+            if (memoryPtr && memoryPtr->GetData())
+                memory[memoryPtr->GetData()] = memoryPtr->GetSize();
+        }
+    }
+}
+
+void MKLDNNGraph::GetConcatSplitCopiedBytes(size_t &totalBytes, size_t &copiedBytes) {
+    totalBytes = copiedBytes = 0;
+    for (auto &node : graphNodes) {
+        bool isOptimized = false;
+        size_t bytes = 0;
+        if (auto concat = dynamic_cast<MKLDNNConcatNode *>(node.get())) {
+            isOptimized = concat->isOptimized();
+            bytes = node->getChildEdgeAt(0)->getMemory().GetSize();
+        } else if (auto split = dynamic_cast<MKLDNNSplitNode *>(node.get())) {
+            isOptimized = split->isOptimized();
+            bytes = node->getParentEdgeAt(0)->getMemory().GetSize();
+        } else {
+            continue;
+        }
+        totalBytes += bytes;
+        if (!isOptimized)
+            copiedBytes += bytes;
+    }
+}
+
+void MKLDNNGraph::GetReordersStatistic(ReordersStatistic &greedy, ReordersStatistic &selected, ReordersStatistic &inserted) {
+    greedy = greedyReorders;
+    selected = selectedReorders;
+    inserted = {};
+    for (auto &node : graphNodes) {
+        auto reorder = dynamic_cast<MKLDNNReorderNode *>(node.get());
+        if (reorder == nullptr || reorder->getOptimized() || node->isConstant())
+            continue;
+        inserted.count++;
+        inserted.bytes += static_cast<size_t>(node->getParentEdgeAt(0)->getDims().size()) * getElementSize(reorder->getInput().getPrecision());
+    }
+}
+
+void MKLDNNGraph::GetPrimitiveCacheStatistic(PrimitiveCache::Statistic &statistic) {
+    statistic.hits += primitiveCacheStatistic.hits;
+    statistic.misses += primitiveCacheStatistic.misses;
+    statistic.uncached += primitiveCacheStatistic.uncached;
+}
+
 void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
     if (!IsReady()) IE_THROW()<< "Wrong state. Topology not ready.";
 
     auto input = inputNodes.find(name);
     if (input != inputNodes.end()) {
+        // the consumer may still read the items of a batched blob pushed before
+        batchItemPointers.erase(input->second->getChildEdgeAt(0)->getChild().get());
         MKLDNNDims outDims = input->second->getChildEdgeAt(0)->getDims();
 
         const void *ext_data_ptr = in->cbuffer();
@@ -787,10 +1127,81 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
     }
 }
 
+void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::BatchedBlob::Ptr &in) {
+    if (!IsReady()) IE_THROW()<< "Wrong state. Topology not ready.";
+
+    auto input = inputNodes.find(name);
+    if (input == inputNodes.end())
+        IE_THROW() << "Input blob for infer '" << name << "' doesn't correspond to input in network";
+
+    // the input edges may still point to the user blob of the previous inference
+    void* defaultPtr = inputsDefaultPtr.at(name);
+    for (size_t i = 0; i < input->second->getChildEdges().size(); i++) {
+        auto& memory = *input->second->getChildEdgeAt(i)->getMemory().GetPrimitivePtr();
+        if (memory.get_data_handle() != defaultPtr)
+            memory.set_data_handle(defaultPtr);
+    }
+
+    auto edge = input->second->getChildEdgeAt(0);
+    const auto desc = edge->getDesc();
+    const auto& blkDesc = desc.getBlockingDesc();
+    if (blkDesc.getOrder()[0] != 0)
+        IE_THROW() << "Cannot push batched input '" << name << "': batch is not the outermost dimension of the input memory";
+
+    auto itemDims = desc.getDims();
+    itemDims[0] = 1;
+    auto itemBlkDims = blkDesc.getBlockDims();
+    itemBlkDims[0] = 1;
+    const auto itemDesc = MKLDNNMemoryDesc(TensorDesc(desc.getPrecision(), itemDims,
+                                                      {itemBlkDims, blkDesc.getOrder(), 0, SizeVector(itemBlkDims.size(), 0), blkDesc.getStrides()}));
+    auto getItemDesc = [&](size_t i) {
+        auto extDesc = in->getBlob(i)->getTensorDesc();
+        // items without batch dimension (C, CHW) are dense
+        if (extDesc.getDims().size() + 1 == itemDims.size())
+            extDesc = TensorDesc(extDesc.getPrecision(), itemDims, in->getTensorDesc().getLayout());
+        return MKLDNNMemoryDesc(extDesc);
+    };
+
+    // The only consumer of the input reads the items through the pointer table if it can be executed item by item
+    // and the items have the layout of the input memory. Otherwise the items are copied to the input memory.
+    auto consumer = edge->getChild();
+    batchItemPointers.erase(consumer.get());
+    auto isBatchOutermost = [](const MKLDNNEdgePtr& childEdge) {
+        const auto& order = childEdge->getDesc().getBlockingDesc().getOrder();
+        return order[0] == 0 && std::count(order.begin(), order.end(), 0) == 1;
+    };
+    bool readItems = config.batchLimit == 0 && input->second->getChildEdges().size() == 1 && !consumer->isConstant() &&
+                     consumer->getParentEdges().size() == 1 && consumer->getChildEdges().size() == 1 &&
+                     isBatchOutermost(consumer->getChildEdgeAt(0)) &&
+                     consumer->getSelectedPrimitiveDescriptor()->getConfig().dynBatchSupport &&
+                     consumer->canExecuteBatchItems();
+    std::vector<const void*> items;
+    for (size_t i = 0; i < in->size() && readItems; i++) {
+        readItems = getItemDesc(i) == itemDesc;
+        items.push_back(in->getBlob(i)->cbuffer().as<const void *>());
+    }
+    if (readItems) {
+        batchItemPointers[consumer.get()] = std::move(items);
+        return;
+    }
+
+    // every item is a view to the batch slice of the input memory
+    const size_t itemStride = blkDesc.getStrides()[0] * desc.getPrecision().size();
+    auto* inputPtr = static_cast<uint8_t *>(edge->getMemory().GetPtr());
+    for (size_t i = 0; i < in->size(); i++) {
+        auto extMem = MKLDNNMemory(eng);
+        extMem.Create(getItemDesc(i), in->getBlob(i)->cbuffer().as<const void *>(), false);
+        auto itemMem = MKLDNNMemory(eng);
+        itemMem.Create(itemDesc, inputPtr + i * itemStride, false);
+        itemMem.SetData(extMem, 0, false);
+    }
+}
+
 void MKLDNNGraph::PullOutputData(BlobMap &out) {
     if (!IsReady())
         IE_THROW() << "Wrong state. Topology not ready.";
 
+    zeroCopyOutputs.clear();
     for (MKLDNNNodePtr &node : outputNodes) {
         // remove out_ from node name
         std::string name = node->getName().substr(4);
@@ -824,7 +1235,10 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
         void *intr_blob_ptr = intr_blob.GetData();
 
         // That is the same memory. No need to copy
-        if (ext_blob_ptr == intr_blob_ptr) continue;
+        if (ext_blob_ptr == intr_blob_ptr) {
+            zeroCopyOutputs.insert(node.get());
+            continue;
+        }
 
         int MB = intr_blob.GetDims()[0];
         int MB_to_process = node->batchToProcess();
@@ -837,6 +1251,39 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
     }
 }
 
+bool MKLDNNGraph::BindOutputMemory(const MKLDNNNodePtr& output, const TensorDesc& desc, void* ptr) {
+    auto edge = output->getParentEdgeAt(0);
+    auto& memory = *edge->getMemory().GetPrimitivePtr();
+    // Only this method changes memory of the output producers, so it is the graph memory on the first call
+    void* defaultPtr = outputsDefaultPtr.emplace(output->getName(), memory.get_data_handle()).first->second;
+
+    bool canBeInPlace = ptr != nullptr &&
+                        desc.getPrecision() == edge->getDesc().getPrecision() &&
+                        desc.getBlockingDesc() == edge->getDesc().getBlockingDesc();
+    // Cannot be in-place after concat because concat is using different ptrs without offsets
+    auto parent = edge->getParent();
+    MKLDNNNodePtr previousParent;
+    while (canBeInPlace && previousParent != parent) {
+        previousParent = parent;
+        if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInplace()) {
+            canBeInPlace = false;
+            break;
+        }
+
+        for (size_t i = 0; i < parent->getParentEdges().size(); i++) {
+            if (parent->getParentEdgeAt(i)->getMemory().GetPrimitivePtr()->get_data_handle() == defaultPtr) {
+                parent = parent->getParentEdgeAt(i)->getParent();
+                break;
+            }
+        }
+    }
+
+    void* newPtr = canBeInPlace ? ptr : defaultPtr;
+    if (memory.get_data_handle() != newPtr)
+        memory.set_data_handle(newPtr);
+    return canBeInPlace;
+}
+
 void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
     if (!IsReady()) {
         IE_THROW() << "Wrong state. Topology is not ready.";
@@ -844,6 +1291,9 @@ void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
 
     mkldnn::stream stream(eng);
 
+    auto nodesTracer = tracer.get();
+    const uint32_t requestId = nodesTracer && request ? request->GetRequestId() : 0;
+
     for (int i = 0; i < graphNodes.size(); i++) {
         if (request != nullptr) {
             request->ThrowIfCanceled();
@@ -858,7 +1308,12 @@ void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
 
         if (!graphNodes[i]->isConstant()) {
             OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, graphNodes[i]->profiling.execute);
-            graphNodes[i]->execute(stream);
+            MKLDNNTraceScope traceNode(nodesTracer, MKLDNNTracer::Node, nodesTracer ? traceNodeIds[i] : 0, traceStreamId, requestId);
+            auto batchItems = batchItemPointers.find(graphNodes[i].get());
+            if (batchItems != batchItemPointers.end())
+                graphNodes[i]->executeBatchItems(stream, batchItems->second);
+            else
+                graphNodes[i]->execute(stream);
         }
         ENABLE_DUMP(do_after(DUMP_DIR, graphNodes[i]));
     }
@@ -866,6 +1321,16 @@ void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
     if (infer_count != -1) infer_count++;
 }
 
+void MKLDNNGraph::setTracer(const MKLDNNTracer::Ptr& tracer, int streamId) {
+    this->tracer = tracer;
+    traceStreamId = streamId;
+    traceNodeIds.clear();
+    if (tracer) {
+        for (auto& node : graphNodes)
+            traceNodeIds.push_back(tracer->RegisterName(node->getName()));
+    }
+}
+
 void MKLDNNGraph::VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes) {
     if (node->temporary) {
         return;
@@ -975,6 +1440,13 @@ void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEn
         for (auto& mergedWith : node->mergedWith) {
             getPerfMapFor(perfMap, mergedWith);
         }
+
+        // the producer wrote the result to the user blob, so the output copy was avoided
+        if (zeroCopyOutputs.count(node.get())) {
+            pc.status = InferenceEngine::InferenceEngineProfileInfo::OPTIMIZED_OUT;
+            std::fill(std::begin(pc.exec_type), std::end(pc.exec_type), 0);
+            std::string("zero_copy").copy(pc.exec_type, typeLen - 1, 0);
+        }
     };
 
     for (int i = 1; i < graphNodes.size(); i++) {
@@ -6,13 +6,18 @@
 
 #include "ie_parallel.hpp"
 #include "cpp/ie_cnn_network.h"
+#include "ie_compound_blob.h"
 #include "config.h"
 #include "mkldnn_memory.h"
 #include "mean_image.h"
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
+#include "mkldnn_tracer.h"
+#include "utils/primitive_cache.h"
 #include "threading/ie_thread_local.hpp"
 #include <map>
+#include <unordered_map>
+#include <unordered_set>
 #include <string>
 #include <vector>
 #include <memory>
@@ -57,10 +62,41 @@ public:
     }
 
     void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
+    /**
+     * @brief Passes separately allocated batch items to the input. If the only consumer of the input can be executed item by item
+     * (convolution, pooling, reorder) and the items have the layout of the input memory, the consumer reads them through
+     * a pointer table during the next inference. Otherwise each item is reordered to its place in the input memory.
+     * The input memory bound to a user blob by a previous inference is restored to the memory allocated by the graph first.
+     */
+    void PushInputData(const std::string& name, const InferenceEngine::BatchedBlob::Ptr &in);
     void PullOutputData(InferenceEngine::BlobMap &out);
 
+    /**
+     * @brief Binds memory of the output producer to the external buffer, so the result is written there without copying.
+     * The graph may be shared between infer requests, so the binding is done before each inference.
+     * @param output Output node
+     * @param desc Tensor descriptor of the external buffer
+     * @param ptr External buffer, nullptr restores the memory allocated by the graph
+     * @return true if the output is bound to the external buffer, false if the result has to be copied
+     */
+    bool BindOutputMemory(const MKLDNNNodePtr& output, const InferenceEngine::TensorDesc& desc, void* ptr);
+
     void Infer(MKLDNNInferRequest* request = nullptr, int batch = -1);
 
+    /**
+     * @brief Records execution of the graph nodes to the tracer, nullptr disables tracing.
+     * Node names are registered here, so it has to be called after the graph is created.
+     */
+    void setTracer(const MKLDNNTracer::Ptr& tracer, int streamId);
+
+    MKLDNNTracer* getTracer() const {
+        return tracer.get();
+    }
+
+    int getTraceStreamId() const {
+        return traceStreamId;
+    }
+
     std::vector<MKLDNNNodePtr>& GetNodes() {
         return graphNodes;
     }
@@ -88,6 +124,41 @@ public:
 
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
 
+    /**
+     * @brief Collects memory allocated for the graph: activations workspace, constant tensors and internal blobs
+     * @param memory Sizes of allocated buffers by their data pointers, so buffers shared between graphs are counted once
+     */
+    void GetAllocatedMemory(std::map<const void*, size_t> &memory);
+
+    /**
+     * @brief Collects data movement statistic of Concat and Split nodes
+     * @param totalBytes Bytes which Concat and Split nodes would copy per inference without in-place optimization
+     * @param copiedBytes Bytes which are actually copied per inference
+     */
+    void GetConcatSplitCopiedBytes(size_t &totalBytes, size_t &copiedBytes);
+
+    /**
+     * @brief Number of reorders executed per inference and bytes of tensors they convert
+     */
+    struct ReordersStatistic {
+        size_t count = 0;
+        size_t bytes = 0;
+    };
+
+    /**
+     * @brief Collects reorders statistic of the graph
+     * @param greedy Reorders estimated for the layouts chosen by each node independently
+     * @param selected Reorders estimated for the layouts chosen by the global layout selection
+     * @param inserted Reorders which are actually executed by the graph
+     */
+    void GetReordersStatistic(ReordersStatistic &greedy, ReordersStatistic &selected, ReordersStatistic &inserted);
+
+    /**
+     * @brief Adds lookups of the primitive cache made while the graph primitives were created
+     * @param statistic Hits, misses and primitives created without the cache
+     */
+    void GetPrimitiveCacheStatistic(PrimitiveCache::Statistic &statistic);
+
     void RemoveDroppedNodes();
     void RemoveDroppedEdges();
     void DropNode(const MKLDNNNodePtr& node);
@@ -171,6 +242,15 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         _meanImages.clear();
+        inputsDefaultPtr.clear();
+        outputsDefaultPtr.clear();
+        zeroCopyOutputs.clear();
+        tracer.reset();
+        traceNodeIds.clear();
+        greedyReorders = {};
+        selectedReorders = {};
+        primitiveCacheStatistic = {};
+        batchItemPointers.clear();
     }
     Status status { NotReady };
     Config config;
@@ -191,6 +271,24 @@ protected:
     std::map<std::string, MeanImage> _meanImages;
     std::string _name;
 
+    // Memory allocated by the graph for the inputs, keyed by input names
+    std::map<std::string, void*> inputsDefaultPtr;
+    // Memory allocated by the graph for the output producers, keyed by output node names
+    std::map<std::string, void*> outputsDefaultPtr;
+    // Outputs written directly to the user blobs during the last inference
+    std::unordered_set<const MKLDNNNode*> zeroCopyOutputs;
+
+    MKLDNNTracer::Ptr tracer;
+    int traceStreamId = 0;
+    // tracer name ids of graphNodes
+    std::vector<uint32_t> traceNodeIds;
+
+    ReordersStatistic greedyReorders;
+    ReordersStatistic selectedReorders;
+    PrimitiveCache::Statistic primitiveCacheStatistic;
+    // pointer tables of batch items read by the consumers of batched inputs
+    std::unordered_map<MKLDNNNode*, std::vector<const void*>> batchItemPointers;
+
     static mkldnn::engine eng;
 
     void Replicate(const InferenceEngine::CNNNetwork &network, const MKLDNNExtensionManager::Ptr& extMgr);
@@ -198,6 +296,8 @@ protected:
     void InitGraph();
     void InitNodes();
     void InitDescriptors();
+    void SelectLayouts();
+    ReordersStatistic EstimateReorders();
     void InitOptimalPrimitiveDescriptors();
     void InitEdges();
     void Allocate();
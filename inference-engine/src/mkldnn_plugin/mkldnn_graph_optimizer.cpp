@@ -17,10 +17,13 @@
 #include <nodes/mkldnn_permute_node.h>
 #include "nodes/mkldnn_interpolate_node.h"
 #include "nodes/mkldnn_input_node.h"
+#include "nodes/mkldnn_fullyconnected_node.h"
+#include "nodes/mkldnn_rnn.h"
 
 #include "mkldnn/ie_mkldnn.h"
 
 #include <blob_factory.hpp>
+#include <ie_parallel.hpp>
 #include <legacy/ie_layers_internal.hpp>
 #include "utils/general_utils.h"
 
@@ -40,6 +43,8 @@
 #include <memory>
 #include <set>
 #include <algorithm>
+#include <numeric>
+#include <functional>
 
 #include "mkldnn_itt.h"
 
@@ -64,6 +69,9 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseScaleShiftAndQuantize(graph);
     graph.RemoveDroppedNodes();
 
+    FuseQuantizeAndRNN(graph);
+    graph.RemoveDroppedNodes();
+
     MergeGroupConvolution(graph);
     graph.RemoveDroppedNodes();
 
@@ -112,6 +120,11 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseConvolutionAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
 
+    FuseFullyConnectedAndWeightsDecompression(graph);
+    graph.RemoveDroppedNodes();
+
+    SetSparseWeightsForFullyConnected(graph);
+
     FuseFullyConnectedAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
 
@@ -641,12 +654,196 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndActivation(MKLDNNGraph &graph) {
     }
 }
 
+void MKLDNNGraphOptimizer::FuseFullyConnectedAndWeightsDecompression(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSutableFullyConnected = [](MKLDNNNodePtr node) {
+        if (node->getType() != FullyConnected || node->getParentEdges().size() < 2)
+            return false;
+
+        // Compressed weights path is implemented for FP32 activations only, quantized activations are handled by oneDNN
+        const auto& fcLayer = node->getCnnLayer();
+        if (fcLayer->insData[0].lock()->getPrecision() != Precision::FP32)
+            return false;
+
+        const auto& inDims = node->getParentEdgesAtPort(0)[0]->getDims();
+        const auto& weightsDims = node->getParentEdgesAtPort(1)[0]->getDims();
+        return one_of(inDims.ndims(), 2, 3) && weightsDims.ndims() == 2 && inDims[inDims.ndims() - 1] == weightsDims[1];
+    };
+
+    auto isConstant = [](const MKLDNNNodePtr& node) {
+        return node->getType() == Input && node->getCnnLayer() && node->getCnnLayer()->type == "Const";
+    };
+
+    // Reads per tensor or per output channel values from constant node
+    auto getConstValues = [&](const MKLDNNEdgePtr& edge, size_t OC, std::vector<float>& values) {
+        auto constNode = edge->getParent();
+        if (!isConstant(constNode) || constNode->getChildEdges().size() != 1)
+            return false;
+
+        const auto dims = edge->getDims().ToSizeVector();
+        const size_t size = std::accumulate(dims.begin(), dims.end(), size_t(1), std::multiplies<size_t>());
+        if (size != 1 && (size != OC || dims.empty() || dims[0] != OC))
+            return false;
+
+        auto blob = constNode->getCnnLayer()->blobs["custom"];
+        if (!blob || blob->size() != size)
+            return false;
+
+        values.resize(size);
+        switch (blob->getTensorDesc().getPrecision()) {
+            case Precision::FP32:
+                std::copy_n(blob->cbuffer().as<const float*>(), size, values.begin());
+                break;
+            case Precision::I32:
+                std::copy_n(blob->cbuffer().as<const int32_t*>(), size, values.begin());
+                break;
+            case Precision::U8:
+                std::copy_n(blob->cbuffer().as<const uint8_t*>(), size, values.begin());
+                break;
+            case Precision::I8:
+                std::copy_n(blob->cbuffer().as<const int8_t*>(), size, values.begin());
+                break;
+            default:
+                return false;
+        }
+        return true;
+    };
+
+    // Finds the eltwise input which is the constant with decompression parameters
+    auto getConstPort = [&](const MKLDNNNodePtr& node) -> int {
+        if (node->getParentEdges().size() != 2 || node->getChildEdges().size() != 1)
+            return -1;
+        for (int port = 0; port < 2; port++) {
+            if (isConstant(node->getParentEdgesAtPort(port)[0]->getParent()))
+                return port;
+        }
+        return -1;
+    };
+
+    auto dropConstInput = [&](const MKLDNNNodePtr& node, int constPort) {
+        {
+            auto constEdge = node->getParentEdgesAtPort(constPort)[0];
+            removeEdge(graph, constEdge);
+        }
+        graph.DropNode(node);
+    };
+
+    for (auto &fcNode : graphNodes) {
+        if (!isSutableFullyConnected(fcNode))
+            continue;
+
+        const size_t OC = fcNode->getParentEdgesAtPort(1)[0]->getDims()[0];
+
+        // Constant(u8/i8) -> Convert -> [Subtract|Add(zero point)] -> Multiply(scale) -> FullyConnected
+        auto multiply = fcNode->getParentEdgesAtPort(1)[0]->getParent();
+        auto* multiplyNode = dynamic_cast<MKLDNNEltwiseNode*>(multiply.get());
+        if (!multiplyNode || multiply->getChildEdges().size() != 1)
+            continue;
+        int scalesPort = -1;
+        std::vector<float> scales;
+        if (multiplyNode->getOpType() == Multiply) {
+            scalesPort = getConstPort(multiply);
+            if (scalesPort < 0 || !getConstValues(multiply->getParentEdgesAtPort(scalesPort)[0], OC, scales))
+                continue;
+        } else if (multiplyNode->getOpType() == PowerStatic) {
+            // per tensor scale is represented as Power layer
+            if (multiplyNode->getAlpha() != 1.f || multiplyNode->getGamma() != 0.f)
+                continue;
+            scales = {multiplyNode->getBeta()};
+        } else {
+            continue;
+        }
+
+        auto parent = multiply->getParentEdgesAtPort(scalesPort == 0 ? 1 : 0)[0]->getParent();
+        MKLDNNNodePtr shift;
+        int zeroPointsPort = -1;
+        std::vector<float> zeroPoints;
+        auto* shiftNode = dynamic_cast<MKLDNNEltwiseNode*>(parent.get());
+        if (shiftNode && IsOneOf(shiftNode->getOpType(), {Subtract, Add})) {
+            shift = parent;
+            zeroPointsPort = getConstPort(shift);
+            // Subtract with constant on the first port is not a zero point
+            if (zeroPointsPort < 0 || (shiftNode->getOpType() == Subtract && zeroPointsPort != 1) ||
+                !getConstValues(shift->getParentEdgesAtPort(zeroPointsPort)[0], OC, zeroPoints))
+                continue;
+            // Subtract could be converted to Add with negated zero points
+            if (shiftNode->getOpType() == Add)
+                std::transform(zeroPoints.begin(), zeroPoints.end(), zeroPoints.begin(), std::negate<float>());
+            parent = shift->getParentEdgesAtPort(1 - zeroPointsPort)[0]->getParent();
+        }
+
+        if (parent->getType() != Convert || parent->getChildEdges().size() != 1)
+            continue;
+        auto weights = parent->getParentEdgesAtPort(0)[0]->getParent();
+        if (!isConstant(weights) ||
+            !one_of(weights->getCnnLayer()->outData[0]->getPrecision(), Precision::U8, Precision::I8))
+            continue;
+
+        auto* fc = dynamic_cast<MKLDNNFullyConnectedNode*>(fcNode.get());
+        if (fc == nullptr)
+            IE_THROW() << "Cannot get FullyConnected node " << fcNode->getName();
+        fc->setWeightsDecompression(scales, zeroPoints);
+
+        if (scalesPort < 0)
+            graph.DropNode(multiply);
+        else
+            dropConstInput(multiply, scalesPort);
+        if (shift)
+            dropConstInput(shift, zeroPointsPort);
+        graph.DropNode(parent);
+    }
+}
+
+void MKLDNNGraphOptimizer::SetSparseWeightsForFullyConnected(MKLDNNGraph &graph) {
+    const float threshold = graph.getProperty().sparseWeightsThreshold;
+    if (threshold >= 1.f)
+        return;
+
+    for (auto &node : graph.GetNodes()) {
+        auto* fc = dynamic_cast<MKLDNNFullyConnectedNode*>(node.get());
+        if (!fc || fc->isWeightsCompressed() || node->getParentEdges().size() < 2)
+            continue;
+
+        // Sparse weights path is implemented for FP32 activations and weights only
+        const auto& fcLayer = node->getCnnLayer();
+        if (fcLayer->insData[0].lock()->getPrecision() != Precision::FP32 ||
+            fcLayer->outData[0]->getPrecision() != Precision::FP32)
+            continue;
+
+        const auto& inDims = node->getParentEdgesAtPort(0)[0]->getDims();
+        const auto& weightsDims = node->getParentEdgesAtPort(1)[0]->getDims();
+        if (!one_of(inDims.ndims(), 2, 3) || weightsDims.ndims() != 2 || inDims[inDims.ndims() - 1] != weightsDims[1])
+            continue;
+
+        auto weights = node->getParentEdgesAtPort(1)[0]->getParent();
+        if (weights->getType() != Input || !weights->getCnnLayer() || weights->getCnnLayer()->type != "Const")
+            continue;
+
+        const size_t OC = weightsDims[0];
+        const size_t IC = weightsDims[1];
+        auto blob = weights->getCnnLayer()->blobs["custom"];
+        if (!blob || blob->getTensorDesc().getPrecision() != Precision::FP32 || blob->size() != OC * IC)
+            continue;
+
+        const auto* data = blob->cbuffer().as<const float*>();
+        const size_t zerosCount = parallel_sum(OC, size_t(0), [&](size_t oc) {
+            return static_cast<size_t>(std::count(data + oc * IC, data + (oc + 1) * IC, 0.f));
+        });
+        if (static_cast<float>(zerosCount) / blob->size() > threshold)
+            fc->setSparseWeights(data, OC, IC);
+    }
+}
+
 void MKLDNNGraphOptimizer::FuseFullyConnectedAndSimpleOperation(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
     auto isSutableParentNode = [](MKLDNNNodePtr node) {
+        auto* fcNode = dynamic_cast<MKLDNNFullyConnectedNode*>(node.get());
         return node->getType() == FullyConnected &&
-               node->getChildEdges().size() == 1;
+               node->getChildEdges().size() == 1 &&
+               // post operations are not supported for FullyConnected with compressed or sparse weights
+               !(fcNode && (fcNode->isWeightsCompressed() || fcNode->isSparseWeights()));
     };
 
     auto isSutableChildNode = [&](MKLDNNNodePtr parentNode, MKLDNNNodePtr childNode) {
@@ -2119,6 +2316,45 @@ void MKLDNNGraphOptimizer::FuseScaleShiftAndQuantize(MKLDNNGraph &graph) {
     }
 }
 
+void MKLDNNGraphOptimizer::FuseQuantizeAndRNN(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSutableQuantizeNode = [](MKLDNNNodePtr node) {
+        if (node->getType() != Quantize || node->getChildEdges().size() != 1)
+            return false;
+
+        // RNN node quantizes f32 data by itself
+        auto inData = node->getCnnLayer()->insData[0].lock();
+        if (!inData || inData->getPrecision() != Precision::FP32)
+            return false;
+
+        auto child = node->getChildEdgeAt(0)->getChild();
+        return one_of(child->getType(), RNNSeq, RNNCell) && node->getChildEdgeAt(0)->getOutputNum() == 0;
+    };
+
+    for (int i = 0; i < graphNodes.size(); i++) {
+        auto parent = graphNodes[i];
+        if (!isSutableQuantizeNode(parent)) continue;
+
+        auto quantizeNode = dynamic_cast<MKLDNNQuantizeNode*>(parent.get());
+        auto rnnNode = dynamic_cast<MKLDNNRNN*>(parent->getChildEdgeAt(0)->getChild().get());
+        if (!quantizeNode || !rnnNode || !rnnNode->canFuseInputQuantize(quantizeNode)) continue;
+
+        rnnNode->fuseInputQuantize(quantizeNode);
+
+        auto parentEdges = parent->parentEdges;
+        for (auto &parentEdge : parentEdges) {
+            auto p_edge = parentEdge.lock();
+            if (p_edge->getParent()->getCnnLayer()->type != "Const")
+                continue;
+
+            removeEdge(graph, p_edge);
+        }
+
+        graph.DropNode(parent);
+    }
+}
+
 void MKLDNNGraphOptimizer::MergePermuteAndReorder(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -12,6 +12,7 @@
 #include <nodes/mkldnn_split_node.h>
 #include <ie_compound_blob.h>
 #include <ie_common.h>
+#include <debug.h>
 #include "mkldnn_exec_network.h"
 #include "mkldnn_itt.h"
 #include "nodes/common/cpu_convert.h"
@@ -20,12 +21,18 @@
 #include "nodes/common/cpu_memcpy.h"
 #include "mkldnn_async_infer_request.h"
 
+static InferenceEngine::Blob::Ptr makeBlob(const InferenceEngine::TensorDesc& desc,
+                                           const std::shared_ptr<InferenceEngine::IAllocator>& allocator) {
+    return allocator ? make_blob_with_precision(desc, allocator) : make_blob_with_precision(desc);
+}
+
 MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsDataMap     networkInputs,
                                                      InferenceEngine::OutputsDataMap    networkOutputs,
                                                      MKLDNNExecNetwork::Ptr             execNetwork_)
 : InferRequestInternal(networkInputs, networkOutputs)
 , execNetwork(execNetwork_) {
     auto id = (execNetwork->_numRequests)++;
+    requestId = static_cast<uint32_t>(id);
     profilingTask = openvino::itt::handle("MKLDNN_INFER_" + execNetwork->_name + "_" + std::to_string(id));
 
     if (execNetwork->_graphs.size() == 0)
@@ -62,6 +69,7 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
         memoryStates = execNetwork->QueryState();
     }
     IE_SUPPRESS_DEPRECATED_END
+    stateSessions[stateSessionId] = memoryStates;
 }
 
 MKLDNNPlugin::MKLDNNInferRequest::~MKLDNNInferRequest() {
@@ -138,21 +146,26 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
 
         pushInput(input.first, input.second, inPrec);
     }
+
+    for (auto& input : batchedInputs) {
+        // items placed one after another are pushed as a regular input
+        if (_inputs.find(input.first) == _inputs.end())
+            graph->PushInputData(input.first, input.second);
+    }
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::PushStates() {
+    // State buffers of the selected session are bound to the graph by pointer, so switching between
+    // requests or sessions does not copy the states
     for (auto &node : graph->GetNodes()) {
         if (node->getType() == MemoryInput) {
             auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
             auto cur_id = cur_node->getId();
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
+                    auto cur_state = std::dynamic_pointer_cast<MKLDNNVariableState>(state);
+                    IE_ASSERT(cur_state != nullptr);
+                    cur_node->bindState(cur_state->GetReadBuffer(), cur_state->GetWriteBuffer());
                 }
             }
         }
@@ -166,12 +179,10 @@ void MKLDNNPlugin::MKLDNNInferRequest::PullStates() {
             auto cur_id = cur_node->getId();
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
+                    auto cur_state = std::dynamic_pointer_cast<MKLDNNVariableState>(state);
+                    IE_ASSERT(cur_state != nullptr);
+                    cur_state->Commit();
+                    cur_node->bindState(nullptr, nullptr);
                 }
             }
         }
@@ -182,24 +193,46 @@ void MKLDNNPlugin::MKLDNNInferRequest::PullStates() {
 void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     using namespace openvino::itt;
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, profilingTask);
-    auto graphLock = execNetwork->GetGraph();
+    auto inputShapes = getReshapedInputShapes();
+    if (inputShapes.empty()) {
+        shapeGraphs.reset();
+    } else if (memoryStates.size() != 0) {
+        IE_THROW(NotImplemented) << "Reshaping at inference time is not supported for networks with memory states";
+    }
+    auto graphLock = inputShapes.empty() ? execNetwork->GetGraph() : execNetwork->GetGraph(inputShapes, shapeGraphs);
     graph = &(graphLock._graph);
 
     ThrowIfCanceled();
 
-    execDataPreprocessing(_inputs);
+    auto tracer = graph->getTracer();
+    const int streamId = graph->getTraceStreamId();
+
+    if (execNetwork->IsReshapeEnabled()) {
+        reallocateOutputs();
+    }
+
+    {
+        MKLDNNTraceScope traceStage(tracer, MKLDNNTracer::Inference, MKLDNNTracer::Preprocessing, streamId, requestId);
+        execDataPreprocessing(_inputs);
+    }
 
     changeDefaultPtr();
 
     ThrowIfCanceled();
 
-    PushInputData();
+    {
+        MKLDNNTraceScope traceStage(tracer, MKLDNNTracer::Inference, MKLDNNTracer::PushInputData, streamId, requestId);
+        PushInputData();
 
-    if (memoryStates.size() != 0) {
-        PushStates();
+        if (memoryStates.size() != 0) {
+            PushStates();
+        }
     }
 
-    graph->Infer(this, m_curBatch);
+    {
+        MKLDNNTraceScope traceStage(tracer, MKLDNNTracer::Inference, MKLDNNTracer::GraphInfer, streamId, requestId);
+        graph->Infer(this, m_curBatch);
+    }
 
     if (memoryStates.size() != 0) {
         PullStates();
@@ -207,6 +240,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
 
     ThrowIfCanceled();
 
+    MKLDNNTraceScope traceStage(tracer, MKLDNNTracer::Inference, MKLDNNTracer::PullOutputData, streamId, requestId);
     graph->PullOutputData(_outputs);
 }
 
@@ -230,6 +264,11 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
     graph->getInputBlobs(blobs);
 
     if (blobs.find(name) != blobs.end()) {
+        auto batched = batchedInputs.find(name);
+        if (batched != batchedInputs.end()) {
+            return batched->second;
+        }
+
         // ROI blob is returned only if it was set previously.
         auto it = _preProcData.find(name);
         if (it != _preProcData.end()) {
@@ -239,7 +278,7 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
 
         if (_inputs.find(name) != _inputs.end()) {
             data = _inputs[name];
-            checkBlob(data, name, true);
+            checkBlob(data, name, true, execNetwork->IsReshapeEnabled() ? data->getTensorDesc().getDims() : InferenceEngine::SizeVector{});
             return data;
         }
 
@@ -253,7 +292,7 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
             desc = InferenceEngine::TensorDesc(p, dims, l);
         }
 
-        _inputs[name] = make_blob_with_precision(desc);
+        _inputs[name] = makeBlob(desc, execNetwork->_blobsAllocator);
         _inputs[name]->allocate();
         if (desc.getPrecision() == originPrecision &&
                 graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
@@ -268,7 +307,7 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
     if (blobs.find(name) != blobs.end()) {
         if (_outputs.find(name) != _outputs.end()) {
             data = _outputs[name];
-            checkBlob(data, name, false);
+            checkBlob(data, name, false, execNetwork->IsReshapeEnabled() ? data->getTensorDesc().getDims() : InferenceEngine::SizeVector{});
             return data;
         }
 
@@ -281,9 +320,9 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
         auto currBlockDesc = InferenceEngine::BlockingDesc(desc.getBlockingDesc().getBlockDims(), desc.getBlockingDesc().getOrder());
         desc = InferenceEngine::TensorDesc(desc.getPrecision(), desc.getDims(), currBlockDesc);
 
-        _outputs[name] = make_blob_with_precision(desc);
+        _outputs[name] = makeBlob(desc, execNetwork->_blobsAllocator);
         _outputs[name]->allocate();
-        if (desc.getPrecision() == InferenceEngine::Precision::FP32 && !graph->getProperty().batchLimit) {
+        if (!graph->getProperty().batchLimit) {
             externalPtr[name] = _outputs[name]->buffer();
         }
         data = _outputs[name];
@@ -318,6 +357,11 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
         }
 
         const bool preProcRequired = preProcessingRequired(foundInput, data);
+        batchedInputs.erase(name);
+        if (data->is<InferenceEngine::BatchedBlob>() && !preProcRequired) {
+            setBatchedBlob(name, foundInput, std::dynamic_pointer_cast<InferenceEngine::BatchedBlob>(data));
+            return;
+        }
         if (compoundBlobPassed && !preProcRequired) {
             IE_THROW(NotImplemented)
                                << "cannot set compound blob: supported only for input pre-processing";
@@ -332,21 +376,33 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
             // pre-processing
             _preProcData[name]->setRoiBlob(data);
         } else {
-            size_t inputSize = foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
-                ? InferenceEngine::details::product(foundInput->getTensorDesc().getDims())
-                : 1;
-            if (dataSize != inputSize) {
-                IE_THROW() << "Input blob size is not equal network input size ("
-                                   << dataSize << "!=" << inputSize << ").";
-            }
+            if (execNetwork->IsReshapeEnabled()) {
+                // input dimensions may differ from the network ones, the network is reshaped during inference
+                if (foundInput->getTensorDesc().getDims().size() != data->getTensorDesc().getDims().size()) {
+                    IE_THROW(ParameterMismatch) << "Failed to set input blob. Rank mismatch.";
+                }
 
-            if (foundInput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
-                IE_THROW(ParameterMismatch) << "Failed to set input blob. Dimensions mismatch.";
-            }
+                if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
+                    foundInput->getTensorDesc().getLayout() != data->getTensorDesc().getLayout()) {
+                    IE_THROW(ParameterMismatch) << "Failed to set input blob. Layout mismatch.";
+                }
+            } else {
+                size_t inputSize = foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
+                    ? InferenceEngine::details::product(foundInput->getTensorDesc().getDims())
+                    : 1;
+                if (dataSize != inputSize) {
+                    IE_THROW() << "Input blob size is not equal network input size ("
+                                       << dataSize << "!=" << inputSize << ").";
+                }
+
+                if (foundInput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
+                    IE_THROW(ParameterMismatch) << "Failed to set input blob. Dimensions mismatch.";
+                }
 
-            if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
-                foundInput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
-                IE_THROW(ParameterMismatch) << "Failed to set input blob. Blocking descriptor mismatch.";
+                if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
+                    foundInput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
+                    IE_THROW(ParameterMismatch) << "Failed to set input blob. Blocking descriptor mismatch.";
+                }
             }
 
             if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
@@ -369,24 +425,147 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
         size_t outputSize = foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
             ? InferenceEngine::details::product(foundOutput->getDims())
             : 1;
-        if (dataSize != outputSize) {
-            IE_THROW() << "Output blob size is not equal network output size ("
-                               << dataSize << "!=" << outputSize << ").";
-        }
-        if (foundOutput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
-            IE_THROW(ParameterMismatch) << "Failed to set output Blob. Dimensions mismatch.";
-        }
-        if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
-            foundOutput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
+        if (execNetwork->IsReshapeEnabled()) {
+            // output dimensions depend on the input ones, the blob size is checked during inference
+            if (foundOutput->getTensorDesc().getDims().size() != data->getTensorDesc().getDims().size()) {
+                IE_THROW(ParameterMismatch) << "Failed to set output blob. Rank mismatch.";
+            }
+            if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
+                foundOutput->getTensorDesc().getLayout() != data->getTensorDesc().getLayout()) {
+                IE_THROW(ParameterMismatch) << "Failed to set output blob. Layout mismatch.";
+            }
+        } else {
+            if (dataSize != outputSize) {
+                IE_THROW() << "Output blob size is not equal network output size ("
+                                   << dataSize << "!=" << outputSize << ").";
+            }
+            if (foundOutput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
+                IE_THROW(ParameterMismatch) << "Failed to set output Blob. Dimensions mismatch.";
+            }
+            if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
+                foundOutput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
                 IE_THROW(ParameterMismatch) << "Failed to set output blob. Blocking descriptor mismatch.";
+            }
         }
-        if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                !graph->getProperty().batchLimit) {
+        // precision and layout of the producer memory are checked when the output is bound before inference
+        if (!graph->getProperty().batchLimit) {
             externalPtr[name] = data->buffer();
         } else if (externalPtr.find(name) != externalPtr.end()) {
             externalPtr.erase(name);
         }
         _outputs[name] = data;
+        userOutputs.insert(name);
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::setBatchedBlob(const std::string& name, const InferenceEngine::InputInfo::Ptr& foundInput,
+                                                      const InferenceEngine::BatchedBlob::Ptr& data) {
+    const auto& inputDesc = foundInput->getTensorDesc();
+    const auto& batchedDesc = data->getTensorDesc();
+    if (batchedDesc.getDims() != inputDesc.getDims()) {
+        IE_THROW(ParameterMismatch) << "Failed to set batched input blob. Dimensions mismatch.";
+    }
+    if (inputDesc.getLayout() != InferenceEngine::Layout::ANY && batchedDesc.getLayout() != inputDesc.getLayout()) {
+        IE_THROW(ParameterMismatch) << "Failed to set batched input blob. Layout mismatch.";
+    }
+    switch (inputDesc.getPrecision()) {
+        // items are reordered to the graph memory by mkldnn, so only precisions supported by mkldnn are accepted
+        case InferenceEngine::Precision::FP32:
+        case InferenceEngine::Precision::BF16:
+        case InferenceEngine::Precision::I8:
+        case InferenceEngine::Precision::U8:
+        case InferenceEngine::Precision::I32:
+            break;
+        default:
+            IE_THROW(NotImplemented) << "Batched input blob of precision " << inputDesc.getPrecision() << " is not supported";
+    }
+    if (graph->hasMeanImageFor(name)) {
+        IE_THROW(NotImplemented) << "Batched input blob is not supported for input with mean image";
+    }
+
+    bool contiguous = true;
+    auto itemDesc = data->getBlob(0)->getTensorDesc();
+    const auto* firstItemPtr = data->getBlob(0)->cbuffer().as<const uint8_t*>();
+    for (size_t i = 0; i < data->size(); i++) {
+        auto item = data->getBlob(i);
+        if (item->is<InferenceEngine::CompoundBlob>() || item->cbuffer().as<const void *>() == nullptr) {
+            IE_THROW(NotAllocated) << "Batched input blob item " << i << " was not allocated. Input name: \'" << name << "\'";
+        }
+        if (item->getTensorDesc().getPrecision() != inputDesc.getPrecision()) {
+            IE_THROW(ParameterMismatch) << "Failed to set batched input blob item with precision: "
+                                        << item->getTensorDesc().getPrecision() << ", if CNNNetwork input blob precision is: " << inputDesc.getPrecision();
+        }
+        contiguous = contiguous && item->cbuffer().as<const uint8_t*>() == firstItemPtr + i * item->byteSize();
+    }
+    // items with ROI or padding are not dense
+    contiguous = contiguous &&
+        itemDesc.getBlockingDesc() == InferenceEngine::TensorDesc(itemDesc.getPrecision(), itemDesc.getDims(), itemDesc.getLayout()).getBlockingDesc();
+
+    if (contiguous) {
+        auto blob = make_blob_with_precision(InferenceEngine::TensorDesc(inputDesc.getPrecision(), batchedDesc.getDims(), batchedDesc.getLayout()),
+                                             const_cast<uint8_t*>(firstItemPtr));
+        SetBlob(name, blob);
+    } else {
+        _inputs.erase(name);
+        externalPtr.erase(name);
+    }
+    batchedInputs[name] = data;
+}
+
+MKLDNNPlugin::MKLDNNExecNetwork::InputShapes MKLDNNPlugin::MKLDNNInferRequest::getReshapedInputShapes() const {
+    MKLDNNExecNetwork::InputShapes inputShapes;
+    if (!execNetwork->IsReshapeEnabled())
+        return inputShapes;
+
+    bool reshaped = false;
+    for (const auto& input : _inputs) {
+        const auto& dims = input.second->getTensorDesc().getDims();
+        reshaped = reshaped || dims != _networkInputs.at(input.first)->getTensorDesc().getDims();
+        inputShapes[input.first] = dims;
+    }
+    if (!reshaped)
+        inputShapes.clear();
+    return inputShapes;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::reallocateOutputs() {
+    InferenceEngine::BlobMap blobs;
+    graph->getOutputBlobs(blobs);
+    for (const auto& it : blobs) {
+        const auto& name = it.first;
+        auto found = _outputs.find(name);
+        if (found == _outputs.end() || found->second->getTensorDesc().getDims() == it.second->getTensorDesc().getDims())
+            continue;
+
+        // blob set by the user is never replaced, so its dimensions must be the inferred ones
+        if (userOutputs.count(name))
+            IE_THROW() << "Output blob '" << name << "' set by the user has dimensions "
+                       << InferenceEngine::details::dumpVec(found->second->getTensorDesc().getDims())
+                       << ", but the network reshaped for the input blobs produces "
+                       << InferenceEngine::details::dumpVec(it.second->getTensorDesc().getDims());
+
+        InferenceEngine::TensorDesc desc = it.second->getTensorDesc();
+        auto currBlockDesc = InferenceEngine::BlockingDesc(desc.getBlockingDesc().getBlockDims(), desc.getBlockingDesc().getOrder());
+        desc = InferenceEngine::TensorDesc(found->second->getTensorDesc().getPrecision(), desc.getDims(), currBlockDesc);
+        found->second = makeBlob(desc, execNetwork->_blobsAllocator);
+        found->second->allocate();
+        if (externalPtr.find(name) != externalPtr.end()) {
+            externalPtr[name] = found->second->buffer();
+        }
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::checkBlobs() {
+    if (!execNetwork->IsReshapeEnabled()) {
+        InferRequestInternal::checkBlobs();
+        return;
+    }
+    // network dimensions are not the reference ones, output blobs are reallocated during inference if needed
+    for (auto const& input : _inputs) {
+        checkBlob(input.second, input.first, true, input.second->getTensorDesc().getDims());
+    }
+    for (auto const& output : _outputs) {
+        checkBlob(output.second, output.first, false, output.second->getTensorDesc().getDims());
     }
 }
 
@@ -429,40 +608,21 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
             continue;
         }
 
-        MKLDNNNodePtr output;
-        for (auto& out : graph->outputNodes) {
-            if (out->getName() == "out_" + it.first) {
-                output = out;
-                break;
-            }
-        }
-        if (output) {
-            if (output->getParentEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
-                continue;
-            bool canBeInPlace = true;
-            void * defaultPtr = output->getParentEdgeAt(0)->getMemory().GetPrimitivePtr()->get_data_handle();
-            // Cannot be in-place after concat because concat is using different ptrs without offsets
-            auto parent = output->getParentEdgeAt(0)->getParent();
-            MKLDNNNodePtr previousParent;
-            do {
-                previousParent = parent;
-                if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInplace()) {
-                    canBeInPlace = false;
-                    break;
-                }
+        if (_outputs.find(it.first) == _outputs.end())
+            IE_THROW() << "Cannot find input/output blob: " << it.first;
+    }
 
-                for (size_t i = 0; i < parent->getParentEdges().size(); i++) {
-                    if (parent->getParentEdgeAt(i)->getMemory().GetPrimitivePtr()->get_data_handle() == defaultPtr) {
-                        parent = parent->getParentEdgeAt(i)->getParent();
-                        break;
-                    }
-                }
-            } while (previousParent != parent);
-            if (canBeInPlace)
-                changeEdgePtr(output->getParentEdgeAt(0), it.second);
-            continue;
+    // Graph is shared between requests of the stream, so outputs are bound to the blobs of this request
+    // or restored to the graph memory before each inference
+    for (auto& output : graph->outputNodes) {
+        // remove out_ from node name
+        auto name = output->getName().substr(4);
+        auto ptr = externalPtr.find(name);
+        if (ptr != externalPtr.end()) {
+            graph->BindOutputMemory(output, _outputs[name]->getTensorDesc(), ptr->second);
+        } else {
+            graph->BindOutputMemory(output, {}, nullptr);
         }
-        IE_THROW() << "Cannot find input/output blob: " << it.first;
     }
 }
 
@@ -483,6 +643,28 @@ std::vector<InferenceEngine::IVariableStateInternal::Ptr> MKLDNNPlugin::MKLDNNIn
     return memoryStates;
 }
 
+void MKLDNNPlugin::MKLDNNInferRequest::SetStateSession(size_t sessionId) {
+    if (memoryStates.empty())
+        IE_THROW() << "Variable state sessions are not supported for networks without states";
+
+    auto session = stateSessions.find(sessionId);
+    if (session == stateSessions.end()) {
+        std::vector<InferenceEngine::IVariableStateInternal::Ptr> states;
+        for (const auto& state : memoryStates) {
+            states.emplace_back(new MKLDNNVariableState(state->GetName(), state->GetState()->getTensorDesc()));
+        }
+        session = stateSessions.emplace(sessionId, std::move(states)).first;
+    }
+    memoryStates = session->second;
+    stateSessionId = sessionId;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::ReleaseStateSession(size_t sessionId) {
+    if (sessionId == stateSessionId)
+        IE_THROW() << "Cannot release variable state session " << sessionId << " selected for the infer request";
+    stateSessions.erase(sessionId);
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::SetAsyncRequest(MKLDNNAsyncInferRequest* asyncRequest) {
     _asyncRequest = asyncRequest;
 }
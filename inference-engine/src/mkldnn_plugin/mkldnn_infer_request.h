@@ -5,14 +5,16 @@
 #pragma once
 
 #include "mkldnn_graph.h"
+#include "mkldnn_exec_network.h"
 #include <memory>
 #include <string>
 #include <map>
+#include <set>
+#include <ie_compound_blob.h>
 #include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
 
 namespace MKLDNNPlugin {
 
-class MKLDNNExecNetwork;
 class MKLDNNAsyncInferRequest;
 
 class MKLDNNInferRequest : public InferenceEngine::InferRequestInternal {
@@ -34,8 +36,14 @@ public:
 
     void SetBatch(int batch = -1) override;
 
+    void checkBlobs() override;
+
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> QueryState() override;
 
+    void SetStateSession(size_t sessionId) override;
+
+    void ReleaseStateSession(size_t sessionId) override;
+
     /**
      * @brief      Sets the pointer to asynchronous inference request that holds this request
      * @param[in]  asyncRequest Pointer to asynchronous inference request
@@ -47,6 +55,14 @@ public:
      */
     void ThrowIfCanceled() const;
 
+    uint32_t GetRequestId() const {
+        return requestId;
+    }
+
+    MKLDNNTracer* GetTracer() const {
+        return execNetwork->_tracer.get();
+    }
+
 private:
     void PushInputData();
     void PushStates();
@@ -55,11 +71,34 @@ private:
     void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
 
     void changeDefaultPtr();
+
+    /**
+     * @brief Sets input given as separately allocated batch items. Items placed one after another are used
+     * as a single contiguous input, otherwise each item is pushed to the input memory of the graph.
+     */
+    void setBatchedBlob(const std::string& name, const InferenceEngine::InputInfo::Ptr& foundInput,
+                        const InferenceEngine::BatchedBlob::Ptr& data);
+
+    /**
+     * @brief Returns input shapes of the set input blobs if they differ from the network ones, empty map otherwise
+     */
+    MKLDNNExecNetwork::InputShapes getReshapedInputShapes() const;
+    void reallocateOutputs();
+
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     MKLDNNGraph*                        graph = nullptr;
+    // keeps graph compiled for reshaped inputs alive while the request uses it
+    MKLDNNExecNetwork::ShapeGraphs::Ptr shapeGraphs;
     std::map<std::string, void*>        externalPtr;
+    // outputs set by SetBlob are kept on reshape, other outputs are reallocated for the new dimensions
+    std::set<std::string>               userOutputs;
+    std::map<std::string, InferenceEngine::BatchedBlob::Ptr> batchedInputs;
     openvino::itt::handle_t             profilingTask;
+    uint32_t                            requestId = 0;
+    // states of the selected session
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> memoryStates;
+    std::map<size_t, std::vector<InferenceEngine::IVariableStateInternal::Ptr>> stateSessions;
+    size_t                              stateSessionId = 0;
     MKLDNNAsyncInferRequest*            _asyncRequest = nullptr;
 };
 }  // namespace MKLDNNPlugin
@@ -11,6 +11,7 @@
 #include <utility>
 
 #include "utils/general_utils.h"
+#include "utils/primitive_cache.h"
 
 #include <mkldnn_types.h>
 #include <dnnl_types.h>
@@ -99,12 +100,12 @@ void MKLDNNMemory::reorderData(const MKLDNNMemory &input, const MKLDNNMemory &ou
         auto copySize = size == 0 ? output.GetSize() : size;
         cpu_memcpy(dstPtr, srcPtr, copySize);
     } else {
-        std::unique_ptr<mkldnn::reorder> pReorder;
+        std::shared_ptr<mkldnn::primitive> pReorder;
         std::shared_ptr<memory> srcMemoryPtr;
         std::vector<uint8_t> tmpBuff;
 
         try {
-            pReorder = std::unique_ptr<mkldnn::reorder>(new mkldnn::reorder(input.GetPrimitive(), output.GetPrimitive()));
+            pReorder = PrimitiveCache::getInstance().getOrCreate(mkldnn::reorder::primitive_desc(input.GetPrimitive(), output.GetPrimitive()));
             srcMemoryPtr = input.prim;
         }
         catch (const mkldnn::error& err) {
@@ -120,7 +121,7 @@ void MKLDNNMemory::reorderData(const MKLDNNMemory &input, const MKLDNNMemory &ou
                 MKLDNNMemory tmpMem(output.eng);
                 tmpMem.Create(input.GetDims(), output.GetDataType(), input.GetDesc().getFormat(), tmpBuff.data());
 
-                pReorder = std::unique_ptr<mkldnn::reorder>(new mkldnn::reorder(tmpMem.GetPrimitive(), output.GetPrimitive()));
+                pReorder = PrimitiveCache::getInstance().getOrCreate(mkldnn::reorder::primitive_desc(tmpMem.GetPrimitive(), output.GetPrimitive()));
                 srcMemoryPtr = tmpMem.prim;
             } else {
                 throw;
@@ -128,7 +129,7 @@ void MKLDNNMemory::reorderData(const MKLDNNMemory &input, const MKLDNNMemory &ou
         }
         if (pReorder) {
             mkldnn::stream loc_stream(output.eng, stream::flags::default_order);
-            pReorder->execute(loc_stream, *srcMemoryPtr, *output.prim);
+            pReorder->execute(loc_stream, {{DNNL_ARG_SRC, *srcMemoryPtr}, {DNNL_ARG_DST, *output.prim}});
         } else {
             IE_THROW() << "Could not make mkldnn reorder.";
         }
@@ -6,10 +6,23 @@
 #include "mkldnn_extension_utils.h"
 #include "blob_factory.hpp"
 
+#include <cstring>
+#include <utility>
+
 using namespace InferenceEngine;
 
 namespace MKLDNNPlugin {
 
+MKLDNNVariableState::MKLDNNVariableState(std::string name, const TensorDesc& desc) :
+        name(name) {
+    storage = make_blob_with_precision(desc);
+    storage->allocate();
+    next = make_blob_with_precision(desc);
+    next->allocate();
+    // default state is zero filled
+    Reset();
+}
+
 std::string  MKLDNNVariableState::GetName() const {
     return name;
 }
@@ -19,11 +32,26 @@ void  MKLDNNVariableState::Reset() {
 }
 
 void  MKLDNNVariableState::SetState(Blob::Ptr newState) {
-    storage = newState;
+    if (newState->byteSize() != storage->byteSize())
+        IE_THROW() << "Cannot set state " << name << ": the blob has " << newState->byteSize()
+                   << " bytes while the state has " << storage->byteSize();
+    cpu_memcpy(storage->buffer(), newState->cbuffer(), storage->byteSize());
 }
 
 InferenceEngine::Blob::CPtr MKLDNNVariableState::GetState() const {
     return storage;
 }
 
+void* MKLDNNVariableState::GetReadBuffer() {
+    return storage->buffer();
+}
+
+void* MKLDNNVariableState::GetWriteBuffer() {
+    return next->buffer();
+}
+
+void MKLDNNVariableState::Commit() {
+    std::swap(storage, next);
+}
+
 }  // namespace MKLDNNPlugin
@@ -16,20 +16,35 @@ namespace MKLDNNPlugin {
 class MKLDNNVariableState : public InferenceEngine::IVariableStateInternal {
 public:
     MKLDNNVariableState(std::string name, MKLDNNMemoryPtr storage) :
-            name(name) {
-        this->storage = make_blob_with_precision(MKLDNNMemoryDesc(storage->GetDescriptor()));
-        this->storage->allocate();
-        cpu_memcpy(this->storage->buffer(), storage->GetData(), storage->GetSize());
-    }
+            MKLDNNVariableState(name, MKLDNNMemoryDesc(storage->GetDescriptor())) {}
+
+    MKLDNNVariableState(std::string name, const InferenceEngine::TensorDesc& desc);
 
     std::string GetName() const override;
     void Reset() override;
     void SetState(InferenceEngine::Blob::Ptr newState) override;
     InferenceEngine::Blob::CPtr GetState() const override;
 
+    /**
+     * @brief Buffer the state is read from during inference
+     */
+    void* GetReadBuffer();
+
+    /**
+     * @brief Buffer the new state is written to during inference, so reading and writing of the state
+     * do not depend on the execution order of ReadValue and Assign
+     */
+    void* GetWriteBuffer();
+
+    /**
+     * @brief Makes the state written by the last inference the current one
+     */
+    void Commit();
+
 private:
     std::string name;
     InferenceEngine::Blob::Ptr storage;
+    InferenceEngine::Blob::Ptr next;
 };
 
-}  // namespace MKLDNNPlugin
\ No newline at end of file
+}  // namespace MKLDNNPlugin
@@ -408,6 +408,7 @@ std::string MKLDNNNode::getPrimitiveDescriptorType() {
     SEARCH_TYPE(uni);
 
     SEARCH_TYPE(winograd);
+    SEARCH_TYPE(sparse);
     SEARCH_TYPE(_dw);
     SEARCH_TYPE(_1x1);
 
@@ -508,6 +509,26 @@ void MKLDNNNode::execute(mkldnn::stream strm) {
     }
 }
 
+void MKLDNNNode::executeBatchItems(mkldnn::stream strm, const std::vector<const void*>& items) {
+    // the primitive processes a smaller batch the same way as with dynamic batch
+    auto itemMemory = [](const mkldnn::memory& memory, const void* ptr) {
+        mkldnn::memory::desc desc(memory.get_desc());
+        desc.data.dims[0] = 1;
+        desc.data.padded_dims[0] = 1;
+        return mkldnn::memory(desc, memory.get_engine(), const_cast<void*>(ptr));
+    };
+
+    const auto& dstDesc = getChildEdgeAt(0)->getDesc();
+    const size_t itemStride = dstDesc.getBlockingDesc().getStrides()[0] * dstDesc.getPrecision().size();
+    const auto* dstPtr = static_cast<const uint8_t*>(primArgs.at(DNNL_ARG_DST).get_data_handle());
+    auto args = primArgs;
+    for (size_t i = 0; i < items.size(); i++) {
+        args[DNNL_ARG_SRC] = itemMemory(primArgs.at(DNNL_ARG_SRC), items[i]);
+        args[DNNL_ARG_DST] = itemMemory(primArgs.at(DNNL_ARG_DST), dstPtr + i * itemStride);
+        (*prim).execute(strm, args);
+    }
+}
+
 void MKLDNNNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
@@ -332,6 +332,10 @@ public:
 
     bool isInplace() const;
 
+    const std::vector<MKLDNNMemoryPtr>& getInternalBlobMemory() const {
+        return internalBlobMemory;
+    }
+
     bool isFusedWith(Type type) const;
 
     void fuseWith(const MKLDNNNodePtr &fuse) {
@@ -405,6 +409,20 @@ public:
 
     void resolveNotAllocatedEdges();
     virtual void execute(mkldnn::stream strm);
+
+    /**
+     * @brief Checks that the node can read batch items of its only input from separate buffers, see executeBatchItems
+     */
+    virtual bool canExecuteBatchItems() {
+        return false;
+    }
+
+    /**
+     * @brief Executes the node for each batch item separately, the items of the input are read through the pointer table
+     * and the results are written to their batch slices of the output memory
+     * @param items Pointers to the input batch items, each item has the layout of the input memory with batch 1
+     */
+    virtual void executeBatchItems(mkldnn::stream strm, const std::vector<const void*>& items);
     virtual void initSupportedPrimitiveDescriptors();
 
     /**
@@ -7,6 +7,7 @@
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_weights_cache.hpp"
 #include "mkldnn_itt.h"
+#include "utils/primitive_cache.h"
 
 #include <legacy/net_pass.h>
 #include <threading/ie_executor_manager.hpp>
@@ -120,10 +121,10 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
     const bool useLpt =
         (conf.lpTransformsMode == Config::LPTransformsMode::On) &&
         ngraph::pass::low_precision::LowPrecisionTransformer::isFunctionQuantized(nGraphFunc);
-    if (useLpt) {
-        manager.register_pass<ngraph::pass::DisableConvertConstantFoldingOnConstPath>(
-            std::vector<ngraph::element::Type>{ ngraph::element::i8, ngraph::element::u8, ngraph::element::i4, ngraph::element::u4 });
-    }
+    // Without LPT constant folding is disabled only for compressed MatMul weights (see callback below)
+    // so FullyConnected node can execute them without decompression to FP32
+    manager.register_pass<ngraph::pass::DisableConvertConstantFoldingOnConstPath>(
+        std::vector<ngraph::element::Type>{ ngraph::element::i8, ngraph::element::u8, ngraph::element::i4, ngraph::element::u4 });
 
     // WA: ConvertPriorBox must be executed before the 1st ConstantFolding pass
     manager.register_pass<ngraph::pass::ConvertPriorBox>();
@@ -257,6 +258,70 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
                 return true;
             });
 
+    // Compressed weights are executed by FullyConnected node for FP32 activations only
+    const bool enforceBF16 = conf.enforceBF16 && with_cpu_x86_avx512_core();
+
+    // Checks that eltwise has the decompression constant (scale or zero point) on the second input and the constant
+    // is per tensor or per output channel and is not shared with other operations
+    auto hasPerChannelConst = [](const std::shared_ptr<const ngraph::Node> &eltwise, size_t OC) -> bool {
+        auto constant = std::dynamic_pointer_cast<const ngraph::opset1::Constant>(eltwise->get_input_node_shared_ptr(1));
+        if (!constant || constant->output(0).get_target_inputs().size() != 1)
+            return false;
+        const auto shape = constant->get_output_shape(0);
+        const auto size = ngraph::shape_size(shape);
+        return size == 1 || (size == OC && shape.size() == 2 && shape[0] == OC);
+    };
+
+    // Checks that Multiply is the last operation of compressed weights decompression subgraph which FullyConnected
+    // node executes without decompression to FP32 (see MKLDNNGraphOptimizer::FuseFullyConnectedAndWeightsDecompression):
+    // Constant -> Convert -> [Subtract|Add] -> Multiply(DEQUANTIZATION) -> MatMul
+    auto isMatMulWeightsDecompression = [enforceBF16, hasPerChannelConst](const std::shared_ptr<const ngraph::Node> &multiply) -> bool {
+        if (enforceBF16 || !ngraph::is_type<ngraph::opset1::Multiply>(multiply) || multiply->get_rt_info().count("DEQUANTIZATION") == 0)
+            return false;
+        const auto consumers = multiply->output(0).get_target_inputs();
+        if (consumers.size() != 1 || consumers.begin()->get_index() != 1)
+            return false;
+        const auto matMul = ngraph::as_type<const ngraph::opset1::MatMul>(consumers.begin()->get_node());
+        // weights which need Transpose or activations of other rank are decompressed by constant folding
+        if (!matMul || !matMul->get_transpose_b() || matMul->get_input_element_type(0) != ngraph::element::f32 ||
+            matMul->get_input_partial_shape(0).rank().is_dynamic() || multiply->get_output_partial_shape(0).is_dynamic())
+            return false;
+        const auto weightsShape = multiply->get_output_shape(0);
+        const auto inputRank = matMul->get_input_partial_shape(0).rank().get_length();
+        if (weightsShape.size() != 2 || (inputRank != 2 && inputRank != 3) || !hasPerChannelConst(multiply, weightsShape[0]))
+            return false;
+
+        const auto shift = multiply->get_input_node_shared_ptr(0);
+        if (ngraph::is_type<ngraph::opset1::Subtract>(shift) || ngraph::is_type<ngraph::opset1::Add>(shift))
+            return shift->output(0).get_target_inputs().size() == 1 && hasPerChannelConst(shift, weightsShape[0]);
+        return true;
+    };
+
+    pass_config->set_callback<ngraph::pass::DisableConvertConstantFoldingOnConstPath>(
+            [useLpt, isMatMulWeightsDecompression](const_node_ptr &node) -> bool {
+                if (useLpt)
+                    return false;
+                // every consumer on the path to MatMul must belong to the decompression subgraph,
+                // otherwise Convert is folded and FullyConnected gets constant FP32 weights
+                auto consumers = node->output(0).get_target_inputs();
+                if (consumers.size() != 1 || consumers.begin()->get_index() != 0)
+                    return true;
+                auto child = consumers.begin()->get_node()->shared_from_this();
+                if (ngraph::is_type<ngraph::opset1::Subtract>(child) || ngraph::is_type<ngraph::opset1::Add>(child)) {
+                    consumers = child->output(0).get_target_inputs();
+                    if (consumers.size() != 1 || consumers.begin()->get_index() != 0)
+                        return true;
+                    child = consumers.begin()->get_node()->shared_from_this();
+                }
+                return !isMatMulWeightsDecompression(child);
+            });
+
+    // Keep weights decompression subgraph for compressed weights execution in FullyConnected node
+    pass_config->set_callback<ngraph::pass::AddMultiplyFusion>(
+            [isMatMulWeightsDecompression](const_node_ptr &node) -> bool {
+                return isMatMulWeightsDecompression(node);
+            });
+
     pass_config->set_callback<ngraph::pass::MVN6Decomposition>(
             [](const_node_ptr &node) -> bool {
                 return MKLDNNMVNNode::checkAxesSuitability(node);
@@ -376,6 +441,39 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
     }
 }
 
+static CNNNetwork PrepareNetwork(const CNNNetwork& network, const Config& conf) {
+    CNNNetwork clonedNetwork = InferenceEngine::cloneNetwork(network);
+
+    bool is_transformed = false;
+    if (clonedNetwork.getFunction()) {
+        Transformation(clonedNetwork, conf);
+        is_transformed = true;
+    }
+    IE_SUPPRESS_DEPRECATED_START
+    auto icnnnet = static_cast<ICNNNetwork::Ptr>(clonedNetwork);
+    IE_SUPPRESS_DEPRECATED_END
+    auto implNetwork = std::dynamic_pointer_cast<details::CNNNetworkImpl>(icnnnet);
+    if (implNetwork) {
+        OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "CNNNet_based_ConstFolding");
+        // valid for CNNNetworkImpl only, while there's no API in ICNNNetwork to change network
+        ConstTransformer transformator(implNetwork.get());
+        transformator.fullTrim();
+        if (!is_transformed) {
+            InferenceEngine::CNNNetwork implNetworkWrapper(implNetwork);
+            NetPass::ConvertPrecision(implNetworkWrapper, Precision::I64, Precision::I32);
+            NetPass::ConvertPrecision(implNetworkWrapper, Precision::U64, Precision::I32);
+            NetPass::ConvertPrecision(implNetworkWrapper, Precision::U32, Precision::I32);
+            NetPass::ConvertPrecision(implNetworkWrapper, Precision::FP64, Precision::FP32);
+            NetPass::ConvertPrecision(implNetworkWrapper, Precision::FP16, Precision::FP32);
+            NetPass::ConvertPrecision(implNetworkWrapper, Precision::BOOL, Precision::U8);
+            NetPass::ConvertPrecision(implNetworkWrapper, Precision::U16, Precision::I32);
+            NetPass::ConvertPrecision(implNetworkWrapper, Precision::I16, Precision::I32);
+        }
+    }
+
+    return clonedNetwork;
+}
+
 InferenceEngine::ExecutableNetworkInternal::Ptr
 Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std::map<std::string, std::string> &config) {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::LoadExeNetworkImpl");
@@ -404,46 +502,38 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
     // TODO: Clarify the behavior of SetConfig method. Skip eng_config or not?
     Config conf = engConfig;
     conf.readProperties(config);
+    // primitive cache is shared by all networks in the process, so the capacity passed to LoadNetwork applies to all of them
+    if (config.count(PluginConfigParams::KEY_CPU_RUNTIME_CACHE_CAPACITY))
+        PrimitiveCache::getInstance().setCapacity(conf.runtimeCacheCapacity);
 
     if (conf.enableDynamicBatch) {
         conf.batchLimit = static_cast<int>(network.getBatchSize());
     }
 
-    CNNNetwork clonedNetwork = InferenceEngine::cloneNetwork(network);
-
-    bool is_transformed = false;
-    if (clonedNetwork.getFunction()) {
-        Transformation(clonedNetwork, conf);
-        is_transformed = true;
-    }
-    IE_SUPPRESS_DEPRECATED_START
-    auto icnnnet = static_cast<ICNNNetwork::Ptr>(clonedNetwork);
-    IE_SUPPRESS_DEPRECATED_END
-    auto implNetwork = std::dynamic_pointer_cast<details::CNNNetworkImpl>(icnnnet);
-    if (implNetwork) {
-        OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "CNNNet_based_ConstFolding");
-        // valid for CNNNetworkImpl only, while there's no API in ICNNNetwork to change network
-        ConstTransformer transformator(implNetwork.get());
-        transformator.fullTrim();
-        if (!is_transformed) {
-            InferenceEngine::CNNNetwork implNetworkWrapper(implNetwork);
-            NetPass::ConvertPrecision(implNetworkWrapper, Precision::I64, Precision::I32);
-            NetPass::ConvertPrecision(implNetworkWrapper, Precision::U64, Precision::I32);
-            NetPass::ConvertPrecision(implNetworkWrapper, Precision::U32, Precision::I32);
-            NetPass::ConvertPrecision(implNetworkWrapper, Precision::FP64, Precision::FP32);
-            NetPass::ConvertPrecision(implNetworkWrapper, Precision::FP16, Precision::FP32);
-            NetPass::ConvertPrecision(implNetworkWrapper, Precision::BOOL, Precision::U8);
-            NetPass::ConvertPrecision(implNetworkWrapper, Precision::U16, Precision::I32);
-            NetPass::ConvertPrecision(implNetworkWrapper, Precision::I16, Precision::I32);
-        }
+    MKLDNNExecNetwork::ReshapeFunction reshapeNetwork;
+    if (conf.shapesCacheCapacity > 0) {
+        if (conf.batchLimit > 0)
+            IE_THROW() << "Reshaping at inference time cannot be used together with dynamic batch";
+        if (!network.getFunction())
+            IE_THROW(NotImplemented) << "Reshaping at inference time is supported only for nGraph based networks";
+
+        CNNNetwork originalNetwork = InferenceEngine::cloneNetwork(network);
+        reshapeNetwork = [originalNetwork, conf](const MKLDNNExecNetwork::InputShapes& inputShapes) {
+            CNNNetwork reshapedNetwork = InferenceEngine::cloneNetwork(originalNetwork);
+            reshapedNetwork.reshape(inputShapes);
+            return PrepareNetwork(reshapedNetwork, conf);
+        };
     }
 
-    return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing);
+    return std::make_shared<MKLDNNExecNetwork>(PrepareNetwork(network, conf), conf, extensionManager, weightsSharing,
+                                               reshapeNetwork);
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
     // accumulate config parameters on engine level
     engConfig.readProperties(config);
+    if (config.count(PluginConfigParams::KEY_CPU_RUNTIME_CACHE_CAPACITY))
+        PrimitiveCache::getInstance().setCapacity(engConfig.runtimeCacheCapacity);
 }
 
 Parameter Engine::GetConfig(const std::string& name, const std::map<std::string, Parameter>& /*options*/) const {
@@ -515,6 +605,7 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         capabilities.push_back(METRIC_VALUE(FP16));
         capabilities.push_back(METRIC_VALUE(INT8));
         capabilities.push_back(METRIC_VALUE(BIN));
+        capabilities.push_back(METRIC_VALUE(BATCHED_BLOB));
         IE_SET_METRIC_RETURN(OPTIMIZATION_CAPABILITIES, capabilities);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -0,0 +1,90 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_tracer.h"
+
+#include <algorithm>
+#include <cstdio>
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+uint32_t currentThreadId() {
+    static std::atomic<uint32_t> nextThreadId = {0};
+    thread_local uint32_t threadId = nextThreadId++;
+    return threadId;
+}
+
+void writeEscaped(std::ostream& os, const std::string& str) {
+    for (auto c : str) {
+        switch (c) {
+            case '"':  os << "\\\""; break;
+            case '\\': os << "\\\\"; break;
+            case '\n': os << "\\n"; break;
+            case '\t': os << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char buf[8];
+                    snprintf(buf, sizeof(buf), "\\u%04x", c);
+                    os << buf;
+                } else {
+                    os << c;
+                }
+        }
+    }
+}
+
+const char* categoryName(MKLDNNTracer::Category category) {
+    switch (category) {
+        case MKLDNNTracer::Node:      return "node";
+        case MKLDNNTracer::Inference: return "inference";
+        case MKLDNNTracer::Pipeline:  return "pipeline";
+        default:                      return "unknown";
+    }
+}
+
+}  // namespace
+
+MKLDNNTracer::MKLDNNTracer(size_t capacity) : origin(std::chrono::steady_clock::now()), events(std::max<size_t>(capacity, 1)) {
+    for (auto name : {"Preprocessing", "PushInputData", "Infer", "PullOutputData"})
+        RegisterName(name);
+}
+
+uint32_t MKLDNNTracer::RegisterName(const std::string& name) {
+    std::lock_guard<std::mutex> lock(namesMutex);
+    auto it = nameIds.find(name);
+    if (it != nameIds.end())
+        return it->second;
+    auto id = static_cast<uint32_t>(names.size());
+    names.push_back(name);
+    nameIds.emplace(name, id);
+    return id;
+}
+
+void MKLDNNTracer::Record(Category category, uint32_t nameId, int streamId, uint32_t requestId, int64_t begin, int64_t end) {
+    auto idx = nextEvent.fetch_add(1, std::memory_order_relaxed);
+    events[idx % events.size()] = {begin, end, nameId, requestId, currentThreadId(), streamId, category};
+}
+
+void MKLDNNTracer::Export(std::ostream& os) const {
+    const uint64_t recorded = nextEvent.load();
+    const uint64_t count = std::min<uint64_t>(recorded, events.size());
+
+    std::lock_guard<std::mutex> lock(namesMutex);
+    os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    for (uint64_t i = recorded - count; i < recorded; i++) {
+        const auto& event = events[i % events.size()];
+        if (i != recorded - count)
+            os << ",";
+        os << "\n{\"name\":\"";
+        writeEscaped(os, event.nameId < names.size() ? names[event.nameId] : std::string());
+        os << "\",\"cat\":\"" << categoryName(event.category) << "\",\"ph\":\"X\",\"pid\":0"
+           << ",\"tid\":" << event.threadId
+           << ",\"ts\":" << event.begin / 1000 << "." << event.begin % 1000 / 100
+           << ",\"dur\":" << (event.end - event.begin) / 1000 << "." << (event.end - event.begin) % 1000 / 100
+           << ",\"args\":{\"stream\":" << event.streamId << ",\"request\":" << event.requestId << "}}";
+    }
+    os << "\n]}\n";
+}
@@ -0,0 +1,112 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Records begin and end timestamps of graph nodes and inference stages into a ring buffer
+ * and exports them as Chrome trace JSON (chrome://tracing, Perfetto UI).
+ * Names are registered upfront, so recording is lock free and does not allocate.
+ * When the ring buffer is full, the oldest events are overwritten.
+ */
+class MKLDNNTracer {
+public:
+    typedef std::shared_ptr<MKLDNNTracer> Ptr;
+
+    enum Category : uint8_t {
+        Node,
+        Inference,
+        Pipeline,
+    };
+
+    /**
+     * @brief Ids of the inference stage names, they are registered first
+     */
+    enum Stage : uint32_t {
+        Preprocessing,
+        PushInputData,
+        GraphInfer,
+        PullOutputData,
+    };
+
+    explicit MKLDNNTracer(size_t capacity = 1 << 20);
+
+    /**
+     * @brief Returns id of the event name, registering it if it is seen first time
+     */
+    uint32_t RegisterName(const std::string& name);
+
+    /**
+     * @brief Returns unique id for an infer request
+     */
+    uint32_t NextRequestId() { return nextRequestId++; }
+
+    int64_t Now() const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - origin).count();
+    }
+
+    void Record(Category category, uint32_t nameId, int streamId, uint32_t requestId, int64_t begin, int64_t end);
+
+    /**
+     * @brief Writes recorded events. Events recorded concurrently with export may be incomplete
+     */
+    void Export(std::ostream& os) const;
+
+private:
+    struct Event {
+        int64_t     begin;
+        int64_t     end;
+        uint32_t    nameId;
+        uint32_t    requestId;
+        uint32_t    threadId;
+        int32_t     streamId;
+        Category    category;
+    };
+
+    std::chrono::steady_clock::time_point   origin;
+    std::vector<Event>                      events;
+    std::atomic<uint64_t>                   nextEvent = {0};
+    std::atomic<uint32_t>                   nextRequestId = {0};
+
+    mutable std::mutex                      namesMutex;
+    std::vector<std::string>                names;
+    std::unordered_map<std::string, uint32_t> nameIds;
+};
+
+/**
+ * @brief Records an event for the scope lifetime, does nothing if tracer is not set
+ */
+class MKLDNNTraceScope {
+public:
+    MKLDNNTraceScope(MKLDNNTracer* tracer, MKLDNNTracer::Category category, uint32_t nameId, int streamId, uint32_t requestId)
+        : tracer(tracer), category(category), nameId(nameId), streamId(streamId), requestId(requestId),
+          begin(tracer ? tracer->Now() : 0) {}
+
+    ~MKLDNNTraceScope() {
+        if (tracer)
+            tracer->Record(category, nameId, streamId, requestId, begin, tracer->Now());
+    }
+
+private:
+    MKLDNNTracer* tracer;
+    MKLDNNTracer::Category category;
+    uint32_t nameId;
+    int streamId;
+    uint32_t requestId;
+    int64_t begin;
+};
+
+}  // namespace MKLDNNPlugin
@@ -5,6 +5,7 @@
 #include "mkldnn_batchnorm_node.h"
 #include <mkldnn_extension_utils.h>
 #include "common/cpu_memcpy.h"
+#include "utils/primitive_cache.h"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -140,7 +141,7 @@ void MKLDNNBatchNormalizationNode::createPrimitive() {
 
     auto prim_desc = createPrimitiveDescriptor<batch_normalization_forward::primitive_desc,
             batch_normalization_forward::desc>();
-    prim.reset(new batch_normalization_forward(prim_desc));
+    prim = PrimitiveCache::getInstance().getOrCreate(prim_desc);
 
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
@@ -22,6 +22,8 @@
 #include "mkldnn_eltwise_node.h"
 #include <limits>
 #include "common/cpu_memcpy.h"
+#include "utils/general_utils.h"
+#include "utils/primitive_cache.h"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -152,10 +154,16 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
         }
     }
 
-    if (axis != 1)
-        return;
+    auto addInPlaceDescriptor = [&](InferenceEngine::LayerConfig inPlaceConfig, memory::format_tag fmt) {
+        for (auto& inConf : inPlaceConfig.inConfs)
+            inConf.inPlace = 0;
+        supportedPrimitiveDescriptors.emplace_back(inPlaceConfig, impl_desc_type::unknown, fmt);
+    };
 
     auto numOfDim = static_cast<size_t>(dstDims.ndims());
+    // the batch can not be changed for inputs placed one after another along it
+    if (axis == 0)
+        config.dynBatchSupport = false;
 
     SizeVector order(numOfDim);
     SizeVector offsets(numOfDim, 0lu);
@@ -190,13 +198,17 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
                 SizeVector blkDims = parentEdge->getDims().ToSizeVector();
                 blkDims = { blkDims[0], blkDims[2], blkDims[3], blkDims[1] };
 
-                config.inConfs[i].inPlace = -1;     // Change to 0 here if inplace concat is supported for NHWC in mkldnn
+                config.inConfs[i].inPlace = -1;
 
                 config.inConfs[i].desc = TensorDesc(inputPrecision, parentEdge->getDims().ToSizeVector(),
                                                     {blkDims, order, offset, offsets, strides});
             }
 
-            supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::ref, mkldnn::memory::format_tag::nhwc);
+            if (axis == 1)
+                supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::ref, mkldnn::memory::format_tag::nhwc);
+            // Producers don't support strided channels, so inputs are placed in-place only as contiguous blocks
+            if (isAxisOutermost(blkDims, order, axis))
+                addInPlaceDescriptor(config, mkldnn::memory::format_tag::nhwc);
 
             return;
         } else if (numOfDim == 5) {
@@ -224,13 +236,17 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
                 SizeVector blkDims = parentEdge->getDims().ToSizeVector();
                 blkDims = { blkDims[0], blkDims[2], blkDims[3], blkDims[4], blkDims[1] };
 
-                config.inConfs[i].inPlace = -1;     // Change to 0 here if inplace concat is supported for NDHWC in mkldnn
+                config.inConfs[i].inPlace = -1;
 
                 config.inConfs[i].desc = TensorDesc(inputPrecision, parentEdge->getDims().ToSizeVector(),
                                                     {blkDims, order, offset, offsets, strides});
             }
 
-            supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::ref, mkldnn::memory::format_tag::ndhwc);
+            if (axis == 1)
+                supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::ref, mkldnn::memory::format_tag::ndhwc);
+            // Producers don't support strided channels, so inputs are placed in-place only as contiguous blocks
+            if (isAxisOutermost(blkDims, order, axis))
+                addInPlaceDescriptor(config, mkldnn::memory::format_tag::ndhwc);
 
             return;
         }
@@ -257,7 +273,8 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
                                             {parentEdge->getDims().ToSizeVector(), order, offset, offsets, strides});
     }
 
-    supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown, MKLDNNMemory::Convert(config.outConfs[0].desc.getLayout()));
+    if (isAxisOutermost(dstDims.ToSizeVector(), order, axis))
+        supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown, MKLDNNMemory::Convert(config.outConfs[0].desc.getLayout()));
 
     if (numOfDim == 4lu || numOfDim == 5lu) {
         size_t blkDimsLen = numOfDim + 1;
@@ -289,7 +306,7 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
                     MKLDNNExtensionUtils::DataTypeToIEPrecision(outputDataType),
                     dstDims.ToSizeVector(), {blkDims, order, offset, offsets, strides});
 
-            bool canInplace = true;
+            bool canInplace = isAxisOutermost(blkDims, order, axis);
             for (size_t i = 0lu; canInplace && i < getParentEdges().size(); i++) {
                 auto parentEdge = getParentEdgeAt(i);
                 blkDims = parentEdge->getDims().ToSizeVector();
@@ -502,7 +519,7 @@ void MKLDNNConcatNode::createPrimitive() {
     }
 
     auto primitive_desc = concat::primitive_desc(desc, static_cast<int>(axis), srcs_d, getEngine());
-    prim.reset(new concat(primitive_desc));
+    prim = PrimitiveCache::getInstance().getOrCreate(primitive_desc);
 }
 
 size_t MKLDNNConcatNode::inverseOrder(const SizeVector& order, size_t axis) {
@@ -582,18 +599,11 @@ void MKLDNNConcatNode::initOptimalPrimitiveDescriptor() {
                                                              });
         size_t axisSize = 1;
 
-        if (config.inConfs[0].desc.getLayout() == Layout::NHWC) {
-            // This is more general and works for any "direct" Layout (such as nchw or nhwc), but it doesn't work for nchw8c
-            size_t realAxis = inverseOrder(config.inConfs[0].desc.getBlockingDesc().getOrder(), axis);
-            for (size_t j = realAxis; j < config.inConfs[i].desc.getBlockingDesc().getBlockDims().size(); j++) {
-                size_t jj = config.inConfs[0].desc.getBlockingDesc().getOrder()[j];
-                axisSize *= config.inConfs[i].desc.getBlockingDesc().getBlockDims()[jj];
-            }
-        } else {
-            // This works for nchw and nchw8c/nchw16c
-            for (size_t j = axis; j < config.inConfs[i].desc.getBlockingDesc().getBlockDims().size(); j++) {
-                axisSize *= config.inConfs[i].desc.getBlockingDesc().getBlockDims()[j];
-            }
+        // Block dims are in the memory order, so the input occupies all block dims starting from the
+        // first position of the axis. This works for nchw, nhwc/ndhwc and nchw8c/nchw16c
+        size_t realAxis = inverseOrder(config.inConfs[0].desc.getBlockingDesc().getOrder(), axis);
+        for (size_t j = realAxis; j < config.inConfs[i].desc.getBlockingDesc().getBlockDims().size(); j++) {
+            axisSize *= config.inConfs[i].desc.getBlockingDesc().getBlockDims()[j];
         }
         offset += axisSize;
     }
@@ -609,7 +619,8 @@ void MKLDNNConcatNode::execute(mkldnn::stream strm) {
     const mkldnn::memory::data_type data_type = dst_memory.GetDataType();
     const size_t num_src = getParentEdges().size();
 
-    const bool isInt8 = (data_type == mkldnn_s8 || data_type == mkldnn_u8);
+    // channels are the last for int8, so the copy along other axes is done by the mkldnn primitive
+    const bool isInt8 = (data_type == mkldnn_s8 || data_type == mkldnn_u8) && axis == 1;
 
     if (isInt8) {
         uint8_t* dst_ptr = reinterpret_cast<uint8_t*>(dst_memory.GetData());
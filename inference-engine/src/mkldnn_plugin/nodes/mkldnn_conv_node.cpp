@@ -16,6 +16,7 @@
 #include <mkldnn_extension_utils.h>
 #include <legacy/ie_layers_internal.hpp>
 #include <utils/general_utils.h>
+#include <utils/primitive_cache.h>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -582,7 +583,12 @@ void MKLDNNConvolutionNode::createPrimitive() {
     auto prim_desc = createPrimitiveDescriptor<convolution_forward::primitive_desc,
             convolution_forward::desc>(attr);
 
-    prim.reset(new convolution_forward(prim_desc));
+    // zero points cannot be read back from the attributes
+    std::string attrKey;
+    appendPrimitiveCacheKey(attrKey, inputZeroPoints);
+    appendPrimitiveCacheKey(attrKey, weightsZeroPoints);
+    appendPrimitiveCacheKey(attrKey, outputCompensation);
+    prim = PrimitiveCache::getInstance().getOrCreate(prim_desc, attrKey);
 
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
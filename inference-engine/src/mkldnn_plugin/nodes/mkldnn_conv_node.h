@@ -32,6 +32,10 @@ public:
     bool canBeInPlace() const override {
         return false;
     }
+    bool canExecuteBatchItems() override {
+        // the fused depthwise convolution keeps intermediate rows of the whole batch
+        return !isFusedWith(Convolution);
+    }
 
     void setPostOps(mkldnn::primitive_attr &attr, bool initWeights);
 
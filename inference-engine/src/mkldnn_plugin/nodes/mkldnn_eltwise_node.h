@@ -131,6 +131,7 @@ public:
 
     float getAlpha() const { return alpha; }
     float getBeta() const { return beta; }
+    float getGamma() const { return gamma; }
 
     void appendPostOps(mkldnn::post_ops& ops) override;
 
@@ -9,9 +9,12 @@
 #include <legacy/ie_layers.h>
 #include <string>
 #include <vector>
+#include <algorithm>
 #include <mkldnn_extension_utils.h>
 #include <mkldnn.hpp>
+#include <ie_parallel.hpp>
 #include "utils/general_utils.h"
+#include "utils/primitive_cache.h"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -101,6 +104,11 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
                            << inDims.ndims() << " dims.";
     }
 
+    if (weightsCompressed || sparseWeights) {
+        withBiases = baseInputsNumber == 3;
+        return;
+    }
+
     if (inDims.ndims() == 3) {
         weightsDims = InferenceEngine::SizeVector({static_cast<size_t>(outDims[2]), static_cast<size_t>(inDims[2])});
     } else {
@@ -128,8 +136,72 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     }
 }
 
+void MKLDNNFullyConnectedNode::initSupportedPrimitiveDescriptors() {
+    if (!weightsCompressed && !sparseWeights) {
+        MKLDNNNode::initSupportedPrimitiveDescriptors();
+        return;
+    }
+
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = true;
+
+    auto createDataConfig = [](const MKLDNNDims& dims, memory::data_type dataType) -> InferenceEngine::DataConfig {
+        InferenceEngine::DataConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = false;
+        dataConfig.desc = MKLDNNMemoryDesc(dims, dataType, MKLDNNMemory::GetPlainFormat(dims));
+        return dataConfig;
+    };
+
+    // weights are taken directly from the compressed constant, so its precision may differ from the original layer input
+    auto weightsPrecision = getParentEdgeAt(1)->getParent()->getCnnLayer()->outData[0]->getPrecision();
+    config.inConfs.push_back(createDataConfig(getParentEdgeAt(0)->getDims(), memory::data_type::f32));
+    config.inConfs.push_back(createDataConfig(getParentEdgeAt(1)->getDims(), MKLDNNExtensionUtils::IEPrecisionToDataType(weightsPrecision)));
+    if (withBiases)
+        config.inConfs.push_back(createDataConfig(getParentEdgeAt(2)->getDims(), memory::data_type::f32));
+    config.outConfs.push_back(createDataConfig(getChildEdgeAt(0)->getDims(), memory::data_type::f32));
+
+    supportedPrimitiveDescriptors.push_back(PrimitiveDescInfo(config, sparseWeights ? impl_desc_type::gemm_sparse : impl_desc_type::gemm_any,
+                                                              MKLDNNMemory::GetPlainFormat(getChildEdgeAt(0)->getDims())));
+}
+
+void MKLDNNFullyConnectedNode::setWeightsDecompression(const std::vector<float>& scales, const std::vector<float>& zeroPoints) {
+    weightsCompressed = true;
+    decompressionScales = scales;
+    decompressionZeroPoints = zeroPoints;
+}
+
+void MKLDNNFullyConnectedNode::setSparseWeights(const float* weights, size_t OC, size_t IC) {
+    sparseRowOffsets.resize(OC + 1);
+    sparseRowOffsets[0] = 0;
+    for (size_t oc = 0; oc < OC; oc++) {
+        const float* row = weights + oc * IC;
+        sparseRowOffsets[oc + 1] = sparseRowOffsets[oc] + (IC - std::count(row, row + IC, 0.f));
+    }
+
+    sparseValues.resize(sparseRowOffsets[OC]);
+    sparseColumns.resize(sparseRowOffsets[OC]);
+    parallel_for(OC, [&](size_t oc) {
+        const float* row = weights + oc * IC;
+        size_t idx = sparseRowOffsets[oc];
+        for (size_t ic = 0; ic < IC; ic++) {
+            if (row[ic] != 0.f) {
+                sparseValues[idx] = row[ic];
+                sparseColumns[idx] = static_cast<int32_t>(ic);
+                idx++;
+            }
+        }
+    });
+
+    sparseWeights = true;
+    sparsityRate = OC * IC ? 1.f - static_cast<float>(sparseValues.size()) / (OC * IC) : 0.f;
+}
+
 void MKLDNNFullyConnectedNode::createPrimitive() {
-    if (prim)
+    if (prim || weightsCompressed || sparseWeights)
         return;
 
     std::shared_ptr<mkldnn::primitive_attr> attr = initPrimitiveAttr();
@@ -137,7 +209,7 @@ void MKLDNNFullyConnectedNode::createPrimitive() {
     prim_desc = std::make_shared<inner_product_forward::primitive_desc>(
             createPrimitiveDescriptor<inner_product_forward::primitive_desc, inner_product_forward::desc>(*attr));
 
-    prim.reset(new inner_product_forward(*prim_desc));
+    prim = PrimitiveCache::getInstance().getOrCreate(*prim_desc);
 
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
@@ -147,7 +219,155 @@ void MKLDNNFullyConnectedNode::createPrimitive() {
         primArgs = {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, getWeights()}, {DNNL_ARG_DST, dst}};
 }
 
+namespace {
+
+// dst[m][n] = scale[n] * (sum_k(src[m][k] * w[n][k]) - zp[n] * sum_k(src[m][k])) + bias[n]
+// Weights are converted to f32 in registers only, so memory traffic is defined by compressed weights size.
+template <typename T>
+void executeDecompressedGemm(const float* src, const T* weights, const float* bias, float* dst,
+                             const std::vector<float>& scales, const std::vector<float>& zeroPoints,
+                             size_t M, size_t N, size_t K) {
+    std::vector<float> srcSums;
+    if (!zeroPoints.empty()) {
+        srcSums.resize(M);
+        parallel_for(M, [&](size_t m) {
+            float sum = 0.f;
+            for (size_t k = 0; k < K; k++)
+                sum += src[m * K + k];
+            srcSums[m] = sum;
+        });
+    }
+
+    parallel_for(N, [&](size_t n) {
+        constexpr size_t blockSize = 8;
+        const T* w = weights + n * K;
+        const float scale = scales[scales.size() == 1 ? 0 : n];
+        const float zeroPoint = zeroPoints.empty() ? 0.f : zeroPoints[zeroPoints.size() == 1 ? 0 : n];
+        const float shift = bias ? bias[n] : 0.f;
+
+        for (size_t m = 0; m < M; m++) {
+            const float* x = src + m * K;
+            // independent accumulators allow the compiler to vectorize the reduction
+            float acc[blockSize] = {};
+            size_t k = 0;
+            for (; k + blockSize <= K; k += blockSize) {
+                for (size_t i = 0; i < blockSize; i++)
+                    acc[i] += x[k + i] * static_cast<float>(w[k + i]);
+            }
+            float sum = 0.f;
+            for (; k < K; k++)
+                sum += x[k] * static_cast<float>(w[k]);
+            for (size_t i = 0; i < blockSize; i++)
+                sum += acc[i];
+
+            if (!srcSums.empty())
+                sum -= zeroPoint * srcSums[m];
+
+            dst[m * N + n] = scale * sum + shift;
+        }
+    });
+}
+
+}  // namespace
+
+void MKLDNNFullyConnectedNode::executeWithCompressedWeights() {
+    auto &srcMemory = getParentEdgeAt(0)->getMemory();
+    auto &weightsMemory = getParentEdgeAt(1)->getMemory();
+    auto &dstMemory = getChildEdgeAt(0)->getMemory();
+
+    const auto &inDims = getParentEdgeAt(0)->getDims();
+    const auto &wDims = getParentEdgeAt(1)->getDims();
+    const size_t N = wDims[0];
+    const size_t K = wDims[1];
+    const size_t M = inDims.ndims() == 3 ? batchToProcess() * inDims[1] : batchToProcess();
+
+    const auto *src = reinterpret_cast<const float *>(srcMemory.GetPtr());
+    const auto *bias = withBiases ? reinterpret_cast<const float *>(getParentEdgeAt(2)->getMemory().GetPtr()) : nullptr;
+    auto *dst = reinterpret_cast<float *>(dstMemory.GetPtr());
+
+    switch (weightsMemory.GetDataType()) {
+        case memory::data_type::u8:
+            executeDecompressedGemm(src, reinterpret_cast<const uint8_t *>(weightsMemory.GetPtr()), bias, dst,
+                                    decompressionScales, decompressionZeroPoints, M, N, K);
+            break;
+        case memory::data_type::s8:
+            executeDecompressedGemm(src, reinterpret_cast<const int8_t *>(weightsMemory.GetPtr()), bias, dst,
+                                    decompressionScales, decompressionZeroPoints, M, N, K);
+            break;
+        default:
+            IE_THROW() << "FullyConnected node with name '" << getName() << "' has unsupported compressed weights precision";
+    }
+}
+
+void MKLDNNFullyConnectedNode::executeWithSparseWeights() {
+    const auto &inDims = getParentEdgeAt(0)->getDims();
+    const size_t N = sparseRowOffsets.size() - 1;
+    const size_t K = inDims[inDims.ndims() - 1];
+    const size_t M = inDims.ndims() == 3 ? batchToProcess() * inDims[1] : batchToProcess();
+
+    const auto *src = reinterpret_cast<const float *>(getParentEdgeAt(0)->getMemory().GetPtr());
+    const auto *bias = withBiases ? reinterpret_cast<const float *>(getParentEdgeAt(2)->getMemory().GetPtr()) : nullptr;
+    auto *dst = reinterpret_cast<float *>(getChildEdgeAt(0)->getMemory().GetPtr());
+
+    // Source is transposed to [K, M], so every non-zero weight is multiplied by a contiguous source row
+    // and the accumulation over the batch is vectorized
+    const float *srcT = src;
+    if (M > 1) {
+        sparseSrcBuffer.resize(M * K);
+        parallel_for(K, [&](size_t k) {
+            for (size_t m = 0; m < M; m++)
+                sparseSrcBuffer[k * M + m] = src[m * K + k];
+        });
+        srcT = sparseSrcBuffer.data();
+    }
+
+    // dst[m][n] = sum_i(values[i] * src[m][columns[i]]) + bias[n], i in [rowOffsets[n], rowOffsets[n + 1])
+    parallel_for(N, [&](size_t n) {
+        constexpr size_t blockSize = 64;
+        const size_t begin = sparseRowOffsets[n];
+        const size_t end = sparseRowOffsets[n + 1];
+        const float shift = bias ? bias[n] : 0.f;
+
+        if (M == 1) {
+            // independent accumulators hide the latency of the gathered source values
+            float acc[4] = {};
+            size_t i = begin;
+            for (; i + 4 <= end; i += 4) {
+                for (size_t j = 0; j < 4; j++)
+                    acc[j] += sparseValues[i + j] * src[sparseColumns[i + j]];
+            }
+            for (; i < end; i++)
+                acc[0] += sparseValues[i] * src[sparseColumns[i]];
+            dst[n] = acc[0] + acc[1] + acc[2] + acc[3] + shift;
+            return;
+        }
+
+        for (size_t m0 = 0; m0 < M; m0 += blockSize) {
+            const size_t mb = std::min(blockSize, M - m0);
+            float acc[blockSize] = {};
+            for (size_t i = begin; i < end; i++) {
+                const float value = sparseValues[i];
+                const float *x = srcT + static_cast<size_t>(sparseColumns[i]) * M + m0;
+                for (size_t m = 0; m < mb; m++)
+                    acc[m] += value * x[m];
+            }
+            for (size_t m = 0; m < mb; m++)
+                dst[(m0 + m) * N + n] = acc[m] + shift;
+        }
+    });
+}
+
 void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
+    if (weightsCompressed) {
+        executeWithCompressedWeights();
+        return;
+    }
+
+    if (sparseWeights) {
+        executeWithSparseWeights();
+        return;
+    }
+
     if (prim) {
         auto reshapeMemory = [this](int argType) {
             auto param = primArgs.find(argType);
@@ -301,6 +521,9 @@ std::shared_ptr<mkldnn::primitive_attr> MKLDNNFullyConnectedNode::initPrimitiveA
 
 void MKLDNNFullyConnectedNode::createDescriptor(const std::vector<InferenceEngine::TensorDesc> &inputDesc,
                                                 const std::vector<InferenceEngine::TensorDesc> &outputDesc) {
+    if (weightsCompressed || sparseWeights)
+        return;
+
     TensorDesc inDesc = inputDesc[0], outDesc = outputDesc[0];
 
     mkldnn::memory::data_type wdt = MKLDNNExtensionUtils::IEPrecisionToDataType(inDesc.getPrecision());
@@ -19,6 +19,7 @@ public:
 
     std::vector<mkldnn::memory::format_tag> getAvailableFormatsForDims(const MKLDNNDims &dims) const override;
     void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
@@ -43,6 +44,23 @@ public:
 
     InferenceEngine::Precision getRuntimePrecision() const override;
 
+    // Switches the node to execution on compressed (u8/i8) weights which are decompressed on the fly
+    // as w = (w_compressed - zeroPoint) * scale. Scales and zero points are per output channel or per tensor.
+    void setWeightsDecompression(const std::vector<float>& scales, const std::vector<float>& zeroPoints);
+    bool isWeightsCompressed() const {
+        return weightsCompressed;
+    }
+
+    // Switches the node to execution on sparse weights: only non-zero weights of every output channel are kept
+    // (compressed sparse rows), so multiplications by zero weights are skipped.
+    void setSparseWeights(const float* weights, size_t OC, size_t IC);
+    bool isSparseWeights() const {
+        return sparseWeights;
+    }
+    float getSparsityRate() const {
+        return sparsityRate;
+    }
+
 protected:
     std::shared_ptr<mkldnn::primitive_attr> initPrimitiveAttr();
 
@@ -55,6 +73,19 @@ private:
 
     bool withBiases;
     int baseInputsNumber;
+
+    bool weightsCompressed = false;
+    std::vector<float> decompressionScales;
+    std::vector<float> decompressionZeroPoints;
+    void executeWithCompressedWeights();
+
+    bool sparseWeights = false;
+    float sparsityRate = 0.f;
+    std::vector<float> sparseValues;
+    std::vector<int32_t> sparseColumns;
+    std::vector<size_t> sparseRowOffsets;
+    std::vector<float> sparseSrcBuffer;
+    void executeWithSparseWeights();
 };
 
 }  // namespace MKLDNNPlugin
@@ -7,6 +7,7 @@
 #include <legacy/ie_layers.h>
 #include <string>
 #include <mkldnn_extension_utils.h>
+#include "utils/primitive_cache.h"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -52,7 +53,7 @@ void MKLDNNLrnNode::createPrimitive() {
 
     auto prim_desc = createPrimitiveDescriptor<lrn_forward::primitive_desc, lrn_forward::desc>();
 
-    prim.reset(new lrn_forward(prim_desc));
+    prim = PrimitiveCache::getInstance().getOrCreate(prim_desc);
 
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
@@ -51,7 +51,8 @@ void MKLDNNMemoryOutputNode::execute(mkldnn::stream strm)  {
 }
 
 MKLDNNMemoryInputNode::MKLDNNMemoryInputNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
-        : MKLDNNInputNode(layer, eng, cache), MKLDNNMemoryNode(layer), dataStore(new MKLDNNMemory{eng}) {
+        : MKLDNNInputNode(layer, eng, cache), MKLDNNMemoryNode(layer), dataStore(new MKLDNNMemory{eng}),
+          readStore(new MKLDNNMemory{eng}), writeStore(new MKLDNNMemory{eng}) {
     if (created()) {
         holder = MKLDNNMemoryNodeVirtualEdge::registerInput(this);
     }
@@ -65,6 +66,9 @@ void MKLDNNMemoryInputNode::createPrimitive() {
 
     // default memory state is zero filled
     dataStore->FillZero();
+
+    readStore->Create(mem_desc, dataStore->GetData());
+    writeStore->Create(mem_desc, dataStore->GetData());
 }
 
 /**
@@ -93,19 +97,24 @@ MKLDNNMemoryPtr MKLDNNMemoryInputNode::getStore() {
     return dataStore;
 }
 
+void MKLDNNMemoryInputNode::bindState(void* readPtr, void* writePtr) {
+    readStore->GetPrimitivePtr()->set_data_handle(readPtr ? readPtr : dataStore->GetData());
+    writeStore->GetPrimitivePtr()->set_data_handle(writePtr ? writePtr : dataStore->GetData());
+}
+
 void MKLDNNMemoryInputNode::storeState(const MKLDNNMemory &new_state) {
     // TODO: Should be next one call:
-    //           dataStore.SetData(new_state, false);
+    //           writeStore.SetData(new_state, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    simple_copy(*writeStore, new_state);
 }
 
 void MKLDNNMemoryInputNode::execute(mkldnn::stream strm) {
     auto dst_mem = getChildEdgeAt(0)->getMemory();
     // TODO: Should be simple call of:
-    //           dst_mem.SetData(dataStore, false);
+    //           dst_mem.SetData(readStore, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(dst_mem, *dataStore);
+    simple_copy(dst_mem, *readStore);
 }
 
 MKLDNNMemoryNodeVirtualEdge::Holder* MKLDNNMemoryNodeVirtualEdge::registerInput(MKLDNNMemoryInputNode * node) {
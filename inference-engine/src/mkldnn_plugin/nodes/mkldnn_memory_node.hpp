@@ -98,8 +98,17 @@ public:
     void setInputNode(MKLDNNNode* node) override {}
     void storeState(const MKLDNNMemory& mem);
     MKLDNNMemoryPtr getStore();
+
+    /**
+     * @brief Binds state buffers of an infer request: the state is read from readPtr and the new state is
+     * written to writePtr. nullptr binds the own storage of the node back.
+     */
+    void bindState(void* readPtr, void* writePtr);
  private:
     MKLDNNMemoryPtr dataStore;
+    // views of the bound state buffers
+    MKLDNNMemoryPtr readStore;
+    MKLDNNMemoryPtr writeStore;
     MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
@@ -15,6 +15,7 @@
 #include <mkldnn_extension_utils.h>
 #include <legacy/ie_layers_internal.hpp>
 #include <utils/general_utils.h>
+#include <utils/primitive_cache.h>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -136,7 +137,7 @@ void MKLDNNPoolingNode::createPrimitive() {
 
     auto prim_desc = createPrimitiveDescriptor<pooling_forward::primitive_desc, pooling_forward::desc>(attr);
 
-    prim.reset(new pooling_forward(prim_desc));
+    prim = PrimitiveCache::getInstance().getOrCreate(prim_desc);
 
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
@@ -28,6 +28,9 @@ public:
     bool canBeInPlace() const override {
         return false;
     }
+    bool canExecuteBatchItems() override {
+        return true;
+    }
 
 private:
     void setPostOps(mkldnn::primitive_attr &attr, bool initWeights = false);
@@ -10,6 +10,7 @@
 #include <mkldnn_extension_utils.h>
 #include "ie_parallel.hpp"
 #include "utils/general_utils.h"
+#include "utils/primitive_cache.h"
 #include <cpu/x64/cpu_isa_traits.hpp>
 
 using namespace mkldnn;
@@ -139,7 +140,7 @@ void MKLDNNReorderNode::createReorderPrimitive(const mkldnn::memory::desc &srcDe
         auto info = pd.impl_info_str();
         supportedPrimitiveDescriptors[0].setImplementationType(parse_impl_name(info));
 
-        prim.reset(new mkldnn::reorder(pd));
+        prim = PrimitiveCache::getInstance().getOrCreate(pd);
         return true;
     };
 
@@ -275,4 +276,32 @@ void MKLDNNReorderNode::setDynamicBatchLim(int lim) {
         createReorderPrimitive(src_d, src_data_hdl, dst_d, dst_data_hdl);
     }
 }
+
+bool MKLDNNReorderNode::canExecuteBatchItems() {
+    // the scales and the reinterpretation of planar data as grouped weights are not applied to single items
+    return prim && !_scales && src_blocked->GetDesc() == getParentEdgeAt(0)->getMemory().GetDesc();
+}
+
+void MKLDNNReorderNode::executeBatchItems(mkldnn::stream strm, const std::vector<const void*>& items) {
+    auto itemDesc = [](const MKLDNNMemoryPtr& memory) {
+        memory::desc desc = memory->GetDescriptor();
+        desc.data.dims[0] = 1;
+        desc.data.padded_dims[0] = 1;
+        return desc;
+    };
+    const auto srcDesc = itemDesc(src_blocked);
+    const auto dstDesc = itemDesc(dst_blocked);
+    if (!itemPrim)
+        itemPrim = PrimitiveCache::getInstance().getOrCreate(reorder::primitive_desc(getEngine(), srcDesc, getEngine(), dstDesc));
+
+    const auto& outDesc = getChildEdgeAt(0)->getDesc();
+    const size_t itemStride = outDesc.getBlockingDesc().getStrides()[0] * outDesc.getPrecision().size();
+    auto* dstPtr = static_cast<uint8_t*>(getChildEdgeAt(0)->getMemory().GetPrimitive().get_data_handle());
+    for (size_t i = 0; i < items.size(); i++) {
+        memory src(srcDesc, getEngine(), const_cast<void*>(items[i]));
+        memory dst(dstDesc, getEngine(), dstPtr + i * itemStride);
+        itemPrim->execute(strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    }
+}
+
 REG_MKLDNN_PRIM_FOR(MKLDNNReorderNode, Reorder);
@@ -33,8 +33,15 @@ public:
         this->isOptimized = isOptimized;
     }
 
+    bool getOptimized() const {
+        return isOptimized;
+    }
+
     void setDynamicBatchLim(int lim) override;
 
+    bool canExecuteBatchItems() override;
+    void executeBatchItems(mkldnn::stream strm, const std::vector<const void*>& items) override;
+
     bool canBeInPlace() const override {
         return false;
     }
@@ -53,6 +60,8 @@ private:
 
     MKLDNNMemoryPtr dst_blocked;
     MKLDNNMemoryPtr src_blocked;
+    // reorders one batch item, the reorder primitive is created for the fixed batch
+    std::shared_ptr<mkldnn::primitive> itemPrim;
 
     bool isOptimized = false;
     bool canUseOptimizedNspc2Ncsp = false;
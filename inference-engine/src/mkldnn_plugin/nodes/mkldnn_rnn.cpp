@@ -3,11 +3,17 @@
 //
 
 #include "mkldnn_rnn.h"
+#include "mkldnn_quantize_node.h"
 #include "mkldnn_extension_utils.h"
 
 #include "utils/general_utils.h"
+#include "utils/primitive_cache.h"
 #include "nodes/common/cpu_memcpy.h"
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <ie_parallel.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <string>
 #include <utility>
 
@@ -77,6 +83,45 @@ bool MKLDNNRNN::created() const {
     return getType() == (is_cell ? RNNCell : RNNSeq);
 }
 
+bool MKLDNNRNN::canFuseInputQuantize(const MKLDNNQuantizeNode* quantizeNode) const {
+    // u8s8 RNN kernels outperform f32 ones only with AVX-512 int8 support
+    if (!impl::cpu::x64::mayiuse(impl::cpu::x64::avx512_core))
+        return false;
+
+    auto cellLayer = std::dynamic_pointer_cast<RNNCellBase>(getCnnLayer());
+    if (!cellLayer || !one_of(cellLayer->cellType, RNNCellBase::LSTM, RNNCellBase::GRU) || cellLayer->clip != 0.0f)
+        return false;
+
+    if (quantizeNode->isBinarization() || quantizeNode->getLevels() != 256)
+        return false;
+
+    // the primitive supports only per tensor data quantization
+    for (auto params : {&quantizeNode->getCropLow(), &quantizeNode->getCropHigh(),
+                        &quantizeNode->getInputScale(), &quantizeNode->getInputShift(),
+                        &quantizeNode->getOutputScale(), &quantizeNode->getOutputShift()}) {
+        if (params->size() != 1)
+            return false;
+    }
+
+    // hidden state is quantized with the data parameters, so they have to represent its [-1, 1] range
+    const float outputScale = quantizeNode->getOutputScale()[0];
+    const float outputLow = quantizeNode->getOutputShift()[0];
+    return outputScale > 0.f && outputLow <= -1.f && outputLow + 255.f * outputScale >= 1.f;
+}
+
+void MKLDNNRNN::fuseInputQuantize(const MKLDNNQuantizeNode* quantizeNode) {
+    cropLow = quantizeNode->getCropLow()[0];
+    cropHigh = quantizeNode->getCropHigh()[0];
+    inputScale = quantizeNode->getInputScale()[0];
+    inputShift = quantizeNode->getInputShift()[0];
+
+    dataScale = 1.f / quantizeNode->getOutputScale()[0];
+    dataShift = -quantizeNode->getOutputShift()[0] * dataScale;
+
+    quantized = true;
+    addOriginalLayer(quantizeNode->getCnnLayer());
+}
+
 void MKLDNNRNN::getSupportedDescriptors() {
     if (is_cell)
         fillCellDesc();
@@ -312,6 +357,16 @@ void MKLDNNRNN::fillSeqDesc() {
 
 void MKLDNNRNN::createDescriptor(const std::vector<TensorDesc> &inputDesc,
                                  const std::vector<TensorDesc> &outputDesc) {
+    if (quantized) {
+        // External ports stay f32: data and hidden state are quantized by the node itself,
+        // weights are reordered to s8 layout chosen by the primitive.
+        in_data_d = {in_data_d.getDims(), memory::data_type::u8, memory::format_tag::tnc};
+        if (in_states_d[0])
+            in_states_d[0] = {in_states_d[0].getDims(), memory::data_type::u8, memory::format_tag::ldnc};
+        w_data_d  = {{L, D, DC, G, SC}, memory::data_type::s8, memory::format_tag::any};
+        w_state_d = {{L, D, SC, G, SC}, memory::data_type::s8, memory::format_tag::any};
+    }
+
     switch (cell_type) {
         case mkldnn::algorithm::vanilla_rnn: {
             MKLDNNDescriptor desc(std::shared_ptr<vanilla_rnn_forward::desc>(
@@ -402,18 +457,13 @@ void MKLDNNRNN::createPrimitive() {
             && getCnnLayer()->blobs["biases"]->getTensorDesc().getPrecision() != Precision::FP32)
         IE_THROW() << errorPrefix << " has invalid biases precision: " << getCnnLayer()->blobs["biases"]->getTensorDesc().getPrecision();
 
-    auto pd = descs[0].createPrimitiveDescriptorIterator(getEngine());
-
-    auto src_data_mem = getParentEdgeAt(0)->getMemoryPtr();
-    auto dst_data_mem = getChildEdgeAt(0)->getMemoryPtr();
-
-    // create weight blobs (data and state part)
+    // create weight blobs (data and state part) in plain f32 layout
     auto w_data_mem = std::make_shared<MKLDNNMemory>(getEngine());
-    w_data_mem->Create(w_data_d);
+    w_data_mem->Create(MKLDNNMemoryDesc{{L, D, DC, G, SC}, memory::data_type::f32, memory::format_tag::ldigo});
     internalBlobMemory.push_back(w_data_mem);
 
     auto w_state_mem = std::make_shared<MKLDNNMemory>(getEngine());
-    w_state_mem->Create(w_state_d);
+    w_state_mem->Create(MKLDNNMemoryDesc{{L, D, SC, G, SC}, memory::data_type::f32, memory::format_tag::ldigo});
     internalBlobMemory.push_back(w_state_mem);
 
     auto w_bias_mem = std::make_shared<MKLDNNMemory>(getEngine());
@@ -507,7 +557,81 @@ void MKLDNNRNN::createPrimitive() {
         }
     }
 
-    prim.reset(new mkldnn::primitive(pd));
+    mkldnn::primitive_attr attr;
+    if (quantized) {
+        initWeightsScales();
+        attr.set_rnn_data_qparams(dataScale, dataShift);
+        // scales are set per gate and output channel of ldigo weights
+        attr.set_rnn_weights_qparams((1 << 3) | (1 << 4), weightsScales);
+    }
+
+    auto pd = descs[0].createPrimitiveDescriptorIterator(getEngine(), attr);
+
+    if (quantized) {
+        quantizeWeights(pd, attr);
+
+        src_data_q_mem = std::make_shared<MKLDNNMemory>(getEngine());
+        src_data_q_mem->Create(in_data_d);
+        if (in_states_d[0]) {
+            src_state_q_mem = std::make_shared<MKLDNNMemory>(getEngine());
+            src_state_q_mem->Create(in_states_d[0]);
+        }
+    }
+
+    // quantization parameters cannot be read back from the attributes
+    std::string attrKey;
+    if (quantized) {
+        appendPrimitiveCacheKey(attrKey, std::vector<float>{dataScale, dataShift});
+        appendPrimitiveCacheKey(attrKey, weightsScales);
+    }
+    prim = PrimitiveCache::getInstance().getOrCreate(pd, attrKey);
+}
+
+void MKLDNNRNN::initWeightsScales() {
+    // symmetric s8 quantization of each gate output channel over both data and state weights
+    const auto w_ptr = static_cast<const float*>(internalBlobMemory[0]->GetData());
+    const auto r_ptr = static_cast<const float*>(internalBlobMemory[1]->GetData());
+    const ptrdiff_t step = G * SC;
+
+    weightsScales.assign(G * SC, 0.f);
+    parallel_for(G * SC, [&](ptrdiff_t go) {
+        float absMax = 0.f;
+        for (ptrdiff_t i = 0; i < DC; i++)
+            absMax = std::max(absMax, std::fabs(w_ptr[i * step + go]));
+        for (ptrdiff_t i = 0; i < SC; i++)
+            absMax = std::max(absMax, std::fabs(r_ptr[i * step + go]));
+        weightsScales[go] = absMax > 0.f ? 127.f / absMax : 1.f;
+    });
+}
+
+void MKLDNNRNN::quantizeWeights(const mkldnn::primitive_desc_iterator& pd, const mkldnn::primitive_attr& attr) {
+    mkldnn::stream loc_stream(getEngine(), stream::flags::default_order);
+    for (int i = 0; i < 2; i++) {
+        auto w_q_mem = std::make_shared<MKLDNNMemory>(getEngine());
+        w_q_mem->Create(pd.weights_desc(i));
+
+        auto reorder_pd = mkldnn::reorder::primitive_desc(internalBlobMemory[i]->GetPrimitive(), w_q_mem->GetPrimitive(), attr);
+        mkldnn::reorder(reorder_pd).execute(loc_stream, internalBlobMemory[i]->GetPrimitive(), w_q_mem->GetPrimitive());
+        internalBlobMemory[i] = w_q_mem;
+    }
+}
+
+void MKLDNNRNN::quantizeInputs() {
+    // external and internal descriptors have the same physical layout, so element order is preserved
+    const auto src_ptr = reinterpret_cast<const float*>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr());
+    auto src_q_ptr = reinterpret_cast<uint8_t*>(src_data_q_mem->GetPtr());
+    parallel_for(src_data_q_mem->GetElementsCount(), [&](size_t i) {
+        const float val = std::min(cropHigh, std::max(cropLow, src_ptr[i]));
+        src_q_ptr[i] = static_cast<uint8_t>(std::min(255.f, std::max(0.f, std::round(val * inputScale + inputShift))));
+    });
+
+    if (src_state_q_mem) {
+        const auto state_ptr = reinterpret_cast<const float*>(getParentEdgeAt(1)->getMemoryPtr()->GetPtr());
+        auto state_q_ptr = reinterpret_cast<uint8_t*>(src_state_q_mem->GetPtr());
+        parallel_for(src_state_q_mem->GetElementsCount(), [&](size_t i) {
+            state_q_ptr[i] = static_cast<uint8_t>(std::min(255.f, std::max(0.f, std::round(state_ptr[i] * dataScale + dataShift))));
+        });
+    }
 }
 
 void MKLDNNRNN::execute(mkldnn::stream strm) {
@@ -535,6 +659,13 @@ void MKLDNNRNN::execute(mkldnn::stream strm) {
         args[state_i_tags[s]] = getParentEdgeAt(s+1)->getMemoryPtr()->GetPrimitive();
     }
 
+    if (quantized) {
+        quantizeInputs();
+        args[DNNL_ARG_SRC_LAYER] = src_data_q_mem->GetPrimitive();
+        if (src_state_q_mem)
+            args[DNNL_ARG_SRC_ITER] = src_state_q_mem->GetPrimitive();
+    }
+
     if (is_cell) {
         for (size_t s = 0; s < S; s++) {
             args[state_o_tags[s]] = getChildEdgesAtPort(s)[0]->getMemoryPtr()->GetPrimitive();
@@ -12,6 +12,8 @@
 
 namespace MKLDNNPlugin {
 
+class MKLDNNQuantizeNode;
+
 class MKLDNNRNN : public MKLDNNNode {
 public:
     MKLDNNRNN(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
@@ -25,9 +27,19 @@ public:
 
     void execute(mkldnn::stream strm) override;
 
+    /**
+     * Checks that the per-tensor u8 FakeQuantize feeding the data input can be folded into
+     * the int8 RNN primitive (u8 data and hidden state, s8 weights, f32 output).
+     */
+    bool canFuseInputQuantize(const MKLDNNQuantizeNode* quantizeNode) const;
+    void fuseInputQuantize(const MKLDNNQuantizeNode* quantizeNode);
+
 private:
     void fillCellDesc();
     void fillSeqDesc();
+    void initWeightsScales();
+    void quantizeWeights(const mkldnn::primitive_desc_iterator& pd, const mkldnn::primitive_attr& attr);
+    void quantizeInputs();
 
 private:
     /** Specify mode Cell or Seq. true - Cell, false - Seq */
@@ -66,6 +78,23 @@ private:
     MKLDNNMemoryDesc w_state_d;
     MKLDNNMemoryDesc w_bias_d;
 
+    /** int8 execution: u8 = f32 * dataScale + dataShift for data and hidden state */
+    bool quantized = false;
+    float dataScale = 1.f;
+    float dataShift = 0.f;
+
+    /** Quantization of the input data as it was done by the fused FakeQuantize */
+    float cropLow = 0.f;
+    float cropHigh = 0.f;
+    float inputScale = 1.f;
+    float inputShift = 0.f;
+
+    /** Per gate and output channel scales of s8 weights */
+    std::vector<float> weightsScales;
+
+    MKLDNNMemoryPtr src_data_q_mem;
+    MKLDNNMemoryPtr src_state_q_mem;
+
     // List of in/out reorders if required
     std::vector<mkldnn::reorder> exec_before;
     std::vector<mkldnn::reorder> exec_after;
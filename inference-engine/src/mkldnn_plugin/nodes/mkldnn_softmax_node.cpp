@@ -8,6 +8,7 @@
 #include <string>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include "utils/primitive_cache.h"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -84,7 +85,7 @@ void MKLDNNSoftMaxNode::createPrimitive() {
             break;
     }
 
-    prim.reset(new softmax_forward(prim_desc));
+    prim = PrimitiveCache::getInstance().getOrCreate(prim_desc);
 
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
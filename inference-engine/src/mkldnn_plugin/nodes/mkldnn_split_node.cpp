@@ -4,8 +4,10 @@
 
 #include "mkldnn_split_node.h"
 #include "common/cpu_memcpy.h"
+#include "utils/general_utils.h"
 #include <legacy/ie_layers.h>
 #include <vector>
+#include <algorithm>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include <ie_parallel.hpp>
@@ -16,6 +18,10 @@ using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
+static size_t getAxisOrderPos(const SizeVector& order, size_t axis) {
+    return std::distance(order.begin(), std::find(order.begin(), order.end(), axis));
+}
+
 static TensorDesc makePlainTensorDesc(const Precision& precision, const SizeVector& srcDims) {
     SizeVector order(srcDims.size());
     std::iota(order.begin(), order.end(), 0);
@@ -179,8 +185,15 @@ void MKLDNNSplitNode::initSupportedPrimitiveDescriptors() {
 
     // Optimized inplace case
     std::vector<size_t> pdIndexesToReuse(1, 0); // at least the first plain layout can be optimized inplace.
-    if (axis < 2) {
-        pdIndexesToReuse.insert(pdIndexesToReuse.end(), blockedPdIndexes.begin(), blockedPdIndexes.end());
+    // per channel and blocked layouts are optimized only if outputs are contiguous blocks of the input
+    std::vector<size_t> layoutPdIndexes;
+    if (srcDims.ndims() > 2)
+        layoutPdIndexes.push_back(1);
+    layoutPdIndexes.insert(layoutPdIndexes.end(), blockedPdIndexes.begin(), blockedPdIndexes.end());
+    for (auto pdIndex : layoutPdIndexes) {
+        const auto& blkDesc = supportedPrimitiveDescriptors[pdIndex].getConfig().inConfs[0].desc.getBlockingDesc();
+        if (isAxisOutermost(blkDesc.getBlockDims(), blkDesc.getOrder(), axis))
+            pdIndexesToReuse.push_back(pdIndex);
     }
 
     for (auto refPdIndex : pdIndexesToReuse) {
@@ -196,9 +209,10 @@ void MKLDNNSplitNode::initSupportedPrimitiveDescriptors() {
         SizeVector strides(numOfDim);
         strides.back() = 1lu;
         size_t offset = (std::numeric_limits<size_t>::max)();
+        const size_t axisPos = getAxisOrderPos(order, axis);
 
         for (size_t i = 2; i <= numOfDim; i++) {
-            if (numOfDim - i < axis) {
+            if (numOfDim - i < axisPos) {
                 strides[numOfDim - i] = (std::numeric_limits<size_t>::max)();
             } else {
                 strides[numOfDim - i] = strides[numOfDim - i + 1] * blkDims[numOfDim - i + 1];
@@ -353,7 +367,8 @@ void MKLDNNSplitNode::initOptimalPrimitiveDescriptor() {
                                                                       config.inConfs[0].desc.getBlockingDesc().getStrides()
                                                               });
         size_t axisSize = 1;
-        for (size_t j = axis; j < config.outConfs[i].desc.getBlockingDesc().getBlockDims().size(); j++) {
+        const size_t axisPos = getAxisOrderPos(config.outConfs[i].desc.getBlockingDesc().getOrder(), axis);
+        for (size_t j = axisPos; j < config.outConfs[i].desc.getBlockingDesc().getBlockDims().size(); j++) {
             axisSize *= config.outConfs[i].desc.getBlockingDesc().getBlockDims()[j];
         }
         offset += axisSize;
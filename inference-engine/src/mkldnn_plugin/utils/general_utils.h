@@ -5,6 +5,8 @@
 #pragma once
 
 #include <cassert>
+#include <cstddef>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
@@ -39,5 +41,22 @@ constexpr inline bool implication(bool cause, bool cond) {
     return !cause || !!cond;
 }
 
+/**
+ * @brief Checks that no dimensions except the outermost one precede the axis in the memory order. Then the parts of
+ *        the memory along the axis (e.g. inputs of in-place Concat) are contiguous blocks, the outermost dimension
+ *        is handled through the strides
+ * @param blkDims blocked dimensions of the memory
+ * @param order order of the blocked dimensions
+ * @param axis logical axis
+ * @return true if the axis is outermost
+ */
+inline bool isAxisOutermost(const std::vector<std::size_t>& blkDims, const std::vector<std::size_t>& order, std::size_t axis) {
+    for (std::size_t i = 1; i < order.size() && order[0] != axis && order[i] != axis; i++) {
+        if (blkDims[i] != 1)
+            return false;
+    }
+    return true;
+}
+
 
 }  // namespace MKLDNNPlugin
\ No newline at end of file
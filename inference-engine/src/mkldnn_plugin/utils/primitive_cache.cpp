@@ -0,0 +1,182 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "primitive_cache.h"
+
+#include <ie_parallel.hpp>
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+thread_local PrimitiveCache::Statistic* currentStatistic = nullptr;
+
+template <typename T>
+void appendValue(std::string& key, const T& value) {
+    key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename OpDesc>
+void appendOpDesc(std::string& key, const mkldnn::primitive_desc_base& pd, mkldnn::query what) {
+    const void* opDesc = nullptr;
+    mkldnn::error::wrap_c_api(mkldnn_primitive_desc_query(pd.get(), mkldnn::convert_to_c(what), 0, &opDesc),
+                              "could not get an operation descriptor");
+    key.append(static_cast<const char*>(opDesc), sizeof(OpDesc));
+}
+
+void appendMemoryDescs(std::string& key, const mkldnn::primitive_desc_base& pd, mkldnn::query what, int maxCount) {
+    for (int i = 0; i < maxCount; i++) {
+        auto md = pd.query_md(what, i);
+        if (md.data.ndims == 0)
+            break;
+        appendValue(key, md.data);
+    }
+}
+
+// Returns false if the primitive must not be cached
+bool appendAttributes(std::string& key, const mkldnn::primitive_attr& attr) {
+    int mask = 0;
+    std::vector<float> scales;
+    attr.get_output_scales(mask, scales);
+    appendValue(key, mask);
+    appendPrimitiveCacheKey(key, scales);
+
+    const auto postOps = attr.get_post_ops();
+    for (int i = 0; i < postOps.len(); i++) {
+        const auto kind = postOps.kind(i);
+        appendValue(key, kind);
+        if (kind == mkldnn::primitive::kind::sum) {
+            float scale = 0.f;
+            postOps.get_params_sum(i, scale);
+            appendValue(key, scale);
+        } else if (kind == mkldnn::primitive::kind::eltwise) {
+            float scale = 0.f, alpha = 0.f, beta = 0.f;
+            mkldnn::algorithm alg;
+            postOps.get_params_eltwise(i, scale, alg, alpha, beta);
+            appendValue(key, scale);
+            appendValue(key, alg);
+            appendValue(key, alpha);
+            appendValue(key, beta);
+        } else {
+            // depthwise, quantization, binarization and depthwise convolution post-ops point to the node data
+            return false;
+        }
+    }
+    return true;
+}
+
+// Returns false if the primitive must not be cached
+bool makeKey(std::string& key, const mkldnn::primitive_desc_base& pd) {
+    const auto kind = pd.get_kind();
+    appendValue(key, kind);
+    switch (kind) {
+        case mkldnn::primitive::kind::convolution:
+            appendOpDesc<mkldnn_convolution_desc_t>(key, pd, mkldnn::query::convolution_d);
+            break;
+        case mkldnn::primitive::kind::deconvolution:
+            appendOpDesc<mkldnn_deconvolution_desc_t>(key, pd, mkldnn::query::deconvolution_d);
+            break;
+        case mkldnn::primitive::kind::inner_product:
+            appendOpDesc<mkldnn_inner_product_desc_t>(key, pd, mkldnn::query::inner_product_d);
+            break;
+        case mkldnn::primitive::kind::pooling:
+            appendOpDesc<mkldnn_pooling_desc_t>(key, pd, mkldnn::query::pooling_d);
+            break;
+        case mkldnn::primitive::kind::lrn:
+            appendOpDesc<mkldnn_lrn_desc_t>(key, pd, mkldnn::query::lrn_d);
+            break;
+        case mkldnn::primitive::kind::softmax:
+            appendOpDesc<mkldnn_softmax_desc_t>(key, pd, mkldnn::query::softmax_d);
+            break;
+        case mkldnn::primitive::kind::batch_normalization:
+            appendOpDesc<mkldnn_batch_normalization_desc_t>(key, pd, mkldnn::query::batch_normalization_d);
+            break;
+        case mkldnn::primitive::kind::rnn:
+            appendOpDesc<mkldnn_rnn_desc_t>(key, pd, mkldnn::query::rnn_d);
+            break;
+        case mkldnn::primitive::kind::reorder:
+        case mkldnn::primitive::kind::concat:
+            // have no operation descriptor, the concatenation axis follows from the memory descriptors
+            break;
+        default:
+            return false;
+    }
+
+    appendMemoryDescs(key, pd, mkldnn::query::src_md, 64);
+    appendMemoryDescs(key, pd, mkldnn::query::diff_src_md, 1);
+    appendMemoryDescs(key, pd, mkldnn::query::weights_md, 2);
+    appendMemoryDescs(key, pd, mkldnn::query::dst_md, 4);
+    appendMemoryDescs(key, pd, mkldnn::query::diff_dst_md, 1);
+    appendMemoryDescs(key, pd, mkldnn::query::workspace_md, 1);
+    key += pd.impl_info_str();
+    appendValue(key, parallel_get_max_threads());
+
+    return appendAttributes(key, pd.get_primitive_attr());
+}
+
+}  // namespace
+
+PrimitiveCache::StatisticScope::StatisticScope(Statistic& statistic) : previous(currentStatistic) {
+    currentStatistic = &statistic;
+}
+
+PrimitiveCache::StatisticScope::~StatisticScope() {
+    currentStatistic = previous;
+}
+
+PrimitiveCache& PrimitiveCache::getInstance() {
+    static PrimitiveCache cache;
+    return cache;
+}
+
+PrimitiveCache::PrimitiveCache() {
+    mkldnn::set_primitive_cache_capacity(0);
+}
+
+std::shared_ptr<mkldnn::primitive> PrimitiveCache::getOrCreate(const mkldnn::primitive_desc_base& pd, const std::string& attrKey) {
+    std::string key;
+    if (!makeKey(key, pd)) {
+        if (currentStatistic)
+            currentStatistic->uncached++;
+        return std::make_shared<mkldnn::primitive>(pd.get());
+    }
+    key += attrKey;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto found = index.find(key);
+        if (found != index.end()) {
+            entries.splice(entries.begin(), entries, found->second);
+            if (currentStatistic)
+                currentStatistic->hits++;
+            return found->second->second;
+        }
+    }
+    if (currentStatistic)
+        currentStatistic->misses++;
+
+    // JIT compilation is done out of the lock, a primitive created concurrently for the same key is kept
+    auto primitive = std::make_shared<mkldnn::primitive>(pd.get());
+    std::lock_guard<std::mutex> lock(mutex);
+    if (capacity == 0 || index.count(key))
+        return primitive;
+    entries.emplace_front(key, primitive);
+    index[key] = entries.begin();
+    if (entries.size() > capacity) {
+        index.erase(entries.back().first);
+        entries.pop_back();
+    }
+    return primitive;
+}
+
+void PrimitiveCache::setCapacity(size_t newCapacity) {
+    std::lock_guard<std::mutex> lock(mutex);
+    capacity = newCapacity;
+    while (entries.size() > capacity) {
+        index.erase(entries.back().first);
+        entries.pop_back();
+    }
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,81 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <mkldnn.hpp>
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Process-wide LRU cache of oneDNN primitives shared by all networks and streams of the plugin.
+ *
+ * It replaces the oneDNN cache which is disabled: depthwise, quantization, binarization and fused depthwise
+ * convolution post-ops keep raw pointers to node data which are generated into JIT code, but are not a part
+ * of the oneDNN cache key. Primitives with such post-ops are created without the cache, all others are looked up
+ * by the operation descriptor, memory descriptors, implementation, attributes and the number of threads.
+ */
+class PrimitiveCache {
+public:
+    struct Statistic {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t uncached = 0;
+    };
+
+    /**
+     * Accumulates lookups of the current thread to the statistic while the scope is alive
+     */
+    class StatisticScope {
+    public:
+        explicit StatisticScope(Statistic& statistic);
+        ~StatisticScope();
+
+        StatisticScope(const StatisticScope&) = delete;
+        StatisticScope& operator=(const StatisticScope&) = delete;
+
+    private:
+        Statistic* previous;
+    };
+
+    static PrimitiveCache& getInstance();
+
+    /**
+     * Returns the cached primitive created for an equal descriptor or creates a new one
+     * @param pd the primitive descriptor
+     * @param attrKey values of attributes which cannot be read back from the descriptor (zero points, RNN
+     * quantization parameters), the caller must pass them if they are set, see appendPrimitiveCacheKey
+     */
+    std::shared_ptr<mkldnn::primitive> getOrCreate(const mkldnn::primitive_desc_base& pd, const std::string& attrKey = {});
+
+    void setCapacity(size_t capacity);
+
+private:
+    PrimitiveCache();
+
+    using Entry = std::pair<std::string, std::shared_ptr<mkldnn::primitive>>;
+
+    std::mutex mutex;
+    size_t capacity = 1024;
+    std::list<Entry> entries;  // the most recently used first
+    std::unordered_map<std::string, std::list<Entry>::iterator> index;
+};
+
+template <typename T>
+void appendPrimitiveCacheKey(std::string& key, const std::vector<T>& values) {
+    const auto size = values.size();
+    key.append(reinterpret_cast<const char*>(&size), sizeof(size));
+    key.append(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+}
+
+}  // namespace MKLDNNPlugin
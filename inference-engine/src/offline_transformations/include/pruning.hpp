@@ -5,6 +5,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <vector>
 
 #include <ngraph/pass/graph_rewrite.hpp>
@@ -16,6 +17,7 @@ namespace pass {
 class InitConstMask;
 class PropagateMasks;
 class ShrinkWeights;
+class PruningReport;
 
 class Pruning;
 
@@ -57,6 +59,31 @@ public:
     bool run_on_function(std::shared_ptr<ngraph::Function>) override;
 };
 
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief Estimates pruning results without changing the function: masks are propagated
+ * on a copy of the function and for every Convolution, GroupConvolution and MatMul
+ * operation it reports the computations and weights that ShrinkWeights would remove.
+ */
+class ngraph::pass::PruningReport : public ngraph::pass::FunctionPass {
+public:
+    struct LayerStatistics {
+        std::string name;
+        std::string type;
+        int64_t flops{0};
+        int64_t pruned_flops{0};
+        int64_t weights_bytes{0};
+        int64_t pruned_weights_bytes{0};
+    };
+
+    NGRAPH_RTTI_DECLARATION;
+    explicit PruningReport(std::vector<LayerStatistics> & statistics);
+    bool run_on_function(std::shared_ptr<ngraph::Function>) override;
+
+private:
+    std::vector<LayerStatistics> & m_statistics;
+};
+
 /**
  * @ingroup ie_transformation_common_api
  * @brief This is just a sequence of passes that performs pruning transformations pipeline
@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <numeric>
+
 #include "pruning.hpp"
 #include "mask_attribute.hpp"
 
@@ -17,7 +20,10 @@ namespace mask_propagation {
 
 class Convolution;
 class GroupConvolution;
+class MatMul;
 class Elementwise;
+class Concat;
+class Reshape;
 class PassThrough;
 class StopPropagation;
 
@@ -25,6 +31,136 @@ class StopPropagation;
 } // namespace pass
 } // namespace ngraph
 
+namespace {
+
+// Output dimensions of an element-wise operation mapped to the dimensions of its input
+// according to numpy broadcasting rules.
+struct BroadcastedDims {
+    BroadcastedDims(const ngraph::PartialShape & input_shape, const ngraph::PartialShape & output_shape) {
+        const auto input_rank = input_shape.rank().get_length();
+        const auto output_rank = output_shape.rank().get_length();
+        for (int64_t dim = 0; dim < output_rank; ++dim) {
+            const auto input_dim = dim - (output_rank - input_rank);
+            const bool is_one = input_dim >= 0 && input_shape[input_dim].is_static() &&
+                                input_shape[input_dim].get_length() == 1;
+            const bool output_is_one = output_shape[dim].is_static() && output_shape[dim].get_length() == 1;
+            aligned.push_back(input_dim);
+            broadcasted.push_back(input_dim < 0 || (is_one && !output_is_one));
+        }
+    }
+
+    // input dimension aligned with the output dimension, negative if the input has no such dimension
+    std::vector<int64_t> aligned;
+    // true if the input is broadcasted along the output dimension
+    std::vector<bool> broadcasted;
+};
+
+// Returns channels of the input which are zero along the output dimension. The input which is
+// broadcasted along the dimension doesn't limit zero channels of the other input (nullptr is returned)
+// if the operation keeps zeros of the other input or the broadcasted value itself is zero.
+const std::set<uint64_t> * get_zero_channels(const ngraph::Mask & mask, const BroadcastedDims & dims,
+                                             size_t dim, bool keeps_zeros) {
+    static const std::set<uint64_t> no_zero_channels;
+    const auto input_dim = dims.aligned[dim];
+    if (!dims.broadcasted[dim]) {
+        return &mask.at(input_dim);
+    }
+    if (keeps_zeros || (input_dim >= 0 && mask.at(input_dim).count(0))) {
+        return nullptr;
+    }
+    return &no_zero_channels;
+}
+
+// Input and output dimensions of a reshape which contain the same elements
+struct ReshapeGroup {
+    std::vector<size_t> input_dims;
+    std::vector<size_t> output_dims;
+};
+
+std::vector<ReshapeGroup> get_reshape_groups(const ngraph::Shape & input_shape, const ngraph::Shape & output_shape) {
+    std::vector<ReshapeGroup> groups;
+    size_t input_dim = 0, output_dim = 0;
+    while (input_dim < input_shape.size() || output_dim < output_shape.size()) {
+        ReshapeGroup group;
+        size_t input_size = 1, output_size = 1;
+        do {
+            if (input_dim < input_shape.size() && (input_size <= output_size || output_dim == output_shape.size())) {
+                group.input_dims.push_back(input_dim);
+                input_size *= input_shape[input_dim++];
+            } else if (output_dim < output_shape.size()) {
+                group.output_dims.push_back(output_dim);
+                output_size *= output_shape[output_dim++];
+            } else {
+                break;
+            }
+        } while (input_size != output_size);
+        groups.push_back(group);
+    }
+    return groups;
+}
+
+// Channels of reshaped dimensions are mapped through the elements they contain: an element is removed
+// if any of its channels is removed and a channel is removed if all its elements are removed.
+constexpr size_t max_reshape_group_size = 1 << 24;
+
+void reshape_mask(const ngraph::Mask & from_mask, const ngraph::Shape & from_shape,
+                  const std::vector<size_t> & from_dims,
+                  ngraph::Mask & to_mask, const ngraph::Shape & to_shape,
+                  const std::vector<size_t> & to_dims) {
+    if (from_dims.empty() || to_dims.empty()) {
+        return;
+    }
+    if (from_dims.size() == 1 && to_dims.size() == 1) {
+        to_mask.at(to_dims[0]) = from_mask.at(from_dims[0]);
+        return;
+    }
+    if (std::all_of(from_dims.begin(), from_dims.end(), [&](size_t dim) { return from_mask.at(dim).empty(); })) {
+        return;
+    }
+
+    size_t group_size = 1;
+    for (const auto & dim : from_dims) {
+        group_size *= from_shape[dim];
+    }
+    if (group_size > max_reshape_group_size) {
+        return;
+    }
+
+    std::vector<size_t> removed_count(std::accumulate(to_dims.begin(), to_dims.end(), size_t(0),
+        [&](size_t sum, size_t dim) { return sum + to_shape[dim]; }));
+    for (size_t element = 0; element < group_size; ++element) {
+        bool removed = false;
+        for (size_t i = from_dims.size(), index = element; i-- > 0 && !removed;) {
+            const auto dim_size = from_shape[from_dims[i]];
+            removed = from_mask.at(from_dims[i]).count(index % dim_size) != 0;
+            index /= dim_size;
+        }
+        if (!removed) {
+            continue;
+        }
+        size_t offset = removed_count.size();
+        for (size_t i = to_dims.size(), index = element; i-- > 0;) {
+            const auto dim_size = to_shape[to_dims[i]];
+            offset -= dim_size;
+            removed_count[offset + index % dim_size]++;
+            index /= dim_size;
+        }
+    }
+
+    size_t offset = 0;
+    for (const auto & dim : to_dims) {
+        const auto channel_size = group_size / to_shape[dim];
+        for (size_t channel = 0; channel < to_shape[dim]; ++channel) {
+            if (removed_count[offset + channel] == channel_size) {
+                to_mask.at(dim).insert(channel);
+            }
+        }
+        offset += to_shape[dim];
+    }
+}
+
+} // namespace
+
 class ngraph::pass::mask_propagation::Convolution : public MatcherPass {
 public:
     Convolution() {
@@ -163,11 +299,83 @@ public:
     }
 };
 
+class ngraph::pass::mask_propagation::MatMul : public MatcherPass {
+public:
+    MatMul() {
+        auto input = pattern::any_input(pattern::has_static_rank());
+        auto weights = pattern::any_input(pattern::has_static_shape());
+        auto matmul = pattern::wrap_type<opset6::MatMul>({input, weights});
+
+        ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+            const auto & pattern_map = m.get_pattern_value_map();
+            const auto & m_weights = pattern_map.at(weights);
+            const auto & m_output = pattern_map.at(matmul);
+            const auto & m_input = pattern_map.at(input);
+            auto matmul_node = std::dynamic_pointer_cast<opset6::MatMul>(m_output.get_node_shared_ptr());
+
+            const auto input_rank = m_input.get_partial_shape().rank().get_length();
+            if (m_weights.get_shape().size() != 2 || input_rank < 2) return false;
+
+            // Only fully connected layers are supported: weights are [K, N] or [N, K] matrix
+            const size_t input_k_dim = matmul_node->get_transpose_a() ? input_rank - 2 : input_rank - 1;
+            const size_t weights_k_dim = matmul_node->get_transpose_b() ? 1 : 0;
+            const size_t weights_n_dim = 1 - weights_k_dim;
+
+            // In case if weights are Constant we initialize Mask
+            InitConstMask({weights_n_dim}).apply(m_weights.get_node_shared_ptr());
+
+            auto weights_mask = getMask(m_weights);
+            if (!weights_mask) return false;
+
+            if (auto input_mask = getMask(m_input)) {
+                // Weights rows are multiplied by the input channels
+                weights_mask->add_callback([input_mask, weights_k_dim, input_k_dim](Mask::Ptr cur_mask) -> bool {
+                    cur_mask->at(weights_k_dim) = input_mask->at(input_k_dim);
+                    return true;
+                }, input_mask);
+
+                input_mask->add_callback([weights_mask, weights_k_dim, input_k_dim](Mask::Ptr cur_mask) -> bool {
+                    cur_mask->at(input_k_dim) = weights_mask->at(weights_k_dim);
+                    return true;
+                }, weights_mask);
+
+                if (!weights_mask->apply_callback(input_mask)) {
+                    return false;
+                }
+            }
+
+            // Output channels are the last dimension of MatMul output
+            const size_t output_rank = m_output.get_partial_shape().rank().get_length();
+            auto matmul_mask = std::make_shared<Mask>(output_rank);
+
+            matmul_mask->add_callback([weights_mask, weights_n_dim, output_rank](Mask::Ptr cur_mask) -> bool {
+                cur_mask->at(output_rank - 1) = weights_mask->at(weights_n_dim);
+                return true;
+            }, weights_mask);
+
+            weights_mask->add_callback([matmul_mask, weights_n_dim, output_rank](Mask::Ptr cur_mask) -> bool {
+                cur_mask->at(weights_n_dim) = matmul_mask->at(output_rank - 1);
+                return true;
+            }, matmul_mask);
+
+            if (!matmul_mask->apply_callback(weights_mask)) {
+                return false;
+            }
+
+            setMask(m_output, matmul_mask);
+            return true;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(matmul, "MatMulMaskPropagation");
+        register_matcher(m, callback);
+    }
+};
+
 class ngraph::pass::mask_propagation::Elementwise : public MatcherPass {
 public:
     Elementwise() {
-        auto input = pattern::any_input();
-        auto weights = pattern::any_input();
+        auto input = pattern::any_input(pattern::has_static_rank());
+        auto weights = pattern::any_input(pattern::has_static_rank());
         auto eltwise = pattern::wrap_type<op::util::BinaryElementwiseArithmetic>({input, weights},
                                                                                  pattern::has_static_rank());
 
@@ -177,16 +385,23 @@ public:
             const auto & m_output = pattern_map.at(eltwise);
             const auto & m_input = pattern_map.at(input);
 
-            // TODO: implement check that compares input shape ranks
-            const auto & input_rank = m_input.get_partial_shape().rank().get_length();
-            const auto & weights_rank = m_weights.get_partial_shape().rank().get_length();
-            if (weights_rank < 3 || input_rank < 3) return false;
-
-            // In case if one of the inputs is constant
-            // TODO: need to find channel dimension instead of hardcoded zero
-            const size_t & channel_dim = (input_rank == weights_rank ? 1 : 0);
-            InitConstMask({channel_dim}).apply(m_input.get_node_shared_ptr());
-            InitConstMask({channel_dim}).apply(m_weights.get_node_shared_ptr());
+            const auto & output_shape = m_output.get_partial_shape();
+            const auto output_rank = output_shape.rank().get_length();
+            if (output_rank < 2) return false;
+
+            for (const auto & value : {m_input, m_weights}) {
+                // In case if one of the inputs is constant we initialize its mask along
+                // the dimension which is broadcasted to the output channel dimension
+                const auto & node = value.get_node_shared_ptr();
+                const auto channel_dim = value.get_partial_shape().rank().get_length() - output_rank + 1;
+                if (channel_dim >= 0) {
+                    InitConstMask({static_cast<size_t>(channel_dim)}).apply(node);
+                }
+                // Constants which don't have channel dimension have no zero channels
+                if (!getMask(value) && std::dynamic_pointer_cast<opset6::Constant>(node)) {
+                    setMask(value, std::make_shared<Mask>(value.get_partial_shape()));
+                }
+            }
 
             auto weights_mask = getMask(m_weights);
             auto input_mask = getMask(m_input);
@@ -196,60 +411,228 @@ public:
                 return false;
             }
 
-            // Merge masks from two inputs
-            auto output_mask = std::make_shared<Mask>(m_output.get_partial_shape().rank().get_length());
-
-            auto out_mask_callback = [input_mask, weights_mask](Mask::Ptr cur_mask) -> bool {
-                auto omask_iter = cur_mask->rbegin();
-                auto imask_iter = input_mask->rbegin();
-                auto wmask_iter = weights_mask->rbegin();
-
-                for (auto & item : *cur_mask) {
-                    item.clear();
-                }
+            const BroadcastedDims input_dims(m_input.get_partial_shape(), output_shape);
+            const BroadcastedDims weights_dims(m_weights.get_partial_shape(), output_shape);
+            // Multiplication by a broadcasted value keeps zero channels of the other input
+            const bool keeps_zeros = is_type<opset6::Multiply>(m_output.get_node());
 
-                while (imask_iter != input_mask->rend() &&
-                       wmask_iter != weights_mask->rend()) {
+            // Merge masks from two inputs
+            auto output_mask = std::make_shared<Mask>(output_rank);
+
+            auto out_mask_callback = [input_mask, weights_mask, input_dims, weights_dims, keeps_zeros](Mask::Ptr cur_mask) -> bool {
+                cur_mask->clean_dim_values();
+                for (size_t dim = 0; dim < cur_mask->size(); ++dim) {
+                    const auto input_channels = get_zero_channels(*input_mask, input_dims, dim, keeps_zeros);
+                    const auto weights_channels = get_zero_channels(*weights_mask, weights_dims, dim, keeps_zeros);
+                    if (!input_channels || !weights_channels) {
+                        if (input_channels || weights_channels) {
+                            cur_mask->at(dim) = input_channels ? *input_channels : *weights_channels;
+                        }
+                        continue;
+                    }
                     // Merge mask dimension values for both masks
                     // Example: (MaskValue[1,2,3,4], MaskValue[2,3]) -> MaskValue[2,3]
-                    for (const auto & value : *imask_iter) {
-                        if (wmask_iter->count(value)) {
-                            omask_iter->insert(value);
+                    for (const auto & value : *input_channels) {
+                        if (weights_channels->count(value)) {
+                            cur_mask->at(dim).insert(value);
                         }
                     }
-
-                    omask_iter++;
-                    imask_iter++;
-                    wmask_iter++;
                 }
                 return true;
             };
             output_mask->add_callback(out_mask_callback, input_mask);
             output_mask->add_callback(out_mask_callback, weights_mask);
 
-            auto callback = [output_mask](Mask::Ptr cur_mask) -> bool {
-                auto omask_iter = output_mask->rbegin();
-                auto cmask_iter = cur_mask->rbegin();
-                while (omask_iter != output_mask->rend() &&
-                       cmask_iter != cur_mask->rend()) {
-                    // TODO: check
-                    *cmask_iter = *omask_iter;
+            auto make_input_callback = [output_mask](const BroadcastedDims & dims) {
+                return [output_mask, dims](Mask::Ptr cur_mask) -> bool {
+                    // Broadcasted dimensions are not changed
+                    for (size_t dim = 0; dim < output_mask->size(); ++dim) {
+                        if (!dims.broadcasted[dim]) {
+                            cur_mask->at(dims.aligned[dim]) = output_mask->at(dim);
+                        }
+                    }
+                    return true;
+                };
+            };
+            input_mask->add_callback(make_input_callback(input_dims), output_mask);
+            weights_mask->add_callback(make_input_callback(weights_dims), output_mask);
+
+            // Init output mask
+            output_mask->apply_callback(input_mask);
+            setMask(m_output, output_mask);
+            return true;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(eltwise, "EltwiseMaskPropagation");
+        register_matcher(m, callback);
+    }
+};
+
+class ngraph::pass::mask_propagation::Concat : public MatcherPass {
+public:
+    Concat() {
+        auto concat = pattern::wrap_type<opset6::Concat>(pattern::has_static_shape());
+
+        ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+            const auto & pattern_map = m.get_pattern_value_map();
+            const auto & m_output = pattern_map.at(concat);
+            auto concat_node = std::dynamic_pointer_cast<opset6::Concat>(m_output.get_node_shared_ptr());
+            const size_t axis = concat_node->get_concatenation_axis();
+
+            std::vector<Mask::Ptr> input_masks;
+            std::vector<uint64_t> offsets;
+            uint64_t offset = 0;
+            for (const auto & input : concat_node->input_values()) {
+                if (input.get_partial_shape().is_dynamic()) return false;
+                // Concatenated constants are pruned along the concatenation axis
+                InitConstMask({axis}).apply(input.get_node_shared_ptr());
+                input_masks.push_back(getMask(input));
+                offsets.push_back(offset);
+                offset += input.get_shape()[axis];
+            }
+            if (std::none_of(input_masks.begin(), input_masks.end(), [](const Mask::Ptr & mask) { return mask != nullptr; })) {
+                return false;
+            }
 
-                    omask_iter++;
-                    cmask_iter++;
+            auto output_mask = std::make_shared<Mask>(m_output.get_shape().size());
+
+            auto out_mask_callback = [input_masks, offsets, axis](Mask::Ptr cur_mask) -> bool {
+                cur_mask->clean_dim_values();
+                for (size_t dim = 0; dim < cur_mask->size(); ++dim) {
+                    if (dim == axis) {
+                        // Channels of the inputs without masks can't be removed
+                        for (size_t i = 0; i < input_masks.size(); ++i) {
+                            if (!input_masks[i]) continue;
+                            for (const auto & value : input_masks[i]->at(axis)) {
+                                cur_mask->at(axis).insert(offsets[i] + value);
+                            }
+                        }
+                    } else if (std::all_of(input_masks.begin(), input_masks.end(), [](const Mask::Ptr & mask) { return mask != nullptr; })) {
+                        // Other dimensions are removed only if they are removed from all the inputs
+                        cur_mask->at(dim) = input_masks[0]->at(dim);
+                        for (const auto & input_mask : input_masks) {
+                            auto & values = cur_mask->at(dim);
+                            for (auto value = values.begin(); value != values.end();) {
+                                value = input_mask->at(dim).count(*value) ? std::next(value) : values.erase(value);
+                            }
+                        }
+                    }
                 }
                 return true;
             };
-            input_mask->add_callback(callback, output_mask);
-            weights_mask->add_callback(callback, output_mask);
+
+            for (size_t i = 0; i < input_masks.size(); ++i) {
+                if (!input_masks[i]) continue;
+                const uint64_t begin = offsets[i];
+                const uint64_t end = begin + concat_node->get_input_shape(i)[axis];
+                output_mask->add_callback(out_mask_callback, input_masks[i]);
+                input_masks[i]->add_callback([output_mask, axis, begin, end](Mask::Ptr cur_mask) -> bool {
+                    for (size_t dim = 0; dim < cur_mask->size(); ++dim) {
+                        if (dim != axis) {
+                            cur_mask->at(dim) = output_mask->at(dim);
+                            continue;
+                        }
+                        cur_mask->at(dim).clear();
+                        const auto & values = output_mask->at(dim);
+                        for (auto value = values.lower_bound(begin); value != values.end() && *value < end; ++value) {
+                            cur_mask->at(dim).insert(*value - begin);
+                        }
+                    }
+                    return true;
+                }, output_mask);
+            }
 
             // Init output mask
-            output_mask->apply_callback(input_mask);
+            for (const auto & input_mask : input_masks) {
+                if (input_mask) {
+                    if (!output_mask->apply_callback(input_mask)) {
+                        return false;
+                    }
+                    break;
+                }
+            }
             setMask(m_output, output_mask);
             return true;
         };
 
-        auto m = std::make_shared<ngraph::pattern::Matcher>(eltwise, "EltwiseMaskPropagation");
+        auto m = std::make_shared<ngraph::pattern::Matcher>(concat, "ConcatMaskPropagation");
+        register_matcher(m, callback);
+    }
+};
+
+class ngraph::pass::mask_propagation::Reshape : public MatcherPass {
+public:
+    Reshape() {
+        auto reshape = pattern::wrap_type<opset6::Reshape, opset6::Squeeze, opset6::Unsqueeze>(pattern::has_static_shape());
+
+        ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+            const auto & pattern_map = m.get_pattern_value_map();
+            const auto & m_output = pattern_map.at(reshape);
+            const auto & node = m_output.get_node_shared_ptr();
+            const auto & m_input = node->input_value(0);
+
+            auto input_mask = getMask(m_input);
+            if (!input_mask || m_input.get_partial_shape().is_dynamic()) return false;
+
+            const auto input_shape = m_input.get_shape();
+            const auto output_shape = m_output.get_shape();
+            const auto groups = get_reshape_groups(input_shape, output_shape);
+
+            // Target shape of Reshape has to be updated with the number of removed channels
+            std::shared_ptr<opset6::Constant> pattern;
+            if (is_type<opset6::Reshape>(node)) {
+                pattern = std::dynamic_pointer_cast<opset6::Constant>(node->get_input_node_shared_ptr(1));
+                // Shared target shape can't be updated for a single Reshape
+                if (!pattern || pattern->output(0).get_target_inputs().size() != 1) return false;
+            }
+
+            auto output_mask = std::make_shared<Mask>(output_shape.size());
+
+            output_mask->add_callback([input_mask, input_shape, output_shape, groups](Mask::Ptr cur_mask) -> bool {
+                cur_mask->clean_dim_values();
+                for (const auto & group : groups) {
+                    reshape_mask(*input_mask, input_shape, group.input_dims, *cur_mask, output_shape, group.output_dims);
+                }
+                return true;
+            }, input_mask);
+
+            input_mask->add_callback([output_mask, input_shape, output_shape, groups](Mask::Ptr cur_mask) -> bool {
+                cur_mask->clean_dim_values();
+                for (const auto & group : groups) {
+                    reshape_mask(*output_mask, output_shape, group.output_dims, *cur_mask, input_shape, group.input_dims);
+                }
+                return true;
+            }, output_mask);
+
+            if (pattern) {
+                const auto pattern_values = pattern->cast_vector<int64_t>();
+                auto pattern_mask = std::make_shared<Mask>(pattern_values.size());
+                pattern_mask->set_shape_like(true);
+
+                // Special values of target shape (0 and -1) are resolved automatically
+                pattern_mask->add_callback([output_mask, pattern_values](Mask::Ptr cur_mask) -> bool {
+                    for (size_t dim = 0; dim < cur_mask->size(); ++dim) {
+                        cur_mask->at(dim) = pattern_values[dim] > 0 ? output_mask->at(dim) : std::set<uint64_t>{};
+                    }
+                    return true;
+                }, output_mask);
+
+                output_mask->add_callback([](Mask::Ptr cur_mask) -> bool {
+                    return true;
+                }, pattern_mask);
+
+                setMask(pattern->output(0), pattern_mask);
+            }
+
+            if (!output_mask->apply_callback(input_mask)) {
+                return false;
+            }
+
+            setMask(m_output, output_mask);
+            return true;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(reshape, "ReshapeMaskPropagation");
         register_matcher(m, callback);
     }
 };
@@ -257,7 +640,8 @@ public:
 class ngraph::pass::mask_propagation::PassThrough : public MatcherPass {
 public:
     PassThrough() {
-        auto unary_op = pattern::wrap_type<op::util::UnaryElementwiseArithmetic, opset6::Clamp>();
+        auto unary_op = pattern::wrap_type<op::util::UnaryElementwiseArithmetic, opset6::Clamp,
+                                           opset6::MaxPool, opset6::AvgPool>();
 
         ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
             const auto & pattern_map = m.get_pattern_value_map();
@@ -301,7 +685,10 @@ public:
 ngraph::pass::PropagateMasks::PropagateMasks() {
     add_matcher<mask_propagation::Convolution>();
     add_matcher<mask_propagation::GroupConvolution>();
+    add_matcher<mask_propagation::MatMul>();
     add_matcher<mask_propagation::Elementwise>();
+    add_matcher<mask_propagation::Concat>();
+    add_matcher<mask_propagation::Reshape>();
     add_matcher<mask_propagation::PassThrough>();
     add_matcher<mask_propagation::StopPropagation>();
 }
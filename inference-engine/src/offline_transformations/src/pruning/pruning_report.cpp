@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+
+#include "pruning.hpp"
+#include "mask_attribute.hpp"
+
+#include <ngraph/graph_util.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <ngraph/opsets/opset6.hpp>
+#include <ngraph/log.hpp>
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::PruningReport, "PruningReport", 0);
+
+ngraph::pass::PruningReport::PruningReport(std::vector<LayerStatistics> & statistics)
+    : m_statistics(statistics) {
+}
+
+bool ngraph::pass::PruningReport::run_on_function(std::shared_ptr<ngraph::Function> f) {
+    // Masks are stored in runtime info, so they are propagated on a copy to keep the function intact
+    auto f_copy = ngraph::clone_function(*f);
+
+    Manager manager(get_pass_config());
+    manager.register_pass<PropagateMasks>();
+    manager.run_passes(f_copy);
+
+    m_statistics.clear();
+    for (const auto & node : f_copy->get_ordered_ops()) {
+        size_t channel_dim = 1;
+        if (is_type<opset6::MatMul>(node)) {
+            if (node->get_input_partial_shape(1).rank().get_length() != 2) continue;
+            channel_dim = node->get_output_partial_shape(0).rank().get_length() - 1;
+        } else if (!is_type<opset6::Convolution>(node) && !is_type<opset6::GroupConvolution>(node)) {
+            continue;
+        }
+        if (node->get_input_partial_shape(1).is_dynamic() || node->get_output_partial_shape(0).is_dynamic()) {
+            NGRAPH_DEBUG << "Pruning report skips " << node->get_friendly_name() << " with dynamic shape";
+            continue;
+        }
+
+        const auto & weights = node->input_value(1);
+        const auto & weights_shape = weights.get_shape();
+        const auto & output_shape = node->get_output_shape(0);
+
+        // Every weight is used once for every output element which doesn't belong to the channel dimension
+        const int64_t weights_count = shape_size(weights_shape);
+        const int64_t weights_usage = shape_size(output_shape) / output_shape[channel_dim];
+
+        int64_t kept_weights_count = weights_count;
+        if (auto mask = getMask(weights)) {
+            kept_weights_count = 1;
+            for (size_t dim = 0; dim < weights_shape.size(); ++dim) {
+                kept_weights_count *= weights_shape[dim] - mask->at(dim).size();
+            }
+        }
+
+        LayerStatistics statistics;
+        statistics.name = node->get_friendly_name();
+        statistics.type = node->get_type_name();
+        statistics.flops = 2 * weights_count * weights_usage;
+        statistics.pruned_flops = 2 * (weights_count - kept_weights_count) * weights_usage;
+        statistics.weights_bytes = weights_count * weights.get_element_type().size();
+        statistics.pruned_weights_bytes = (weights_count - kept_weights_count) * weights.get_element_type().size();
+        m_statistics.push_back(statistics);
+    }
+
+    // Return false because we didn't change nGraph Function
+    return false;
+}
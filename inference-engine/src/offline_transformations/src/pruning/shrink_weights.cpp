@@ -37,7 +37,8 @@ bool ngraph::pass::ShrinkWeights::run_on_function(std::shared_ptr<ngraph::Functi
 
         if (mask->is_shape_like()) {
             // TODO: think about it
-            auto res = const_node->get_shape_val();
+            // special values of target shape (0 and -1) have to be kept as is
+            auto res = const_node->cast_vector<int64_t>();
             if (res.size() != mask->size()) {
                 throw ngraph_error("Mask size (" + std::to_string(mask->size()) + ") is not equal to (" + std::to_string(res.size()) + ")");
             }
@@ -104,6 +104,14 @@ public:
         }
     }
     IE_SUPPRESS_DEPRECATED_END
+
+    /**
+     * @brief Gets the underlying implementation, e.g. to call methods which are not a part of IInferRequest
+     * @return A shared pointer to the underlying implementation
+     */
+    std::shared_ptr<IAsyncInferRequestInternal> GetImpl() const {
+        return _impl;
+    }
 };
 
 }  // namespace InferenceEngine
@@ -245,6 +245,16 @@ public:
         _syncRequest->SetBatch(batch);
     };
 
+    void SetStateSession(size_t sessionId) override {
+        CheckState();
+        _syncRequest->SetStateSession(sessionId);
+    }
+
+    void ReleaseStateSession(size_t sessionId) override {
+        CheckState();
+        _syncRequest->ReleaseStateSession(sessionId);
+    }
+
     void GetUserData(void** data) override {
         CheckState();
         if (data == nullptr) IE_THROW(NotAllocated);
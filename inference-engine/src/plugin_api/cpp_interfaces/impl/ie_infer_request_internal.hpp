@@ -218,6 +218,16 @@ public:
         IE_THROW() << "Dynamic batch is not supported";
     };
 
+    void SetStateSession(size_t sessionId) override {
+        (void)sessionId;
+        IE_THROW(NotImplemented) << "Variable state sessions are not supported";
+    }
+
+    void ReleaseStateSession(size_t sessionId) override {
+        (void)sessionId;
+        IE_THROW(NotImplemented) << "Variable state sessions are not supported";
+    }
+
     /**
      * @brief      Sets the pointer to executable network internal.
      * @note       Needed to correctly handle ownership between objects.
@@ -90,6 +90,18 @@ public:
      */
     virtual void SetBatch(int batch) = 0;
 
+    /**
+     * @brief Selects a set of variable states used by the following inference calls of this request.
+     * @param sessionId - identifier of the session, a new session starts with default state values.
+     */
+    virtual void SetStateSession(size_t sessionId) = 0;
+
+    /**
+     * @brief Releases variable states of a session which is not selected for this request.
+     * @param sessionId - identifier of the session to release
+     */
+    virtual void ReleaseStateSession(size_t sessionId) = 0;
+
     /**
      * @brief Queries memory states.
      * @return Returns memory states
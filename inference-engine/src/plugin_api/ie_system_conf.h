@@ -10,6 +10,7 @@
 #pragma once
 
 #include "ie_api.h"
+#include <string>
 #include <vector>
 
 namespace InferenceEngine {
@@ -44,6 +45,73 @@ INFERENCE_ENGINE_API_CPP(std::vector<int>) getAvailableNUMANodes();
  */
 INFERENCE_ENGINE_API_CPP(int) getNumberOfCPUCores();
 
+/**
+ * @brief      Type of CPU core. Hybrid CPUs combine performance (big) and efficient (small) cores
+ * @ingroup    ie_dev_api_system_conf
+ */
+enum class CPUCoreType {
+    PERFORMANCE,  //!< Performance core or a core of non hybrid CPU
+    EFFICIENT     //!< Efficient core of hybrid CPU
+};
+
+/**
+ * @brief      Describes logical processor available for the current process
+ * @ingroup    ie_dev_api_system_conf
+ */
+struct CPUProcessor {
+    int         id     = 0;                          //!< Logical processor id
+    int         coreId = 0;                          //!< Id of physical core, equals to the smallest id of its logical processors
+    CPUCoreType type   = CPUCoreType::PERFORMANCE;   //!< Type of physical core
+};
+
+/**
+ * @brief      Describes logical processors of CPU available for the current process
+ * @ingroup    ie_dev_api_system_conf
+ */
+struct CPUTopology {
+    std::vector<CPUProcessor> processors;  //!< Logical processors ordered by ids
+
+    /**
+     * @brief  Checks whether topology has cores of different types
+     * @return `True` if topology contains both performance and efficient cores, `false` otherwise
+     */
+    bool isHybrid() const {
+        bool hasPerformance = false, hasEfficient = false;
+        for (auto&& processor : processors) {
+            hasPerformance |= processor.type == CPUCoreType::PERFORMANCE;
+            hasEfficient |= processor.type == CPUCoreType::EFFICIENT;
+        }
+        return hasPerformance && hasEfficient;
+    }
+};
+
+/**
+ * @brief      Reads CPU topology from Linux sysfs tree
+ * @ingroup    ie_dev_api_system_conf
+ *
+ * Logical processors are taken from `devices/system/cpu/online`, physical cores are defined by
+ * `devices/system/cpu/cpuN/topology/thread_siblings_list`. On hybrid Intel CPUs processors listed in
+ * `devices/cpu_atom/cpus` are efficient cores and all others are performance ones. Otherwise core types are taken from
+ * `devices/system/cpu/cpuN/cpu_capacity` values (cores with the largest capacity are performance ones).
+ *
+ * @param[in]  sysfsRoot  Path to sysfs root directory, `/sys` for the current host. Another path can be used to read
+ *                        a fake topology
+ * @return     CPU topology, empty topology if sysfs tree is not available
+ */
+INFERENCE_ENGINE_API_CPP(CPUTopology) readCPUTopology(const std::string& sysfsRoot);
+
+/**
+ * @brief      Returns topology of logical processors available for the current process
+ * @ingroup    ie_dev_api_system_conf
+ *
+ * On Linux the topology is read from sysfs; if sysfs does not describe core types the hybrid CPUID leaf is used on x86.
+ * The topology is read once, processors are filtered by the affinity mask of the process on each call.
+ * Topology is empty on other OSes.
+ *
+ * @return     CPU topology
+ */
+INFERENCE_ENGINE_API_CPP(CPUTopology) getCPUTopology();
+
 /**
  * @brief      Checks whether CPU supports SSE 4.2 capability
  * @ingroup    ie_dev_api_system_conf
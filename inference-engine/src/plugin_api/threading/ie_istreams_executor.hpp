@@ -14,6 +14,7 @@
 #include <string>
 
 #include "ie_parameter.hpp"
+#include "ie_system_conf.h"
 #include "threading/ie_itask_executor.hpp"
 
 namespace InferenceEngine {
@@ -44,6 +45,15 @@ public:
         NUMA     //!< Bind threads to NUMA nodes
     };
 
+    /**
+     * @brief Defines placement of streams on hybrid CPUs
+     */
+    enum CoresPlacement : std::uint8_t {
+        ANY,            //!< Don't take core types into account
+        PERFORMANCE,    //!< Place all streams on performance cores
+        HYBRID_AWARE    //!< Place latency stream on performance cores and throughput streams on all cores
+    };
+
     /**
      * @brief Defines IStreamsExecutor configuration
      */
@@ -76,6 +86,15 @@ public:
         */
         static Config MakeDefaultMultiThreaded(const Config& initial);
 
+        /**
+        * @brief Create appropriate multithreaded configuration for the given CPU topology.
+        *        Fills Config::_streamsProcessors if streams are placed according to core types
+        * @param initial Inital configuration
+        * @param topology CPU topology
+        * @return configured values
+        */
+        static Config MakeDefaultMultiThreaded(const Config& initial, const CPUTopology& topology);
+
         std::string        _name;  //!< Used by `ITT` to name executor threads
         int                _streams                 = 1;  //!< Number of streams.
         int                _threadsPerStream        = 0;  //!< Number of threads per stream that executes `ie_parallel` calls
@@ -83,6 +102,8 @@ public:
         int                _threadBindingStep       = 1;  //!< In case of @ref CORES binding offset type thread binded to cores with defined step
         int                _threadBindingOffset     = 0;  //!< In case of @ref CORES binding offset type thread binded to cores starting from offset
         int                _threads                 = 0;  //!< Number of threads distributed between streams. Reserved. Should not be used.
+        CoresPlacement     _coresPlacement          = CoresPlacement::ANY;  //!< Placement of streams on hybrid CPUs
+        std::vector<std::vector<int>> _streamsProcessors;  //!< Logical processors of each stream. Empty if streams are not placed
 
         /**
          * @brief      A constructor with arguments
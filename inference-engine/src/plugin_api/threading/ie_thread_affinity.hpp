@@ -8,6 +8,7 @@
 
 #include <tuple>
 #include <memory>
+#include <vector>
 
 #if !(defined(__APPLE__) || defined(_WIN32))
 #include <sched.h>
@@ -77,6 +78,15 @@ INFERENCE_ENGINE_API_CPP(bool) PinThreadToVacantCore(int thrIdx, int hyperThread
  */
 INFERENCE_ENGINE_API_CPP(bool) PinCurrentThreadByMask(int ncores, const CpuSet& processMask);
 
+/**
+ * @brief      Pins current thread to a set of logical processors, while respecting the process mask
+ * @ingroup    ie_dev_api_threading
+ *
+ * @param[in]  processors  Ids of logical processors
+ * @return     `True` in case of success, `false` otherwise
+ */
+INFERENCE_ENGINE_API_CPP(bool) PinCurrentThreadToProcessors(const std::vector<int>& processors);
+
 /**
  * @brief      Pins a current thread to a socket.
  * @ingroup    ie_dev_api_threading
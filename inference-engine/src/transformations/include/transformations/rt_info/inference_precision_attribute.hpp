@@ -0,0 +1,74 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Defines inference precision attribute
+ * @file inference_precision_attribute.hpp
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include <ngraph/node.hpp>
+#include <ngraph/variant.hpp>
+#include <transformations_visibility.hpp>
+
+namespace ngraph {
+
+/**
+ * @ingroup ie_runtime_attr_api
+ * @brief InferencePrecision class represents runtime info attribute that
+ * defines precision which plugin should use to execute the operation (e.g. "BF16" or "FP32").
+ * The attribute is usually set by calibration tools to keep per-layer precision plan in the model.
+ */
+class TRANSFORMATIONS_API InferencePrecision {
+private:
+    std::string inference_precision;
+
+public:
+    /**
+     * A default constructor
+     */
+    InferencePrecision() = default;
+
+    /**
+     * @brief      Constructs a new object with the given precision name
+     * @param[in]  inference_precision  The precision name
+     */
+    explicit InferencePrecision(const std::string &inference_precision) : inference_precision(inference_precision) {}
+
+    /**
+     * @brief return string with inference precision value
+     */
+    std::string getInferencePrecision() const;
+};
+
+extern template class TRANSFORMATIONS_API VariantImpl<InferencePrecision>;
+
+template<>
+class TRANSFORMATIONS_API VariantWrapper<InferencePrecision> : public VariantImpl<InferencePrecision> {
+public:
+    static constexpr VariantTypeInfo type_info{"Variant::RuntimeAttribute::InferencePrecision", 0};
+
+    const VariantTypeInfo &get_type_info() const override {
+        return type_info;
+    }
+
+    VariantWrapper(const value_type &value) : VariantImpl<value_type>(value) {}
+
+    std::shared_ptr<ngraph::Variant> merge(const ngraph::NodeVector & nodes) override;
+
+    std::shared_ptr<ngraph::Variant> init(const std::shared_ptr<ngraph::Node> & node) override;
+};
+
+/**
+ * @ingroup ie_runtime_attr_api
+ * @brief getInferencePrecision return string with inference precision value
+ * @param[in] node The node will be used to get InferencePrecision attribute
+ */
+TRANSFORMATIONS_API std::string getInferencePrecision(const std::shared_ptr<ngraph::Node> & node);
+
+}  // namespace ngraph
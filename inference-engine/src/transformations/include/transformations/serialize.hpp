@@ -21,6 +21,8 @@ class TRANSFORMATIONS_API Serialize;
 /**
  * @ingroup ie_transformation_common_api
  * @brief Serialize transformation converts ngraph::Function into IR files
+ * Layers are written to the xml file as soon as they are serialized and constants
+ * are hashed for deduplication on all threads before they are written.
  * @attention
  * - dynamic shapes are not supported
  * - order of generated layers in xml file is ngraph specific (given by
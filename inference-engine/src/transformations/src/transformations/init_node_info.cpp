@@ -5,6 +5,7 @@
 #include "itt.hpp"
 #include "transformations/init_node_info.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
+#include "transformations/rt_info/inference_precision_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
 
 #include <memory>
@@ -28,6 +29,11 @@ bool ngraph::pass::InitNodeInfo::run_on_function(std::shared_ptr<ngraph::Functio
                 [](const std::string & value) -> std::shared_ptr<Variant> {
                     return std::make_shared<VariantWrapper<PrimitivesPriority> >(PrimitivesPriority(value));
                 }
+            },
+            {"InferencePrecision",
+                [](const std::string & value) -> std::shared_ptr<Variant> {
+                    return std::make_shared<VariantWrapper<InferencePrecision> >(InferencePrecision(value));
+                }
             }
     };
 
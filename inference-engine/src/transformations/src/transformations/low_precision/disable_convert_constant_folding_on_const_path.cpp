@@ -27,6 +27,9 @@ ngraph::pass::DisableConvertConstantFoldingOnConstPath::DisableConvertConstantFo
     ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher & m) -> bool {
         const auto& opsMap = m.get_pattern_value_map();
         const auto convert = opsMap.at(matcherConvert).get_node_shared_ptr();
+        if (transformation_callback(convert)) {
+            return false;
+        }
 
         // validation by Convert operation input precisions
         if (!inputPrecisions.empty()) {
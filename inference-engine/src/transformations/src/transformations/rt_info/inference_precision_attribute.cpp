@@ -0,0 +1,57 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <set>
+#include <string>
+
+#include <ngraph/node.hpp>
+#include <ngraph/variant.hpp>
+
+#include "transformations/rt_info/inference_precision_attribute.hpp"
+
+namespace ngraph {
+
+template class ngraph::VariantImpl<InferencePrecision>;
+
+constexpr VariantTypeInfo VariantWrapper<InferencePrecision>::type_info;
+
+std::string InferencePrecision::getInferencePrecision() const {
+    return inference_precision;
+}
+
+std::shared_ptr<ngraph::Variant> VariantWrapper<InferencePrecision>::merge(const ngraph::NodeVector & nodes) {
+    std::set<std::string> unique_precisions;
+    for (auto &node : nodes) {
+        std::string precision = getInferencePrecision(node);
+        if (!precision.empty()) unique_precisions.insert(precision);
+    }
+
+    // fused operation can be executed in reduced precision only if all its parts can
+    std::string final_precision;
+    if (unique_precisions.size() == 1) {
+        final_precision = *unique_precisions.begin();
+    } else if (unique_precisions.size() > 1) {
+        final_precision = "FP32";
+    }
+    return std::make_shared<VariantWrapper<InferencePrecision> >(InferencePrecision(final_precision));
+}
+
+std::shared_ptr<ngraph::Variant> VariantWrapper<InferencePrecision>::init(const std::shared_ptr<ngraph::Node> & node) {
+    throw ngraph_error(std::string(type_info.name) + " has no default initialization.");
+}
+
+std::string getInferencePrecision(const std::shared_ptr<ngraph::Node> &node) {
+    const auto &rtInfo = node->get_rt_info();
+    using InferencePrecisionWrapper = VariantWrapper<InferencePrecision>;
+
+    if (!rtInfo.count(InferencePrecisionWrapper::type_info.name)) return "";
+
+    const auto &attr = rtInfo.at(InferencePrecisionWrapper::type_info.name);
+    if (auto precision = as_type_ptr<InferencePrecisionWrapper>(attr))
+        return precision->get().getInferencePrecision();
+    return "";
+}
+
+}  // namespace ngraph
@@ -3,16 +3,19 @@
 //
 
 #include "itt.hpp"
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstdint>
 #include <fstream>
+#include <sstream>
 #include <unordered_map>
 #include <unordered_set>
 
 #include <ngraph/variant.hpp>
 #include "ngraph/ops.hpp"
 #include "ngraph/opsets/opset.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "pugixml.hpp"
 #include "transformations/serialize.hpp"
 
@@ -74,6 +77,30 @@ size_t hash_combine(const void* v, int64_t size) {
     return seed;
 }
 
+// Big constants are hashed by blocks, so a single constant can be hashed by several threads.
+constexpr int64_t hash_block_size = 1 << 20;
+
+int64_t hash_blocks_count(int64_t size) {
+    return std::max<int64_t>(1, (size + hash_block_size - 1) / hash_block_size);
+}
+
+size_t hash_block(const char* ptr, int64_t size, int64_t block) {
+    const int64_t begin = block * hash_block_size;
+    return hash_combine(ptr + begin, std::min(size - begin, hash_block_size));
+}
+
+size_t hash_combine_blocks(const size_t* block_hashes, int64_t size) {
+    const auto blocks_count = hash_blocks_count(size);
+    if (blocks_count == 1) {
+        return block_hashes[0];
+    }
+    size_t seed = static_cast<size_t>(size);
+    for (int64_t block = 0; block < blocks_count; ++block) {
+        seed ^= block_hashes[block] + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+    return seed;
+}
+
 class ConstantWriter {
 public:
     using FilePosition = int64_t;
@@ -82,41 +109,137 @@ public:
 
     ConstantWriter(std::ostream& bin_data, bool enable_compression = true)
         : m_binary_output(bin_data)
-        , m_enable_compression(enable_compression) {
+        , m_enable_compression(enable_compression)
+        , m_blob_offset(bin_data.tellp()) {
+    }
+
+    // Hashes the given constants on all threads before the serialization starts, so the
+    // writes done during the graph traversal do not need to read the data twice.
+    void prepare(const std::vector<std::shared_ptr<ngraph::op::v0::Constant>>& constants) {
+        if (!m_enable_compression) {
+            return;
+        }
+        std::vector<size_t> first_blocks;
+        size_t blocks_count = 0;
+        for (const auto& constant : constants) {
+            first_blocks.push_back(blocks_count);
+            blocks_count += hash_blocks_count(get_byte_size(*constant));
+        }
+
+        std::vector<HashValue> block_hashes(blocks_count);
+        runtime::reference::parallel_for(blocks_count, 1, [&](size_t begin, size_t end) {
+            size_t idx = std::upper_bound(first_blocks.begin(), first_blocks.end(), begin) -
+                         first_blocks.begin() - 1;
+            for (size_t block = begin; block < end; ++block) {
+                while (idx + 1 < first_blocks.size() && first_blocks[idx + 1] <= block) {
+                    ++idx;
+                }
+                const auto& constant = *constants[idx];
+                block_hashes[block] = hash_block(static_cast<const char*>(constant.get_data_ptr()),
+                                                 get_byte_size(constant),
+                                                 block - first_blocks[idx]);
+            }
+        });
+
+        for (size_t idx = 0; idx < constants.size(); ++idx) {
+            const auto size = get_byte_size(*constants[idx]);
+            m_prepared_hashes[constants[idx]->get_data_ptr()] = {
+                size, hash_combine_blocks(&block_hashes[first_blocks[idx]], size)};
+        }
     }
 
     FilePosition write(const char* ptr, size_t size) {
-        const auto offset = m_binary_output.tellp();
+        const auto offset = m_blob_offset;
         if (!m_enable_compression) {
-            m_binary_output.write(ptr, size);
+            write_blob(ptr, size);
             return offset;
         }
         // The biggest supported models have at maximum 1-2 thousand constant nodes,
         // with 64 bit hash that gives a probability around 1 in 10 trillion that a
         // hash collision will appear. Because of this, a choice has been made to
         // not perform collision detection and keep the hashing quick and seamless.
-        const HashValue hash = hash_combine(ptr, size);
+        const HashValue hash = get_hash(ptr, size);
         const auto found = m_hash_to_file_positions.find(hash);
         if (found != end(m_hash_to_file_positions)) {
             return found->second;
         }
 
-        m_binary_output.write(ptr, size);
+        write_blob(ptr, size);
         m_hash_to_file_positions.insert({hash, offset});
 
         return offset;
     }
 
 private:
+    static int64_t get_byte_size(const ngraph::op::v0::Constant& constant) {
+        return shape_size(constant.get_shape()) * constant.get_element_type().size();
+    }
+
+    HashValue get_hash(const char* ptr, size_t size) const {
+        const auto found = m_prepared_hashes.find(ptr);
+        if (found != end(m_prepared_hashes) && found->second.first == static_cast<int64_t>(size)) {
+            return found->second.second;
+        }
+        const auto blocks_count = hash_blocks_count(size);
+        std::vector<HashValue> block_hashes(blocks_count);
+        for (int64_t block = 0; block < blocks_count; ++block) {
+            block_hashes[block] = hash_block(ptr, size, block);
+        }
+        return hash_combine_blocks(block_hashes.data(), size);
+    }
+
+    void write_blob(const char* ptr, size_t size) {
+        m_binary_output.write(ptr, size);
+        m_blob_offset += size;
+    }
+
     ConstWritePositions m_hash_to_file_positions;
+    std::unordered_map<const void*, std::pair<int64_t, HashValue>> m_prepared_hashes;
     std::ostream& m_binary_output;
     bool m_enable_compression;
+    FilePosition m_blob_offset;
+};
+
+// Writes the IR xml to the stream while the function is being serialized: every layer is
+// written and removed from the document as soon as it is complete, so the document of the
+// whole network is never kept in memory. The output is the same as pugi::xml_document::save.
+class XmlLayerStream {
+public:
+    explicit XmlLayerStream(std::ostream& xml_file)
+        : m_xml_file(xml_file) {
+    }
+
+    void begin(const pugi::xml_node& net) {
+        // print the start tag with pugixml, so attribute values are escaped in the same way
+        std::stringstream net_xml;
+        net.print(net_xml, "", pugi::format_raw);
+        const auto net_xml_str = net_xml.str();
+        m_xml_file << "<?xml version=\"1.0\"?>\n"
+                   << net_xml_str.substr(0, net_xml_str.find('>') + 1) << "\n"
+                   << "\t<layers>\n";
+    }
+
+    void write_layer(const pugi::xml_node& layer) {
+        layer.print(m_xml_file, "\t", pugi::format_default, pugi::encoding_auto, 2);
+    }
+
+    void end(const pugi::xml_node& net) {
+        m_xml_file << "\t</layers>\n";
+        for (auto child = net.child("layers").next_sibling(); child; child = child.next_sibling()) {
+            child.print(m_xml_file, "\t", pugi::format_default, pugi::encoding_auto, 1);
+        }
+        m_xml_file << "</net>\n";
+    }
+
+private:
+    std::ostream& m_xml_file;
 };
 
 void ngfunction_2_irv10(pugi::xml_node& node,
                         const ngraph::Function& f,
                         const std::map<std::string, ngraph::OpSet>& custom_opsets,
-                        ConstantWriter& constant_write_handler);
+                        ConstantWriter& constant_write_handler,
+                        XmlLayerStream* layer_stream = nullptr);
 
 // Some of the operators were added to wrong opsets. This is a mapping
 // that allows such operators to be serialized with proper opsets.
@@ -137,6 +260,7 @@ namespace rt_info {
 const std::vector<std::string> list_of_names {
     "PrimitivesPriority",
     "alt_width",
+    "InferencePrecision",
 };
 
 class XmlSerializer {
@@ -563,6 +687,17 @@ bool is_exec_graph(const ngraph::Function& f) {
     return false;
 }
 
+void collect_constants(const ngraph::Function& f,
+                       std::vector<std::shared_ptr<op::v0::Constant>>& constants) {
+    for (const auto& op : f.get_ops()) {
+        if (auto constant = as_type_ptr<op::v0::Constant>(op)) {
+            constants.push_back(constant);
+        } else if (auto op_subgraph = std::dynamic_pointer_cast<op::util::SubGraphOp>(op)) {
+            collect_constants(*op_subgraph->get_function(), constants);
+        }
+    }
+}
+
 bool has_dynamic_output(std::shared_ptr<Node> n) {
     for (size_t i = 0; i < n->get_output_size(); i++) {
         if (n->get_output_partial_shape(i).is_dynamic()) {
@@ -638,15 +773,21 @@ bool resolve_dynamic_shapes(const ngraph::Function& f) {
     return true;
 }
 
+constexpr size_t file_buffer_size = 4 << 20;
+
 void ngfunction_2_irv10(pugi::xml_node& netXml,
                         const ngraph::Function& f,
                         const std::map<std::string, ngraph::OpSet>& custom_opsets,
-                        ConstantWriter& constant_node_write_handler) {
+                        ConstantWriter& constant_node_write_handler,
+                        XmlLayerStream* layer_stream) {
     const bool exec_graph = is_exec_graph(f);
 
     netXml.append_attribute("name").set_value(f.get_friendly_name().c_str());
     netXml.append_attribute("version").set_value("10");
     pugi::xml_node layers = netXml.append_child("layers");
+    if (layer_stream) {
+        layer_stream->begin(netXml);
+    }
 
     const std::unordered_map<ngraph::Node*, int> layer_ids =
         create_layer_ids(f);
@@ -751,6 +892,10 @@ void ngfunction_2_irv10(pugi::xml_node& netXml,
                 layer.insert_move_after(output, layer.first_child());
             }
         }
+        if (layer_stream) {
+            layer_stream->write_layer(layer);
+            layers.remove_child(layer);
+        }
     }
     // <edges>
     const std::vector<Edge> edge_mapping = create_edge_mapping(layer_ids, f);
@@ -769,6 +914,9 @@ void ngfunction_2_irv10(pugi::xml_node& netXml,
         edge.append_attribute("to-layer").set_value(e.to_layer);
         edge.append_attribute("to-port").set_value(e.to_port);
     }
+    if (layer_stream) {
+        layer_stream->end(netXml);
+    }
     // move back dynamic shapes
     if (has_dynamic_shapes) {
         f.validate_nodes_and_infer_types();
@@ -785,14 +933,17 @@ bool pass::Serialize::run_on_function(std::shared_ptr<ngraph::Function> f) {
         switch (m_version) {
         case Version::IR_V10:
             {
-                std::string name = "net";
                 pugi::xml_document xml_doc;
-                pugi::xml_node net_node = xml_doc.append_child(name.c_str());
+                pugi::xml_node net_node = xml_doc.append_child("net");
                 ConstantWriter constant_write_handler(bin_file);
-                XmlSerializer visitor(net_node, name, m_custom_opsets, constant_write_handler);
-                visitor.on_attribute(name, f);
+                if (!is_exec_graph(*f)) {
+                    std::vector<std::shared_ptr<op::v0::Constant>> constants;
+                    collect_constants(*f, constants);
+                    constant_write_handler.prepare(constants);
+                }
+                XmlLayerStream layer_stream(xml_file);
+                ngfunction_2_irv10(net_node, *f, m_custom_opsets, constant_write_handler, &layer_stream);
 
-                xml_doc.save(xml_file);
                 xml_file.flush();
                 bin_file.flush();
             }
@@ -806,11 +957,18 @@ bool pass::Serialize::run_on_function(std::shared_ptr<ngraph::Function> f) {
     if (m_xmlFile && m_binFile) {
         serializeFunc(*m_xmlFile, *m_binFile);
     } else {
-        std::ofstream bin_file(m_binPath, std::ios::out | std::ios::binary);
+        // small constants are gathered in a big buffer instead of being written one by one
+        std::vector<char> bin_buffer(file_buffer_size);
+        std::ofstream bin_file;
+        bin_file.rdbuf()->pubsetbuf(bin_buffer.data(), bin_buffer.size());
+        bin_file.open(m_binPath, std::ios::out | std::ios::binary);
         NGRAPH_CHECK(bin_file, "Can't open bin file: \"" + m_binPath + "\"");
 
         // create xml file
-        std::ofstream xml_file(m_xmlPath, std::ios::out);
+        std::vector<char> xml_buffer(file_buffer_size);
+        std::ofstream xml_file;
+        xml_file.rdbuf()->pubsetbuf(xml_buffer.data(), xml_buffer.size());
+        xml_file.open(m_xmlPath, std::ios::out);
         NGRAPH_CHECK(xml_file, "Can't open xml file: \"" + m_xmlPath + "\"");
 
         serializeFunc(xml_file, bin_file);
@@ -0,0 +1,235 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+#include <gtest/gtest.h>
+
+#include <ie_plugin_config.hpp>
+#include <ie_system_conf.h>
+#include <threading/ie_istreams_executor.hpp>
+
+#include "common_test_utils/file_utils.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+// 8 performance cores with hyper-threading (processors 0-15) and 8 efficient cores (processors 16-23)
+CPUTopology makeHybridTopology() {
+    CPUTopology topology;
+    for (int id = 0; id < 24; id++) {
+        CPUProcessor processor;
+        processor.id = id;
+        processor.coreId = id < 16 ? id - id % 2 : id;
+        processor.type = id < 16 ? CPUCoreType::PERFORMANCE : CPUCoreType::EFFICIENT;
+        topology.processors.push_back(processor);
+    }
+    return topology;
+}
+
+CPUCoreType getCoreType(const CPUTopology& topology, int id) {
+    for (auto&& processor : topology.processors) {
+        if (processor.id == id)
+            return processor.type;
+    }
+    throw std::logic_error("Unknown processor " + std::to_string(id));
+}
+
+}  // namespace
+
+#ifdef __linux__
+class FakeSysfsTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        _root = "fake_sysfs_" + std::to_string(getpid());
+        makeDirectory(_root);
+    }
+
+    void TearDown() override {
+        for (auto it = _files.rbegin(); it != _files.rend(); ++it)
+            CommonTestUtils::removeFile(*it);
+        for (auto it = _directories.rbegin(); it != _directories.rend(); ++it)
+            CommonTestUtils::removeDir(*it);
+    }
+
+    void makeDirectory(const std::string& path) {
+        if (!CommonTestUtils::directoryExists(path)) {
+            ASSERT_EQ(0, CommonTestUtils::createDirectory(path));
+            _directories.push_back(path);
+        }
+    }
+
+    void writeFile(const std::string& relativePath, const std::string& content) {
+        std::string path = _root;
+        std::string::size_type begin = 0, end = 0;
+        while ((end = relativePath.find('/', begin)) != std::string::npos) {
+            path += "/" + relativePath.substr(begin, end - begin);
+            makeDirectory(path);
+            begin = end + 1;
+        }
+        path += "/" + relativePath.substr(begin);
+        CommonTestUtils::createFile(path, content + "\n");
+        _files.push_back(path);
+    }
+
+    void writeProcessor(int id, const std::string& siblings) {
+        writeFile("devices/system/cpu/cpu" + std::to_string(id) + "/topology/thread_siblings_list", siblings);
+    }
+
+    std::string _root;
+    std::vector<std::string> _files;
+    std::vector<std::string> _directories;
+};
+
+TEST_F(FakeSysfsTests, readsHybridTopologyFromAtomPmu) {
+    writeFile("devices/system/cpu/online", "0-23");
+    for (int id = 0; id < 24; id++) {
+        const int core = id < 16 ? id - id % 2 : id;
+        writeProcessor(id, id < 16 ? std::to_string(core) + "-" + std::to_string(core + 1) : std::to_string(id));
+    }
+    writeFile("devices/cpu_core/cpus", "0-15");
+    writeFile("devices/cpu_atom/cpus", "16-23");
+
+    const auto topology = readCPUTopology(_root);
+    ASSERT_EQ(24, topology.processors.size());
+    ASSERT_TRUE(topology.isHybrid());
+    for (auto&& processor : topology.processors) {
+        EXPECT_EQ(processor.id < 16 ? processor.id - processor.id % 2 : processor.id, processor.coreId);
+        EXPECT_EQ(processor.id < 16 ? CPUCoreType::PERFORMANCE : CPUCoreType::EFFICIENT, processor.type);
+    }
+}
+
+TEST_F(FakeSysfsTests, readsHeterogeneousTopologyFromCapacity) {
+    writeFile("devices/system/cpu/online", "0-3");
+    for (int id = 0; id < 4; id++) {
+        writeProcessor(id, std::to_string(id));
+        writeFile("devices/system/cpu/cpu" + std::to_string(id) + "/cpu_capacity", id < 2 ? "446" : "1024");
+    }
+
+    const auto topology = readCPUTopology(_root);
+    ASSERT_EQ(4, topology.processors.size());
+    ASSERT_TRUE(topology.isHybrid());
+    EXPECT_EQ(CPUCoreType::EFFICIENT, topology.processors[0].type);
+    EXPECT_EQ(CPUCoreType::EFFICIENT, topology.processors[1].type);
+    EXPECT_EQ(CPUCoreType::PERFORMANCE, topology.processors[2].type);
+    EXPECT_EQ(CPUCoreType::PERFORMANCE, topology.processors[3].type);
+}
+
+TEST_F(FakeSysfsTests, readsHomogeneousTopology) {
+    writeFile("devices/system/cpu/online", "0-1,4");
+    writeProcessor(0, "0,4");
+    writeProcessor(1, "1");
+    writeProcessor(4, "0,4");
+
+    const auto topology = readCPUTopology(_root);
+    ASSERT_EQ(3, topology.processors.size());
+    ASSERT_FALSE(topology.isHybrid());
+    EXPECT_EQ(0, topology.processors[0].coreId);
+    EXPECT_EQ(1, topology.processors[1].coreId);
+    EXPECT_EQ(4, topology.processors[2].id);
+    EXPECT_EQ(0, topology.processors[2].coreId);
+}
+
+TEST_F(FakeSysfsTests, returnsEmptyTopologyWithoutSysfs) {
+    ASSERT_TRUE(readCPUTopology(_root + "/missing").processors.empty());
+}
+
+TEST(CPUTopologyTests, followsAffinityOfProcess) {
+    const auto topology = getCPUTopology();
+    if (topology.processors.size() < 2)
+        GTEST_SKIP() << "Affinity can not be narrowed";
+
+    cpu_set_t original;
+    CPU_ZERO(&original);
+    ASSERT_EQ(0, sched_getaffinity(0, sizeof(original), &original));
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    CPU_SET(topology.processors.back().id, &mask);
+    ASSERT_EQ(0, sched_setaffinity(0, sizeof(mask), &mask));
+    const auto narrowed = getCPUTopology();
+    sched_setaffinity(0, sizeof(original), &original);
+
+    ASSERT_EQ(1, narrowed.processors.size());
+    EXPECT_EQ(topology.processors.back().id, narrowed.processors.front().id);
+    EXPECT_EQ(topology.processors.size(), getCPUTopology().processors.size());
+}
+#endif  // __linux__
+
+TEST(StreamsPlacementTests, latencyStreamUsesPhysicalPerformanceCores) {
+    IStreamsExecutor::Config config;
+    config.SetConfig(CONFIG_KEY(CPU_CORES_PLACEMENT), CONFIG_VALUE(CPU_CORES_HYBRID_AWARE));
+    config._threads = 8;
+    const auto result = IStreamsExecutor::Config::MakeDefaultMultiThreaded(config, makeHybridTopology());
+
+    ASSERT_EQ(8, result._threadsPerStream);
+    ASSERT_EQ(1, result._streamsProcessors.size());
+    EXPECT_EQ(std::vector<int>({0, 2, 4, 6, 8, 10, 12, 14}), result._streamsProcessors[0]);
+}
+
+TEST(StreamsPlacementTests, throughputStreamsUseAllCoresWithoutMixingTypes) {
+    const auto topology = makeHybridTopology();
+    IStreamsExecutor::Config config;
+    config.SetConfig(CONFIG_KEY(CPU_CORES_PLACEMENT), CONFIG_VALUE(CPU_CORES_HYBRID_AWARE));
+    config._streams = 6;
+    config._threads = 24;
+    const auto result = IStreamsExecutor::Config::MakeDefaultMultiThreaded(config, topology);
+
+    ASSERT_EQ(4, result._threadsPerStream);
+    ASSERT_EQ(6, result._streamsProcessors.size());
+    EXPECT_EQ(std::vector<int>({0, 2, 4, 6}), result._streamsProcessors[0]);
+    EXPECT_EQ(std::vector<int>({16, 17, 18, 19}), result._streamsProcessors[4]);
+    EXPECT_EQ(std::vector<int>({20, 21, 22, 23}), result._streamsProcessors[5]);
+    for (auto&& processors : result._streamsProcessors) {
+        ASSERT_EQ(4, processors.size());
+        for (auto&& id : processors)
+            EXPECT_EQ(getCoreType(topology, processors.front()), getCoreType(topology, id));
+    }
+}
+
+TEST(StreamsPlacementTests, performancePlacementSkipsEfficientCores) {
+    const auto topology = makeHybridTopology();
+    IStreamsExecutor::Config config;
+    config.SetConfig(CONFIG_KEY(CPU_CORES_PLACEMENT), CONFIG_VALUE(CPU_CORES_PERFORMANCE));
+    config._streams = 4;
+    config._threads = 16;
+    const auto result = IStreamsExecutor::Config::MakeDefaultMultiThreaded(config, topology);
+
+    ASSERT_EQ(4, result._streamsProcessors.size());
+    for (auto&& processors : result._streamsProcessors) {
+        for (auto&& id : processors)
+            EXPECT_EQ(CPUCoreType::PERFORMANCE, getCoreType(topology, id));
+    }
+}
+
+TEST(StreamsPlacementTests, streamsAreNotPlacedByDefault) {
+    IStreamsExecutor::Config config;
+    config._streams = 4;
+    config._threads = 16;
+    ASSERT_EQ(CONFIG_VALUE(CPU_CORES_ANY), config.GetConfig(CONFIG_KEY(CPU_CORES_PLACEMENT)).as<std::string>());
+    ASSERT_TRUE(IStreamsExecutor::Config::MakeDefaultMultiThreaded(config, makeHybridTopology())._streamsProcessors.empty());
+}
+
+TEST(StreamsPlacementTests, streamsAreNotPlacedOnHomogeneousCpu) {
+    auto topology = makeHybridTopology();
+    for (auto&& processor : topology.processors)
+        processor.type = CPUCoreType::PERFORMANCE;
+    IStreamsExecutor::Config config;
+    config.SetConfig(CONFIG_KEY(CPU_CORES_PLACEMENT), CONFIG_VALUE(CPU_CORES_HYBRID_AWARE));
+    config._streams = 4;
+    config._threads = 16;
+    ASSERT_TRUE(IStreamsExecutor::Config::MakeDefaultMultiThreaded(config, topology)._streamsProcessors.empty());
+}
+
+TEST(StreamsPlacementTests, throwsOnWrongPlacement) {
+    IStreamsExecutor::Config config;
+    ASSERT_THROW(config.SetConfig(CONFIG_KEY(CPU_CORES_PLACEMENT), "BIG"), Exception);
+}
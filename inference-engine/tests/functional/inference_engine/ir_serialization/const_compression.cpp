@@ -3,6 +3,7 @@
 //
 
 #include <fstream>
+#include <numeric>
 
 #include "common_test_utils/ngraph_test_utils.hpp"
 #include "ie_core.hpp"
@@ -229,3 +230,46 @@ TEST_F(SerializatioConstantCompressionTest, IdenticalConstantsDifferentTypesI32I
 
     ASSERT_TRUE(file_size(bin_1) == unique_const_count * ngraph::shape_size(shape) * sizeof(int32_t));
 }
+
+TEST_F(SerializatioConstantCompressionTest, IdenticalBigConstants) {
+    constexpr int unique_const_count = 1;
+    // big enough to be hashed by several blocks
+    const ngraph::Shape shape{3, 1024, 1024};
+
+    std::vector<float> values(ngraph::shape_size(shape));
+    std::iota(values.begin(), values.end(), 0.f);
+    auto A = ngraph::op::Constant::create(ngraph::element::f32, shape, values);
+    auto B = ngraph::op::Constant::create(ngraph::element::f32, shape, values);
+
+    auto ngraph_a = std::make_shared<ngraph::Function>(ngraph::NodeVector{A, B},
+        ngraph::ParameterVector{});
+
+    ngraph::pass::Serialize(m_out_xml_path_1, m_out_bin_path_1).run_on_function(ngraph_a);
+
+    std::ifstream xml_1(m_out_xml_path_1, std::ios::binary);
+    std::ifstream bin_1(m_out_bin_path_1, std::ios::binary);
+
+    ASSERT_TRUE(file_size(bin_1) == unique_const_count * ngraph::shape_size(shape) * sizeof(float));
+}
+
+TEST_F(SerializatioConstantCompressionTest, NonIdenticalBigConstants) {
+    constexpr int unique_const_count = 2;
+    const ngraph::Shape shape{3, 1024, 1024};
+
+    std::vector<float> values(ngraph::shape_size(shape));
+    std::iota(values.begin(), values.end(), 0.f);
+    auto A = ngraph::op::Constant::create(ngraph::element::f32, shape, values);
+    // differs from A in the last hashed block only
+    values.back() = -1.f;
+    auto B = ngraph::op::Constant::create(ngraph::element::f32, shape, values);
+
+    auto ngraph_a = std::make_shared<ngraph::Function>(ngraph::NodeVector{A, B},
+        ngraph::ParameterVector{});
+
+    ngraph::pass::Serialize(m_out_xml_path_1, m_out_bin_path_1).run_on_function(ngraph_a);
+
+    std::ifstream xml_1(m_out_xml_path_1, std::ios::binary);
+    std::ifstream bin_1(m_out_bin_path_1, std::ios::binary);
+
+    ASSERT_TRUE(file_size(bin_1) == unique_const_count * ngraph::shape_size(shape) * sizeof(float));
+}
@@ -12,6 +12,7 @@
 
 #include "common_test_utils/ngraph_test_utils.hpp"
 #include "low_precision/transformer.hpp"
+#include "lpt_ngraph_functions/convolution_function.hpp"
 
 using namespace testing;
 using namespace ngraph;
@@ -54,3 +55,33 @@ TEST(LPT, isQuantizedTransformation) {
         ASSERT_NO_THROW(transformation.second->isQuantized(layer));
     }
 }
+
+TEST(LPT, collectStatistics) {
+    const auto function = ngraph::builder::subgraph::ConvolutionFunction::get(
+        Shape({ 1, 3, 16, 16 }),
+        element::f32,
+        { 256ul, {}, { 0.f }, { 2.55f }, { 0.f }, { 2.55f } },
+        std::vector<float>({ 1.f }),
+        { 255ul, Shape({ 1, 1, 1, 1 }), { 0.f }, { 254.f }, { -1.27f }, { 1.27f } });
+
+    low_precision::LowPrecisionTransformer transformer;
+    transformer.transform(ngraph::clone_function(*function));
+    ASSERT_TRUE(transformer.getStatistics().stages.empty());
+    ASSERT_TRUE(transformer.getStatistics().transformations.empty());
+
+    transformer.setCollectStatistics(true);
+    transformer.transform(function);
+
+    const auto& statistics = transformer.getStatistics();
+    ASSERT_EQ(8ul, statistics.stages.size());
+    ASSERT_EQ("ConstantFolding", statistics.stages.front().first);
+    ASSERT_EQ("Validation", statistics.stages.back().first);
+
+    size_t transformed = 0ul;
+    for (const auto& it : statistics.transformations) {
+        ASSERT_FALSE(it.first.empty());
+        ASSERT_LE(it.second.transformed, it.second.matched);
+        transformed += it.second.transformed;
+    }
+    ASSERT_LT(0ul, transformed);
+}
@@ -20,6 +20,7 @@
 #include <legacy/transformations/convert_opset1_to_legacy/convert_matmul_to_fc_or_gemm.hpp>
 #include <legacy/transformations/convert_opset1_to_legacy/reshape_fully_connected.hpp>
 #include <transformations/init_node_info.hpp>
+#include <transformations/rt_info/dequantization_attribute.hpp>
 #include <transformations/utils/utils.hpp>
 #include <ngraph/pass/manager.hpp>
 
@@ -259,6 +260,46 @@ TEST(TransformationTests, ConvertMatMulTest7) {
     ASSERT_TRUE(res.first) << res.second;
 }
 
+TEST(TransformationTests, ConvertMatMulDecompressedWeights) {
+    auto makeDecompressedWeights = []() {
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::u8, ngraph::Shape{4, 2}, {1});
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        auto zeroPoints = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{4, 1}, {128});
+        auto subtract = std::make_shared<ngraph::opset1::Subtract>(convert, zeroPoints);
+        auto scales = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{4, 1}, {0.1});
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(subtract, scales);
+        multiply->get_rt_info()["DEQUANTIZATION"] =
+            std::make_shared<ngraph::VariantWrapper<ngraph::DequantizationAttr>>(ngraph::DequantizationAttr("multiply"));
+        return multiply;
+    };
+
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{3, 2});
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(input1, makeDecompressedWeights(), false, true);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{matmul}, ngraph::ParameterVector{input1});
+
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<ngraph::pass::ConvertMatMulToFC>();
+        m.register_pass<ngraph::pass::ConvertMatMulToGemm>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{3, 2});
+        auto bias = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{4}, {0});
+        auto fc = std::make_shared<ngraph::op::FullyConnected>(input1, makeDecompressedWeights(), bias, ngraph::Shape{3, 4});
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{fc}, ngraph::ParameterVector{input1});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
 TEST(TransformationTests, ConvertMatMulDynamic) {
         auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::PartialShape::dynamic());
         auto input2 = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{2, 2}, {1});
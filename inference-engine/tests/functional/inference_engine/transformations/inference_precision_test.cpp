@@ -0,0 +1,90 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/variant.hpp>
+#include <transformations/init_node_info.hpp>
+#include <transformations/rt_info/inference_precision_attribute.hpp>
+#include <cpp/ie_cnn_network.h>
+#include <legacy/cnn_network_impl.hpp>  // deprecated API
+#include <legacy/ie_layers.h>  // deprecated API
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+
+namespace {
+
+std::shared_ptr<ngraph::Function> makeMatMulAdd(const std::string& matMulPrecision, const std::string& addPrecision) {
+    auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 16});
+    auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{16, 8}, {1});
+    auto matMul = std::make_shared<ngraph::opset1::MatMul>(input, weights);
+    matMul->set_friendly_name("matmul");
+    auto bias = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 8}, {1});
+    auto add = std::make_shared<ngraph::opset1::Add>(matMul, bias);
+    add->set_friendly_name("add");
+
+    matMul->get_rt_info()["InferencePrecision"] = std::make_shared<ngraph::VariantWrapper<std::string>>(matMulPrecision);
+    add->get_rt_info()["InferencePrecision"] = std::make_shared<ngraph::VariantWrapper<std::string>>(addPrecision);
+    return std::make_shared<ngraph::Function>(ngraph::NodeVector{add}, ngraph::ParameterVector{input});
+}
+
+std::string mergedPrecision(const std::shared_ptr<ngraph::Function>& f) {
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::pass::InitNodeInfo>();
+    manager.run_passes(f);
+
+    auto fused = std::make_shared<ngraph::opset1::Relu>(f->get_parameters()[0]);
+    ngraph::NodeVector nodes;
+    for (auto& op : f->get_ordered_ops()) {
+        if (std::dynamic_pointer_cast<ngraph::opset1::MatMul>(op) || std::dynamic_pointer_cast<ngraph::opset1::Add>(op))
+            nodes.push_back(op);
+    }
+    ngraph::copy_runtime_info(nodes, fused);
+    return ngraph::getInferencePrecision(fused);
+}
+
+}  // namespace
+
+TEST(TransformationTests, InferencePrecisionIsConvertedToLegacyParams) {
+    InferenceEngine::CNNNetwork network(makeMatMulAdd("BF16", "FP32"));
+    auto clonedNetwork = std::make_shared<InferenceEngine::details::CNNNetworkImpl>(network);
+
+    IE_SUPPRESS_DEPRECATED_START
+    InferenceEngine::CNNLayerPtr add;
+    clonedNetwork->getLayerByName("add", add, nullptr);
+    ASSERT_NE(nullptr, add);
+    ASSERT_TRUE(add->params.count("InferencePrecision"));
+    ASSERT_EQ("FP32", add->params.at("InferencePrecision"));
+    IE_SUPPRESS_DEPRECATED_END
+}
+
+TEST(TransformationTests, InferencePrecisionIsInitialized) {
+    auto f = makeMatMulAdd("BF16", "BF16");
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::pass::InitNodeInfo>();
+    manager.run_passes(f);
+
+    for (auto& op : f->get_ordered_ops()) {
+        if (std::dynamic_pointer_cast<ngraph::opset1::Add>(op)) {
+            ASSERT_EQ("BF16", ngraph::getInferencePrecision(op));
+        }
+    }
+}
+
+TEST(TransformationTests, InferencePrecisionMergeKeepsSamePrecision) {
+    ASSERT_EQ("BF16", mergedPrecision(makeMatMulAdd("BF16", "BF16")));
+}
+
+TEST(TransformationTests, InferencePrecisionMergeFallsBackToFP32) {
+    ASSERT_EQ("FP32", mergedPrecision(makeMatMulAdd("BF16", "FP32")));
+}
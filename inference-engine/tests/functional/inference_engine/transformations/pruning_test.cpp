@@ -220,4 +220,182 @@ TEST(TransformationTests, PropagateMasksHardDependencies) {
 //    compare_masks(*getMask(relu),     Mask({{}, {0, 1, 2, 3, 4, 5}, {}, {}}));
 //    compare_masks(*getMask(weights2), Mask({{}, {0, 1, 2, 3, 4, 5}, {}, {}}));
 //    compare_masks(*getMask(conv2),    Mask({{}, {}, {}, {}}));
-}
\ No newline at end of file
+}
+TEST(TransformationTests, PropagateMasksMatMulReshape) {
+    Shape input_shape{1, 3, 3, 3};
+    Shape weights_shape{6, 3, 3, 3};
+    auto input = std::make_shared<opset5::Parameter>(element::f32, input_shape);
+    auto weights = create_constant_with_zeros(weights_shape, {{1, 2}, {}, {}, {}});
+    auto conv = std::make_shared<opset5::Convolution>(input, weights, Strides(2, 1),
+                                                      CoordinateDiff(2, 0), CoordinateDiff(2, 0), Strides(2, 1));
+    auto reshape_const = opset5::Constant::create(element::i64, Shape{2}, {1, 6});
+    auto reshape = std::make_shared<opset5::Reshape>(conv, reshape_const, true);
+
+    auto matmul_weights = opset5::Constant::create(element::f32, Shape{6, 100}, {1.});
+    auto matmul = std::make_shared<opset5::MatMul>(reshape, matmul_weights);
+    auto f = std::make_shared<Function>(NodeVector{matmul}, ParameterVector{input});
+
+    pass::Manager m;
+    m.register_pass<pass::PropagateMasks>();
+    m.run_passes(f);
+
+    compare_masks(*getMask(weights),                   Mask({{1, 2}, {}, {}, {}}));
+    compare_masks(*getMask(conv->output(0)),           Mask({{}, {1, 2}, {}, {}}));
+    compare_masks(*getMask(reshape_const->output(0)),  Mask({{}, {1, 2}}));
+    compare_masks(*getMask(reshape->output(0)),        Mask({{}, {1, 2}}));
+    compare_masks(*getMask(matmul_weights->output(0)), Mask({{1, 2}, {}}));
+    compare_masks(*getMask(matmul->output(0)),         Mask({{}, {}}));
+
+    m.register_pass<pass::ShrinkWeights>();
+    m.run_passes(f);
+
+    ASSERT_EQ(conv->get_output_shape(0), Shape({1, 4, 1, 1}));
+    ASSERT_EQ(reshape->get_output_shape(0), Shape({1, 4}));
+    ASSERT_EQ(matmul->get_output_shape(0), Shape({1, 100}));
+}
+
+TEST(TransformationTests, PropagateMasksFlattenMatMul) {
+    Shape input_shape{1, 3, 4, 4};
+    Shape weights_shape{6, 3, 3, 3};
+    auto input = std::make_shared<opset5::Parameter>(element::f32, input_shape);
+    auto weights = create_constant_with_zeros(weights_shape, {{1, 2}, {}, {}, {}});
+    auto conv = std::make_shared<opset5::Convolution>(input, weights, Strides(2, 1),
+                                                      CoordinateDiff(2, 0), CoordinateDiff(2, 0), Strides(2, 1));
+    auto reshape = std::make_shared<opset5::Reshape>(conv, opset5::Constant::create(element::i64, Shape{2}, {0, -1}), true);
+
+    auto matmul_weights = opset5::Constant::create(element::f32, Shape{10, 24}, {1.});
+    auto matmul = std::make_shared<opset5::MatMul>(reshape, matmul_weights, false, true);
+    auto f = std::make_shared<Function>(NodeVector{matmul}, ParameterVector{input});
+
+    pass::Manager m;
+    m.register_pass<pass::Pruning>();
+    m.run_passes(f);
+
+    // every channel of the convolution output is flattened into 4 values
+    ASSERT_EQ(conv->get_output_shape(0), Shape({1, 4, 2, 2}));
+    ASSERT_EQ(reshape->get_output_shape(0), Shape({1, 16}));
+    ASSERT_EQ(matmul->get_input_shape(1), Shape({10, 16}));
+    ASSERT_EQ(matmul->get_output_shape(0), Shape({1, 10}));
+}
+
+TEST(TransformationTests, PropagateMasksConcat) {
+    Shape input_shape{1, 3, 8, 8};
+    Shape weights_shape{6, 3, 3, 3};
+    auto input = std::make_shared<opset5::Parameter>(element::f32, input_shape);
+    auto weights1 = create_constant_with_zeros(weights_shape, {{0, 3}, {}, {}, {}});
+    auto conv1 = std::make_shared<opset5::Convolution>(input, weights1, Strides(2, 1),
+                                                       CoordinateDiff(2, 0), CoordinateDiff(2, 0), Strides(2, 1));
+    auto weights2 = create_constant_with_zeros(weights_shape, {{1}, {}, {}, {}});
+    auto conv2 = std::make_shared<opset5::Convolution>(input, weights2, Strides(2, 1),
+                                                       CoordinateDiff(2, 0), CoordinateDiff(2, 0), Strides(2, 1));
+    auto concat = std::make_shared<opset5::Concat>(OutputVector{conv1, conv2}, 1);
+
+    auto weights3 = opset5::Constant::create(element::f32, Shape{4, 12, 1, 1}, {1.});
+    auto conv3 = std::make_shared<opset5::Convolution>(concat, weights3, Strides(2, 1),
+                                                       CoordinateDiff(2, 0), CoordinateDiff(2, 0), Strides(2, 1));
+    auto f = std::make_shared<Function>(NodeVector{conv3}, ParameterVector{input});
+
+    pass::Manager m;
+    m.register_pass<pass::PropagateMasks>();
+    m.run_passes(f);
+
+    compare_masks(*getMask(weights1),            Mask({{0, 3}, {}, {}, {}}));
+    compare_masks(*getMask(weights2),            Mask({{1}, {}, {}, {}}));
+    compare_masks(*getMask(concat->output(0)),   Mask({{}, {0, 3, 7}, {}, {}}));
+    compare_masks(*getMask(weights3->output(0)), Mask({{}, {0, 3, 7}, {}, {}}));
+
+    m.register_pass<pass::ShrinkWeights>();
+    m.run_passes(f);
+
+    ASSERT_EQ(concat->get_output_shape(0), Shape({1, 9, 6, 6}));
+    ASSERT_EQ(conv3->get_output_shape(0), Shape({1, 4, 6, 6}));
+}
+
+TEST(TransformationTests, PropagateMasksBroadcastedEltwise) {
+    Shape input_shape{1, 3, 8, 8};
+    Shape weights_shape{6, 3, 3, 3};
+    auto input = std::make_shared<opset5::Parameter>(element::f32, input_shape);
+    auto weights = create_constant_with_zeros(weights_shape, {{1, 2}, {}, {}, {}});
+    auto conv = std::make_shared<opset5::Convolution>(input, weights, Strides(2, 1),
+                                                      CoordinateDiff(2, 0), CoordinateDiff(2, 0), Strides(2, 1));
+    // multiplication by a scalar keeps zero channels
+    auto mul = std::make_shared<opset5::Multiply>(conv, opset5::Constant::create(element::f32, Shape{}, {0.5}));
+    auto weights2 = create_constant_with_zeros(Shape{6, 6, 1, 1}, {{4}, {}, {}, {}});
+    auto conv2 = std::make_shared<opset5::Convolution>(mul, weights2, Strides(2, 1),
+                                                       CoordinateDiff(2, 0), CoordinateDiff(2, 0), Strides(2, 1));
+    // addition of a non zero scalar makes all the channels non zero
+    auto add = std::make_shared<opset5::Add>(conv2, opset5::Constant::create(element::f32, Shape{1, 1, 1, 1}, {1.}));
+    auto weights3 = opset5::Constant::create(element::f32, Shape{6, 6, 1, 1}, {1.});
+    auto conv3 = std::make_shared<opset5::Convolution>(add, weights3, Strides(2, 1),
+                                                       CoordinateDiff(2, 0), CoordinateDiff(2, 0), Strides(2, 1));
+    auto f = std::make_shared<Function>(NodeVector{conv3}, ParameterVector{input});
+
+    pass::Manager m;
+    m.register_pass<pass::PropagateMasks>();
+    m.run_passes(f);
+
+    compare_masks(*getMask(mul->output(0)),      Mask({{}, {1, 2}, {}, {}}));
+    compare_masks(*getMask(weights2),            Mask({{}, {1, 2}, {}, {}}));
+    compare_masks(*getMask(add->output(0)),      Mask({{}, {}, {}, {}}));
+    compare_masks(*getMask(weights3->output(0)), Mask({{}, {}, {}, {}}));
+}
+
+TEST(TransformationTests, PropagateMasksResidual) {
+    Shape input_shape{1, 3, 8, 8};
+    Shape weights_shape{6, 3, 3, 3};
+    auto input = std::make_shared<opset5::Parameter>(element::f32, input_shape);
+    auto weights1 = create_constant_with_zeros(weights_shape, {{1, 2}, {}, {}, {}});
+    auto conv1 = std::make_shared<opset5::Convolution>(input, weights1, Strides(2, 1),
+                                                       CoordinateDiff(2, 0), CoordinateDiff(2, 0), Strides(2, 1));
+    auto relu = std::make_shared<opset5::Relu>(conv1);
+    auto weights2 = create_constant_with_zeros(Shape{6, 6, 1, 1}, {{2, 3}, {}, {}, {}});
+    auto conv2 = std::make_shared<opset5::Convolution>(relu, weights2, Strides(2, 1),
+                                                       CoordinateDiff(2, 0), CoordinateDiff(2, 0), Strides(2, 1));
+    auto add = std::make_shared<opset5::Add>(relu, conv2);
+    auto weights3 = opset5::Constant::create(element::f32, Shape{6, 6, 1, 1}, {1.});
+    auto conv3 = std::make_shared<opset5::Convolution>(add, weights3, Strides(2, 1),
+                                                       CoordinateDiff(2, 0), CoordinateDiff(2, 0), Strides(2, 1));
+    auto f = std::make_shared<Function>(NodeVector{conv3}, ParameterVector{input});
+
+    pass::Manager m;
+    m.register_pass<pass::PropagateMasks>();
+    m.run_passes(f);
+
+    compare_masks(*getMask(weights1),            Mask({{2}, {}, {}, {}}));
+    compare_masks(*getMask(relu->output(0)),     Mask({{}, {2}, {}, {}}));
+    compare_masks(*getMask(weights2),            Mask({{2}, {2}, {}, {}}));
+    compare_masks(*getMask(add->output(0)),      Mask({{}, {2}, {}, {}}));
+    compare_masks(*getMask(weights3->output(0)), Mask({{}, {2}, {}, {}}));
+}
+
+TEST(TransformationTests, PruningReport) {
+    Shape input_shape{1, 3, 22, 22};
+    auto input = std::make_shared<opset5::Parameter>(element::f32, input_shape);
+    auto weights1 = create_constant_with_zeros(Shape{6, 3, 3, 3}, {{0, 1}, {}, {}, {}});
+    auto conv1 = std::make_shared<opset5::Convolution>(input, weights1, Strides(2, 1),
+                                                       CoordinateDiff(2, 0), CoordinateDiff(2, 0), Strides(2, 1));
+    conv1->set_friendly_name("conv1");
+    auto weights2 = opset5::Constant::create(element::f32, Shape{4, 6, 3, 3}, {1.});
+    auto conv2 = std::make_shared<opset5::Convolution>(conv1, weights2, Strides(2, 1),
+                                                       CoordinateDiff(2, 0), CoordinateDiff(2, 0), Strides(2, 1));
+    conv2->set_friendly_name("conv2");
+    auto f = std::make_shared<Function>(NodeVector{conv2}, ParameterVector{input});
+
+    std::vector<pass::PruningReport::LayerStatistics> report;
+    pass::Manager m;
+    m.register_pass<pass::PruningReport>(report);
+    m.run_passes(f);
+
+    ASSERT_EQ(report.size(), 2);
+    ASSERT_EQ(report[0].name, "conv1");
+    ASSERT_EQ(report[0].flops, 2 * 6 * 3 * 3 * 3 * 20 * 20);
+    ASSERT_EQ(report[0].pruned_flops, 2 * 2 * 3 * 3 * 3 * 20 * 20);
+    ASSERT_EQ(report[0].weights_bytes, 6 * 3 * 3 * 3 * 4);
+    ASSERT_EQ(report[0].pruned_weights_bytes, 2 * 3 * 3 * 3 * 4);
+    ASSERT_EQ(report[1].name, "conv2");
+    ASSERT_EQ(report[1].flops, 2 * 4 * 6 * 3 * 3 * 18 * 18);
+    ASSERT_EQ(report[1].pruned_flops, 2 * 4 * 2 * 3 * 3 * 18 * 18);
+    // the function is not changed
+    ASSERT_FALSE(getMask(conv1->output(0)));
+    ASSERT_EQ(conv2->get_input_shape(1), Shape({4, 6, 3, 3}));
+}
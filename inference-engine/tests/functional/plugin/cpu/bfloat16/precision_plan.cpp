@@ -0,0 +1,115 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "ie_system_conf.h"
+#include <exec_graph_info.hpp>
+
+#include <ngraph/opsets/opset1.hpp>
+
+namespace LayerTestsDefinitions {
+
+// precisions planned for CONV_1, CONV_2 and CONV_3
+using PrecisionPlanParams = std::tuple<std::string, std::string, std::string>;
+
+class PrecisionPlan : public testing::WithParamInterface<PrecisionPlanParams>,
+                      public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<PrecisionPlanParams> obj) {
+        std::string conv1, conv2, conv3;
+        std::tie(conv1, conv2, conv3) = obj.param;
+
+        std::ostringstream result;
+        result << "plan=" << conv1 << "_" << conv2 << "_" << conv3;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        //     Multiply (not planned)
+        //          |
+        //        CONV_1
+        //          |
+        //        CONV_2
+        //          |
+        //        CONV_3
+        std::string conv1, conv2, conv3;
+        std::tie(conv1, conv2, conv3) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        using namespace ngraph;
+        const size_t channels = 16;
+        auto input = std::make_shared<opset1::Parameter>(element::f32, Shape{1, channels, 20, 20});
+        auto scale = opset1::Constant::create(element::f32, Shape{1}, {2.0f});
+        std::shared_ptr<Node> node = std::make_shared<opset1::Multiply>(input, scale);
+
+        const std::vector<std::pair<std::string, std::string>> plan = {{"CONV_1", conv1}, {"CONV_2", conv2}, {"CONV_3", conv3}};
+        for (const auto& layer : plan) {
+            std::vector<float> weightValues(channels * channels * 3 * 3);
+            FuncTestUtils::fillInputsBySinValues(weightValues.data(), weightValues.size());
+            auto weights = std::make_shared<opset1::Constant>(element::f32, Shape{channels, channels, 3, 3}, weightValues);
+            node = std::make_shared<opset1::Convolution>(node, weights, Strides{1, 1}, CoordinateDiff{1, 1}, CoordinateDiff{1, 1},
+                                                         Strides{1, 1}, op::PadType::EXPLICIT);
+            node->set_friendly_name(layer.first);
+            node->get_rt_info()["InferencePrecision"] = std::make_shared<VariantWrapper<std::string>>(layer.second);
+        }
+
+        function = std::make_shared<Function>(NodeVector{node}, ParameterVector{input}, "PrecisionPlan");
+    }
+};
+
+TEST_P(PrecisionPlan, LayersAreExecutedInPlannedPrecision) {
+    if (!InferenceEngine::with_cpu_x86_avx512_core())
+        GTEST_SKIP();
+
+    std::string conv1, conv2, conv3;
+    std::tie(conv1, conv2, conv3) = this->GetParam();
+    const std::map<std::string, std::string> expected = {{"CONV_1", conv1}, {"CONV_2", conv2}, {"CONV_3", conv3}};
+
+    auto ie = PluginCache::get().ie();
+    auto exeNet = ie->LoadNetwork(InferenceEngine::CNNNetwork(function), targetDevice,
+                                  {{InferenceEngine::PluginConfigParams::KEY_ENFORCE_BF16, InferenceEngine::PluginConfigParams::YES}});
+    auto inferRequest = exeNet.CreateInferRequest();
+    inferRequest.Infer();
+
+    auto getExecValue = [](const std::shared_ptr<ngraph::Node>& node, const std::string& paramName) -> std::string {
+        const auto& rtInfo = node->get_rt_info();
+        auto it = rtInfo.find(paramName);
+        IE_ASSERT(rtInfo.end() != it);
+        auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+        IE_ASSERT(nullptr != value);
+        return value->get();
+    };
+
+    size_t checked = 0;
+    for (const auto& node : exeNet.GetExecGraphInfo().getFunction()->get_ops()) {
+        if (getExecValue(node, ExecGraphInfoSerialization::LAYER_TYPE) != "Convolution")
+            continue;
+        auto originalNames = getExecValue(node, ExecGraphInfoSerialization::ORIGINAL_NAMES);
+        for (const auto& layer : expected) {
+            if (originalNames.find(layer.first) == std::string::npos)
+                continue;
+            ASSERT_EQ(layer.second, getExecValue(node, ExecGraphInfoSerialization::RUNTIME_PRECISION)) << layer.first;
+            checked++;
+        }
+    }
+    ASSERT_EQ(expected.size(), checked);
+}
+
+INSTANTIATE_TEST_CASE_P(smoke_CPU_bfloat16, PrecisionPlan,
+                        ::testing::Values(PrecisionPlanParams{"FP32", "BF16", "FP32"},
+                                          PrecisionPlanParams{"BF16", "FP32", "BF16"},
+                                          PrecisionPlanParams{"BF16", "BF16", "FP32"},
+                                          PrecisionPlanParams{"FP32", "FP32", "BF16"}),
+                        PrecisionPlan::getTestCaseName);
+
+}  // namespace LayerTestsDefinitions
@@ -24,7 +24,14 @@ namespace {
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "8"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::NO}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::YES}},
-            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_RUNTIME_CACHE_CAPACITY, "0"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_RUNTIME_CACHE_CAPACITY, "100"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_SHAPES_CACHE_CAPACITY, "4"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD, "0.8"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_CORES_PLACEMENT, InferenceEngine::PluginConfigParams::CPU_CORES_PERFORMANCE}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_CORES_PLACEMENT, InferenceEngine::PluginConfigParams::CPU_CORES_HYBRID_AWARE}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_GLOBAL_LAYOUT_SELECTION, InferenceEngine::PluginConfigParams::YES}}
     };
 
     const std::vector<std::map<std::string, std::string>> MultiConfigs = {
@@ -59,7 +66,14 @@ namespace {
     const std::vector<std::map<std::string, std::string>> inconfigs = {
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "OFF"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, "OFF"}},
-            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_RUNTIME_CACHE_CAPACITY, "-1"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_RUNTIME_CACHE_CAPACITY, "NAN"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_SHAPES_CACHE_CAPACITY, "-1"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD, "2"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD, "NAN"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_CORES_PLACEMENT, "BIG"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_GLOBAL_LAYOUT_SELECTION, "ON"}}
     };
 
     const std::vector<std::map<std::string, std::string>> multiinconfigs = {
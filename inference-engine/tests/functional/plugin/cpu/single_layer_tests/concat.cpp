@@ -0,0 +1,173 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ie_plugin_config.hpp>
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace CPULayerTestsDefinitions {
+
+typedef std::tuple<
+        size_t,                             // Concat axis
+        std::vector<std::vector<size_t>>,   // Input shapes
+        InferenceEngine::Precision,         // Net precision
+        std::string,                        // Target device name
+        CPUSpecificParams
+> concatCPUTestParams;
+
+class ConcatLayerCPUTest : public testing::WithParamInterface<concatCPUTestParams>,
+                           virtual public LayerTestsUtils::LayerTestsCommon, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<concatCPUTestParams> obj) {
+        size_t axis;
+        std::vector<std::vector<size_t>> inputShapes;
+        InferenceEngine::Precision netPrecision;
+        std::string targetDevice;
+        CPUSpecificParams cpuParams;
+        std::tie(axis, inputShapes, netPrecision, targetDevice, cpuParams) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShapes) << "_";
+        result << "axis=" << axis << "_";
+        result << "netPRC=" << netPrecision.name() << "_";
+        result << "trgDev=" << targetDevice;
+        result << CPUTestsBase::getTestCaseName(cpuParams);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        SetRefMode(LayerTestsUtils::RefMode::CONSTANT_FOLDING);
+        size_t axis;
+        std::vector<std::vector<size_t>> inputShapes;
+        InferenceEngine::Precision netPrecision;
+        CPUSpecificParams cpuParams;
+        std::tie(axis, inputShapes, netPrecision, targetDevice, cpuParams) = this->GetParam();
+        inPrc = outPrc = netPrecision;
+
+        std::tie(inFmts, outFmts, priority, selectedType) = cpuParams;
+        selectedType += std::string("_") + inPrc.name();
+
+        // in-place Concat takes the layout of its producers, so the network inputs are given in the tested layout
+        if (!inFmts.empty() && inFmts.front() == nhwc)
+            inLayout = outLayout = InferenceEngine::Layout::NHWC;
+        if (!inFmts.empty() && inFmts.front() == ndhwc)
+            inLayout = outLayout = InferenceEngine::Layout::NDHWC;
+
+        auto ngPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(netPrecision);
+        auto params = ngraph::builder::makeParams(ngPrc, inputShapes);
+        auto paramOuts = ngraph::helpers::convert2OutputVector(
+                ngraph::helpers::castOps2Nodes<ngraph::op::Parameter>(params));
+        auto concat = ngraph::builder::makeConcat(paramOuts, axis);
+        concat->get_rt_info() = getCPUInfo();
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(concat)};
+        function = std::make_shared<ngraph::Function>(results, params, "concat");
+    }
+};
+
+TEST_P(ConcatLayerCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckPluginRelatedResults(executableNetwork, "Concatenation");
+
+    auto bytes = executableNetwork.GetMetric(EXEC_NETWORK_METRIC_KEY(CONCAT_SPLIT_BYTES)).as<std::map<std::string, uint64_t>>();
+    ASSERT_GT(bytes.at("TOTAL_BYTES"), 0);
+    if (selectedType.find("unknown") == 0)
+        ASSERT_EQ(0, bytes.at("COPIED_BYTES"));
+    else
+        ASSERT_EQ(bytes.at("TOTAL_BYTES"), bytes.at("COPIED_BYTES"));
+}
+
+namespace {
+const auto planar_4D = CPUSpecificParams{{nchw}, {nchw}, {}, "unknown"};
+const auto planar_5D = CPUSpecificParams{{ncdhw}, {ncdhw}, {}, "unknown"};
+
+const auto perChannels_4D = CPUSpecificParams{{nhwc}, {nhwc}, {}, "ref"};
+
+const auto perChannelsInPlace_4D = CPUSpecificParams{{nhwc}, {nhwc}, {}, "unknown"};
+const auto perChannelsInPlace_5D = CPUSpecificParams{{ndhwc}, {ndhwc}, {}, "unknown"};
+
+const std::vector<Precision> netPrecisions = {
+        Precision::I32,
+        Precision::FP32
+};
+
+// mkldnn Concat supports channel-last layouts only for int8 precisions
+const std::vector<Precision> netPrecisionsPerChannels = {
+        Precision::I8,
+        Precision::U8
+};
+
+// inputs placed one after another along the batch
+INSTANTIATE_TEST_CASE_P(smoke_Concat4D_CPU_Batch_InPlace, ConcatLayerCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values(0),
+                                ::testing::Values(std::vector<std::vector<size_t>>({{2, 16, 5, 7}, {3, 16, 5, 7}, {1, 16, 5, 7}})),
+                                ::testing::ValuesIn(netPrecisions),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                                ::testing::Values(planar_4D)),
+                        ConcatLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_Concat5D_CPU_Batch_InPlace, ConcatLayerCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values(0),
+                                ::testing::Values(std::vector<std::vector<size_t>>({{1, 8, 3, 5, 7}, {2, 8, 3, 5, 7}})),
+                                ::testing::ValuesIn(netPrecisions),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                                ::testing::Values(planar_5D)),
+                        ConcatLayerCPUTest::getTestCaseName);
+
+// in channel-last layouts no dimension except the batch precedes the H axis, so inputs stay contiguous blocks
+INSTANTIATE_TEST_CASE_P(smoke_Concat4D_CPU_PerChannels_InPlace, ConcatLayerCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values(0, 2),
+                                ::testing::Values(std::vector<std::vector<size_t>>({{2, 24, 6, 9}, {2, 24, 6, 9}, {2, 24, 6, 9}})),
+                                ::testing::ValuesIn(netPrecisionsPerChannels),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                                ::testing::Values(perChannelsInPlace_4D)),
+                        ConcatLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_Concat4D_CPU_PerChannels_H_InPlace, ConcatLayerCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values(2),
+                                ::testing::Values(std::vector<std::vector<size_t>>({{2, 24, 3, 9}, {2, 24, 8, 9}})),
+                                ::testing::ValuesIn(netPrecisionsPerChannels),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                                ::testing::Values(perChannelsInPlace_4D)),
+                        ConcatLayerCPUTest::getTestCaseName);
+
+// channels are contiguous blocks in NHWC when the spatial dimensions are 1, e.g. after global pooling
+INSTANTIATE_TEST_CASE_P(smoke_Concat4D_CPU_PerChannels_C_InPlace, ConcatLayerCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values(1),
+                                ::testing::Values(std::vector<std::vector<size_t>>({{2, 8, 1, 1}, {2, 24, 1, 1}})),
+                                ::testing::ValuesIn(netPrecisionsPerChannels),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                                ::testing::Values(perChannelsInPlace_4D)),
+                        ConcatLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_Concat4D_CPU_PerChannels, ConcatLayerCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values(1),
+                                ::testing::Values(std::vector<std::vector<size_t>>({{2, 8, 6, 9}, {2, 24, 6, 9}})),
+                                ::testing::ValuesIn(netPrecisionsPerChannels),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                                ::testing::Values(perChannels_4D)),
+                        ConcatLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_Concat5D_CPU_PerChannels_InPlace, ConcatLayerCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values(0, 2),
+                                ::testing::Values(std::vector<std::vector<size_t>>({{2, 16, 4, 5, 3}, {2, 16, 4, 5, 3}})),
+                                ::testing::ValuesIn(netPrecisionsPerChannels),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                                ::testing::Values(perChannelsInPlace_5D)),
+                        ConcatLayerCPUTest::getTestCaseName);
+} // namespace
+} // namespace CPULayerTestsDefinitions
@@ -94,6 +94,9 @@ const auto planar_5D = CPUSpecificParams{{ncdhw}, {ncdhw}, {}, "unknown"};
 const auto perChannels_4D = CPUSpecificParams{{nhwc}, {nhwc}, {}, "ref"};
 const auto perChannels_5D = CPUSpecificParams{{ndhwc}, {ndhwc}, {}, "ref"};
 
+const auto perChannelsInPlace_4D = CPUSpecificParams{{nhwc}, {nhwc}, {}, "unknown"};
+const auto perChannelsInPlace_5D = CPUSpecificParams{{ndhwc}, {ndhwc}, {}, "unknown"};
+
 const auto perChannelsToPlanar_4D = CPUSpecificParams{{nhwc}, {nchw}, {}, "ref"};
 const auto perChannelsToPlanar_5D = CPUSpecificParams{{ndhwc}, {ncdhw}, {}, "ref"};
 
@@ -139,6 +142,51 @@ INSTANTIATE_TEST_CASE_P(smoke_Split5D_CPU_Nspc2NcspSpecial, SplitLayerCPUTest,
                                 ::testing::Values(perChannelsToPlanar_5D)),
                         SplitLayerCPUTest::getTestCaseName);
 
+// outputs are contiguous blocks of the input only if there are no dimensions except the batch before the axis
+INSTANTIATE_TEST_CASE_P(smoke_Split4D_CPU_PerChannelsInPlace, SplitLayerCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values(3),
+                                ::testing::Values(0, 2),
+                                ::testing::ValuesIn(netPrecisions),
+                                ::testing::Values(std::vector<size_t>({3, 24, 24, 9})),
+                                ::testing::Values(std::vector<size_t>({})),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                                ::testing::Values(perChannelsInPlace_4D)),
+                        SplitLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_Split4D_CPU_PerChannels, SplitLayerCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values(3),
+                                ::testing::Values(1, 3),
+                                ::testing::ValuesIn(netPrecisions),
+                                ::testing::Values(std::vector<size_t>({3, 24, 24, 9})),
+                                ::testing::Values(std::vector<size_t>({})),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                                ::testing::Values(perChannels_4D)),
+                        SplitLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_Split5D_CPU_PerChannelsInPlace, SplitLayerCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values(3),
+                                ::testing::Values(0, 2),
+                                ::testing::ValuesIn(netPrecisions),
+                                ::testing::Values(std::vector<size_t>({3, 24, 24, 9, 15})),
+                                ::testing::Values(std::vector<size_t>({})),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                                ::testing::Values(perChannelsInPlace_5D)),
+                        SplitLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_Split5D_CPU_PerChannels, SplitLayerCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values(3),
+                                ::testing::Values(1, 3, 4),
+                                ::testing::ValuesIn(netPrecisions),
+                                ::testing::Values(std::vector<size_t>({3, 24, 24, 9, 15})),
+                                ::testing::Values(std::vector<size_t>({})),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                                ::testing::Values(perChannels_5D)),
+                        SplitLayerCPUTest::getTestCaseName);
+
 INSTANTIATE_TEST_CASE_P(smoke_Split4D_CPU_Block8inPlace, SplitLayerCPUTest,
                     ::testing::Combine(
                             ::testing::Values(3),
@@ -147,7 +195,7 @@ INSTANTIATE_TEST_CASE_P(smoke_Split4D_CPU_Block8inPlace, SplitLayerCPUTest,
                             ::testing::Values(std::vector<size_t>({3, 24, 24, 9})),
                             ::testing::Values(std::vector<size_t>({})),
                             ::testing::Values(CommonTestUtils::DEVICE_CPU),
-                            ::testing::Values(planar_4D, planar_4D_ref, perChannels_4D, blocked8_4D)),
+                            ::testing::Values(planar_4D, planar_4D_ref, blocked8_4D)),
                     SplitLayerCPUTest::getTestCaseName);
 
 INSTANTIATE_TEST_CASE_P(smoke_Split4D_CPU_Block8, SplitLayerCPUTest,
@@ -158,7 +206,7 @@ INSTANTIATE_TEST_CASE_P(smoke_Split4D_CPU_Block8, SplitLayerCPUTest,
                                 ::testing::Values(std::vector<size_t>({3, 24, 24, 9})),
                                 ::testing::Values(std::vector<size_t>({})),
                                 ::testing::Values(CommonTestUtils::DEVICE_CPU),
-                                ::testing::Values(planar_4D, planar_4D_ref, perChannels_4D, blocked8_4D_ref)),
+                                ::testing::Values(planar_4D, planar_4D_ref, blocked8_4D_ref)),
                         SplitLayerCPUTest::getTestCaseName);
 
 INSTANTIATE_TEST_CASE_P(smoke_Split4D_CPU_Block16inPlace, SplitLayerCPUTest,
@@ -191,7 +239,7 @@ INSTANTIATE_TEST_CASE_P(smoke_Split5D_CPU_Block8inPlace, SplitLayerCPUTest,
                                 ::testing::Values(std::vector<size_t>({3, 24, 24, 9, 15})),
                                 ::testing::Values(std::vector<size_t>({})),
                                 ::testing::Values(CommonTestUtils::DEVICE_CPU),
-                                ::testing::Values(planar_5D, planar_5D_ref, perChannels_5D, blocked8_5D)),
+                                ::testing::Values(planar_5D, planar_5D_ref, blocked8_5D)),
                         SplitLayerCPUTest::getTestCaseName);
 
 INSTANTIATE_TEST_CASE_P(smoke_Split5D_CPU_Block8, SplitLayerCPUTest,
@@ -202,7 +250,7 @@ INSTANTIATE_TEST_CASE_P(smoke_Split5D_CPU_Block8, SplitLayerCPUTest,
                                 ::testing::Values(std::vector<size_t>({3, 24, 24, 9, 15})),
                                 ::testing::Values(std::vector<size_t>({})),
                                 ::testing::Values(CommonTestUtils::DEVICE_CPU),
-                                ::testing::Values(planar_5D, planar_5D_ref, perChannels_5D, blocked8_5D_ref)),
+                                ::testing::Values(planar_5D, planar_5D_ref, blocked8_5D_ref)),
                         SplitLayerCPUTest::getTestCaseName);
 
 INSTANTIATE_TEST_CASE_P(smoke_Split5D_CPU_Block16inPlace, SplitLayerCPUTest,
@@ -0,0 +1,51 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <tuple>
+#include <vector>
+#include <string>
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+enum class BatchedBlobItems {
+    contiguous,     // items are placed one after another in one buffer
+    strided         // items are separated by gaps
+};
+
+enum class BatchedBlobConsumer {
+    multiply,       // the items are copied to the input memory
+    convolution     // the items may be read by the convolution or the reorder before it
+};
+
+using BatchedBlobInputParams = std::tuple<
+        InferenceEngine::SizeVector,    // Input shape
+        InferenceEngine::Precision,     // Input precision
+        BatchedBlobItems,               // Placement of the batch items
+        BatchedBlobConsumer             // The first layer
+>;
+
+class BatchedBlobInputTest : public testing::WithParamInterface<BatchedBlobInputParams>, public CPUTestsBase,
+        virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<BatchedBlobInputParams> obj);
+
+protected:
+    void SetUp() override;
+    void Infer() override;
+
+    // the regular blob set for the input before the batched one
+    InferenceEngine::Blob::Ptr previousBlob;
+    std::vector<uint8_t> itemsBuffer;
+};
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,38 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <tuple>
+#include <vector>
+#include <string>
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using FCWeightsDecompressionParams = std::tuple<
+        InferenceEngine::SizeVector,    // Input shape
+        size_t,                         // Output channels
+        ngraph::element::Type,          // Weights precision
+        bool,                           // Zero point
+        bool,                           // Per output channel scales and zero points
+        bool                            // MatMul transpose_b
+>;
+
+class FCWeightsDecompressionTest : public testing::WithParamInterface<FCWeightsDecompressionParams>, public CPUTestsBase,
+        virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FCWeightsDecompressionParams> obj);
+
+protected:
+    void SetUp() override;
+};
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,38 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <tuple>
+#include <vector>
+#include <string>
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using LayoutSelectionParams = std::tuple<
+        InferenceEngine::SizeVector,    // Input shape
+        size_t,                         // Output channels of convolutions
+        std::string                     // Global layout selection
+>;
+
+class LayoutSelectionTest : public testing::WithParamInterface<LayoutSelectionParams>, public CPUTestsBase,
+        virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<LayoutSelectionParams> obj);
+
+    // blocked convolutions with planar softmax and a second input between them
+    static std::shared_ptr<ngraph::Function> makeFunction(const InferenceEngine::SizeVector& inputShape, size_t channels);
+
+protected:
+    void SetUp() override;
+};
+
+} // namespace SubgraphTestsDefinitions
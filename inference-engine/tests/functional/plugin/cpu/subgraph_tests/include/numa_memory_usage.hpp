@@ -0,0 +1,36 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <tuple>
+#include <vector>
+#include <string>
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using NUMAMemoryUsageParams = std::tuple<
+        InferenceEngine::SizeVector,    // Input shape
+        std::string                     // Number of streams
+>;
+
+class NUMAMemoryUsageTest : public testing::WithParamInterface<NUMAMemoryUsageParams>, public CPUTestsBase,
+        virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<NUMAMemoryUsageParams> obj);
+
+protected:
+    void SetUp() override;
+
+    size_t weightsSize = 0;
+};
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,45 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <tuple>
+#include <vector>
+#include <string>
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+enum class PostOpsType {
+    scaleShift,
+    fakeQuantize,
+    deconvolutionBias
+};
+
+using PostOpsDataPointersParams = std::tuple<
+        PostOpsType,                    // Operation fused as post-op with data pointers
+        InferenceEngine::SizeVector     // Input shape
+>;
+
+class PostOpsDataPointersTest : public testing::WithParamInterface<PostOpsDataPointersParams>, public CPUTestsBase,
+        virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<PostOpsDataPointersParams> obj);
+
+protected:
+    void SetUp() override;
+    // Networks created with different variants have the same primitive descriptors but different post-ops data
+    std::shared_ptr<ngraph::Function> makeFunction(int variant) const;
+
+    PostOpsType postOpsType;
+    InferenceEngine::SizeVector inputShape;
+};
+
+} // namespace SubgraphTestsDefinitions
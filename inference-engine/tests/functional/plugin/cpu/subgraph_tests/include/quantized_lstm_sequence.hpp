@@ -0,0 +1,38 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <tuple>
+#include <vector>
+#include <string>
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using QuantizedLSTMSequenceParams = std::tuple<
+        size_t,     // Batch
+        size_t,     // Sequence length
+        size_t,     // Input size
+        size_t      // Hidden size
+>;
+
+class QuantizedLSTMSequenceTest : public testing::WithParamInterface<QuantizedLSTMSequenceParams>, public CPUTestsBase,
+        virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<QuantizedLSTMSequenceParams> obj);
+
+    InferenceEngine::Blob::Ptr GenerateInput(const InferenceEngine::InputInfo &info) const override;
+
+protected:
+    void SetUp() override;
+};
+
+} // namespace SubgraphTestsDefinitions
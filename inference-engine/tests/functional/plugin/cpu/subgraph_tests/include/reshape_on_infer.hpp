@@ -0,0 +1,42 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <tuple>
+#include <vector>
+#include <string>
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using ReshapeOnInferParams = std::tuple<
+        InferenceEngine::SizeVector,                // Network input shape
+        std::vector<InferenceEngine::SizeVector>,   // Input shapes of consecutive inferences
+        size_t                                      // Shapes cache capacity
+>;
+
+class ReshapeOnInferTest : public testing::WithParamInterface<ReshapeOnInferParams>, public CPUTestsBase,
+        virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ReshapeOnInferParams> obj);
+
+protected:
+    void SetUp() override;
+    void Infer() override;
+
+    // sets the input of the given shape, the reference function is reshaped to it
+    void SetInput(const InferenceEngine::SizeVector& shape);
+
+    InferenceEngine::SizeVector networkShape;
+    std::vector<InferenceEngine::SizeVector> inferShapes;
+};
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,37 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <tuple>
+#include <vector>
+#include <string>
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using SparseWeightsParams = std::tuple<
+        InferenceEngine::SizeVector,    // Input shape
+        std::string                     // Sparse weights threshold, empty if not set
+>;
+
+class SparseWeightsTest : public testing::WithParamInterface<SparseWeightsParams>, public CPUTestsBase,
+        virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<SparseWeightsParams> obj);
+
+protected:
+    void SetUp() override;
+
+    // share of zero weights of the MatMul
+    const float sparseRate = 0.9f;
+};
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,40 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <tuple>
+#include <vector>
+#include <string>
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using StateSessionsParams = std::tuple<
+        InferenceEngine::SizeVector,    // Input shape
+        size_t                          // Number of state sessions
+>;
+
+class StateSessionsTest : public testing::WithParamInterface<StateSessionsParams>, public CPUTestsBase,
+        virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<StateSessionsParams> obj);
+
+protected:
+    void SetUp() override;
+
+    // infers the input filled with the value in the given session and checks the accumulated output
+    void InferSession(size_t session, float value, float expected);
+
+    InferenceEngine::SizeVector inputShape;
+    size_t sessions = 0;
+};
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,43 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <tuple>
+#include <vector>
+#include <string>
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using TraceTimelineParams = std::tuple<
+        InferenceEngine::SizeVector,    // Input shape
+        std::string,                    // Number of streams
+        size_t                          // Number of infer requests
+>;
+
+class TraceTimelineTest : public testing::WithParamInterface<TraceTimelineParams>, public CPUTestsBase,
+        virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<TraceTimelineParams> obj);
+
+protected:
+    void SetUp() override;
+    void TearDown() override;
+    void Infer() override;
+
+    // reads the trace written when the network and its requests are released
+    std::string ReleaseAndReadTrace();
+
+    const std::string traceFile = "cpu_trace_timeline_test.json";
+    std::vector<InferenceEngine::InferRequest> requests;
+};
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,40 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <tuple>
+#include <vector>
+#include <string>
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using ZeroCopyOutputParams = std::tuple<
+        InferenceEngine::SizeVector,    // Input shape
+        std::string                     // Number of streams
+>;
+
+class ZeroCopyOutputTest : public testing::WithParamInterface<ZeroCopyOutputParams>, public CPUTestsBase,
+        virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ZeroCopyOutputParams> obj);
+
+protected:
+    void SetUp() override;
+    void Infer() override;
+
+    // the request with the default output blob inferred next to the one with the user output blob
+    InferenceEngine::InferRequest defaultRequest;
+    std::vector<InferenceEngine::Blob::Ptr> defaultInputs;
+    InferenceEngine::Blob::Ptr userOutput;
+};
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,107 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+
+#include <blob_factory.hpp>
+#include "subgraph_tests/include/batched_blob_input.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+std::string BatchedBlobInputTest::getTestCaseName(testing::TestParamInfo<BatchedBlobInputParams> obj) {
+    SizeVector inputShape;
+    Precision inputPrecision;
+    BatchedBlobItems items;
+    BatchedBlobConsumer consumer;
+    std::tie(inputShape, inputPrecision, items, consumer) = obj.param;
+
+    std::ostringstream result;
+    result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+    result << "inPRC=" << inputPrecision.name() << "_";
+    result << "Items=" << (items == BatchedBlobItems::contiguous ? "contiguous" : "strided") << "_";
+    result << "Consumer=" << (consumer == BatchedBlobConsumer::multiply ? "multiply" : "convolution");
+    return result.str();
+}
+
+void BatchedBlobInputTest::SetUp() {
+    targetDevice = CommonTestUtils::DEVICE_CPU;
+
+    SizeVector inputShape;
+    BatchedBlobItems items;
+    BatchedBlobConsumer consumer;
+    std::tie(inputShape, inPrc, items, consumer) = this->GetParam();
+
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+    std::shared_ptr<ngraph::Node> layer;
+    if (consumer == BatchedBlobConsumer::multiply) {
+        auto scales = ngraph::builder::makeConstant<float>(ngraph::element::f32, {1, inputShape[1], 1, 1}, {}, true, 3, 1);
+        layer = std::make_shared<ngraph::opset1::Multiply>(params[0], scales);
+    } else {
+        layer = ngraph::builder::makeConvolution(params[0], ngraph::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                 ngraph::op::PadType::EXPLICIT, 16);
+    }
+    ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(layer)};
+    function = std::make_shared<ngraph::Function>(results, params, "BatchedBlobInput");
+}
+
+/*  The input is bound to a regular blob by the first inference, then the same data as the reference inputs
+    is passed as a batch of separate items. Items placed one after another are read directly, strided items are read
+    by the first layer item by item or copied to the graph memory, and must not overwrite the regular blob.
+*/
+void BatchedBlobInputTest::Infer() {
+    inferRequest = executableNetwork.CreateInferRequest();
+    const auto name = executableNetwork.GetInputsInfo().begin()->first;
+    const auto& desc = inputs[0]->getTensorDesc();
+
+    previousBlob = make_blob_with_precision(desc);
+    previousBlob->allocate();
+    std::memset(previousBlob->buffer().as<uint8_t*>(), 0, previousBlob->byteSize());
+    inferRequest.SetBlob(name, previousBlob);
+    inferRequest.Infer();
+
+    const size_t batch = desc.getDims()[0];
+    const size_t itemSize = inputs[0]->byteSize() / batch;
+    const size_t itemStride = std::get<2>(GetParam()) == BatchedBlobItems::contiguous ? itemSize : itemSize + 64;
+    auto itemDims = desc.getDims();
+    itemDims[0] = 1;
+
+    itemsBuffer.assign(batch * itemStride, 0);
+    std::vector<Blob::Ptr> items;
+    for (size_t i = 0; i < batch; i++) {
+        auto* itemPtr = itemsBuffer.data() + i * itemStride;
+        std::memcpy(itemPtr, inputs[0]->cbuffer().as<const uint8_t*>() + i * itemSize, itemSize);
+        items.push_back(make_blob_with_precision(TensorDesc(desc.getPrecision(), itemDims, desc.getLayout()), itemPtr));
+    }
+    inferRequest.SetBlob(name, std::make_shared<BatchedBlob>(items));
+    inferRequest.Infer();
+}
+
+TEST_P(BatchedBlobInputTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    const auto name = executableNetwork.GetInputsInfo().begin()->first;
+    ASSERT_TRUE(inferRequest.GetBlob(name)->is<BatchedBlob>());
+    const auto* previousData = previousBlob->cbuffer().as<const uint8_t*>();
+    for (size_t i = 0; i < previousBlob->byteSize(); i++)
+        ASSERT_EQ(0, previousData[i]) << "The regular input blob was overwritten at byte " << i;
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(smoke_BatchedBlobInput, BatchedBlobInputTest,
+                        ::testing::Combine(
+                                ::testing::Values(SizeVector{3, 8, 5, 7}),
+                                ::testing::Values(Precision::FP32, Precision::U8),
+                                ::testing::Values(BatchedBlobItems::contiguous, BatchedBlobItems::strided),
+                                ::testing::Values(BatchedBlobConsumer::multiply, BatchedBlobConsumer::convolution)),
+                        BatchedBlobInputTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,128 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "subgraph_tests/include/fc_weights_decompression.hpp"
+#include <transformations/rt_info/dequantization_attribute.hpp>
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+std::string FCWeightsDecompressionTest::getTestCaseName(testing::TestParamInfo<FCWeightsDecompressionParams> obj) {
+    SizeVector inputShape;
+    size_t outChannels;
+    ngraph::element::Type weightsPrecision;
+    bool withZeroPoint, perChannel, transposeB;
+    std::tie(inputShape, outChannels, weightsPrecision, withZeroPoint, perChannel, transposeB) = obj.param;
+
+    std::ostringstream result;
+    result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+    result << "OC=" << outChannels << "_";
+    result << "WP=" << weightsPrecision << "_";
+    result << "ZP=" << withZeroPoint << "_";
+    result << "PerChannel=" << perChannel << "_";
+    result << "TransposeB=" << transposeB;
+    return result.str();
+}
+
+/*  FCWeightsDecompressionTest graph
+                        ---------------
+                        |Weights u8/i8|
+                        ---------------
+                               |
+                          ---------
+                          |Convert|
+                          ---------
+                               |
+                         ------------
+                         |[Subtract]|
+                         ------------
+                               |
+       -------          ----------
+       |Input|          |Multiply|
+       -------          ----------
+          |                    |
+          ----------------------
+                    |
+                ---------
+                |MatMul |
+                ---------
+                    |
+                ---------
+                |Output |
+                ---------
+
+    The reference is calculated with weights decompressed to FP32, so the test checks both FullyConnected
+    executed on compressed weights and constant folding of the subgraph the plugin can not execute compressed.
+*/
+
+void FCWeightsDecompressionTest::SetUp() {
+    targetDevice = CommonTestUtils::DEVICE_CPU;
+    configuration.insert({PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO});
+
+    SizeVector inputShape;
+    size_t outChannels;
+    ngraph::element::Type weightsPrecision;
+    bool withZeroPoint, perChannel, transposeB;
+    std::tie(inputShape, outChannels, weightsPrecision, withZeroPoint, perChannel, transposeB) = this->GetParam();
+
+    const size_t inChannels = inputShape.back();
+    const auto weightsShape = transposeB ? ngraph::Shape{outChannels, inChannels} : ngraph::Shape{inChannels, outChannels};
+    const auto constShape = !perChannel ? ngraph::Shape{1} : transposeB ? ngraph::Shape{outChannels, 1} : ngraph::Shape{1, outChannels};
+
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+    auto weights = ngraph::builder::makeConstant<uint8_t>(weightsPrecision, weightsShape, {}, true, 100, 0);
+    std::shared_ptr<ngraph::Node> decompressed = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+    if (withZeroPoint) {
+        auto zeroPoints = ngraph::builder::makeConstant<float>(ngraph::element::f32, constShape, {}, true, 50, 0);
+        decompressed = std::make_shared<ngraph::opset1::Subtract>(decompressed, zeroPoints);
+    }
+    std::vector<float> scalesValues(ngraph::shape_size(constShape));
+    for (size_t i = 0; i < scalesValues.size(); i++)
+        scalesValues[i] = 0.01f * static_cast<float>(i % 7 + 1);
+    auto scales = ngraph::builder::makeConstant(ngraph::element::f32, constShape, scalesValues);
+    auto multiply = std::make_shared<ngraph::opset1::Multiply>(decompressed, scales);
+    multiply->get_rt_info()["DEQUANTIZATION"] = std::make_shared<ngraph::VariantWrapper<ngraph::DequantizationAttr>>(ngraph::DequantizationAttr());
+
+    auto matMul = std::make_shared<ngraph::opset1::MatMul>(params[0], multiply, false, transposeB);
+    ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(matMul)};
+    function = std::make_shared<ngraph::Function>(results, params, "FCWeightsDecompression");
+}
+
+TEST_P(FCWeightsDecompressionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "FullyConnected", 1);
+    // decompression subgraph is either fused into FullyConnected or constant folded
+    CheckNodeOfTypeCount(executableNetwork, "Convert", 0);
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(smoke_Compressed, FCWeightsDecompressionTest,
+                        ::testing::Combine(
+                                ::testing::Values(SizeVector{3, 64}, SizeVector{2, 5, 64}),
+                                ::testing::Values(32),
+                                ::testing::Values(ngraph::element::u8, ngraph::element::i8),
+                                ::testing::Bool(),
+                                ::testing::Bool(),
+                                ::testing::Values(true)),
+                        FCWeightsDecompressionTest::getTestCaseName);
+
+// weights which need Transpose are decompressed by constant folding
+INSTANTIATE_TEST_CASE_P(smoke_ConstantFolded, FCWeightsDecompressionTest,
+                        ::testing::Combine(
+                                ::testing::Values(SizeVector{3, 64}),
+                                ::testing::Values(32),
+                                ::testing::Values(ngraph::element::u8),
+                                ::testing::Values(true),
+                                ::testing::Values(true),
+                                ::testing::Values(false)),
+                        FCWeightsDecompressionTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
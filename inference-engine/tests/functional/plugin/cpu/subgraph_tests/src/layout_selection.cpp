@@ -0,0 +1,100 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "subgraph_tests/include/layout_selection.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using ReordersInfo = std::map<std::string, uint64_t>;
+
+std::string LayoutSelectionTest::getTestCaseName(testing::TestParamInfo<LayoutSelectionParams> obj) {
+    SizeVector inputShape;
+    size_t channels;
+    std::string layoutSelection;
+    std::tie(inputShape, channels, layoutSelection) = obj.param;
+
+    std::ostringstream result;
+    result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+    result << "OC=" << channels << "_";
+    result << "LayoutSelection=" << layoutSelection;
+    return result.str();
+}
+
+std::shared_ptr<ngraph::Function> LayoutSelectionTest::makeFunction(const SizeVector& inputShape, size_t channels) {
+    auto residualShape = inputShape;
+    residualShape[1] = channels;
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape, residualShape});
+
+    auto makeConvolution = [channels](const ngraph::Output<ngraph::Node>& input) {
+        const size_t inChannels = input.get_shape()[1];
+        std::vector<float> weights(channels * inChannels * 3 * 3);
+        for (size_t i = 0; i < weights.size(); i++)
+            weights[i] = 0.01f * static_cast<float>(i % 13) - 0.06f;
+        return ngraph::builder::makeConvolution(input, ngraph::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                ngraph::op::PadType::EXPLICIT, channels, false, weights);
+    };
+    auto conv1 = makeConvolution(params[0]);
+    auto softMax = std::make_shared<ngraph::opset1::Softmax>(conv1, 1);
+    auto add = std::make_shared<ngraph::opset1::Add>(softMax, params[1]);
+    auto conv2 = makeConvolution(add);
+    auto multiply = std::make_shared<ngraph::opset1::Multiply>(conv2, params[1]);
+    ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(multiply)};
+    return std::make_shared<ngraph::Function>(results, params, "LayoutSelection");
+}
+
+void LayoutSelectionTest::SetUp() {
+    targetDevice = CommonTestUtils::DEVICE_CPU;
+    SizeVector inputShape;
+    size_t channels;
+    std::string layoutSelection;
+    std::tie(inputShape, channels, layoutSelection) = this->GetParam();
+    configuration.insert({PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO});
+    configuration.insert({PluginConfigParams::KEY_CPU_GLOBAL_LAYOUT_SELECTION, layoutSelection});
+    function = makeFunction(inputShape, channels);
+}
+
+TEST_P(LayoutSelectionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    auto reorders = executableNetwork.GetMetric(EXEC_NETWORK_METRIC_KEY(LAYOUT_REORDERS)).as<ReordersInfo>();
+    ASSERT_EQ(6, reorders.size());
+    if (std::get<2>(GetParam()) == PluginConfigParams::YES) {
+        // the greedy choice puts avoidable reorders around softmax and the eltwise nodes of this graph
+        ASSERT_LT(reorders.at("SELECTED_BYTES"), reorders.at("GREEDY_BYTES"));
+        ASSERT_LE(reorders.at("SELECTED_COUNT"), reorders.at("GREEDY_COUNT"));
+    } else {
+        ASSERT_EQ(reorders.at("GREEDY_COUNT"), reorders.at("SELECTED_COUNT"));
+        ASSERT_EQ(reorders.at("GREEDY_BYTES"), reorders.at("SELECTED_BYTES"));
+    }
+}
+
+TEST(LayoutSelectionDefaultTest, smoke_SelectionIsDisabledByDefault) {
+    auto ie = PluginCache::get().ie();
+    ASSERT_EQ(PluginConfigParams::NO,
+              ie->GetConfig(CommonTestUtils::DEVICE_CPU, PluginConfigParams::KEY_CPU_GLOBAL_LAYOUT_SELECTION).as<std::string>());
+
+    CNNNetwork network(LayoutSelectionTest::makeFunction({1, 16, 14, 14}, 32));
+    auto execNetwork = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    auto reorders = execNetwork.GetMetric(EXEC_NETWORK_METRIC_KEY(LAYOUT_REORDERS)).as<ReordersInfo>();
+    ASSERT_EQ(reorders.at("GREEDY_COUNT"), reorders.at("SELECTED_COUNT"));
+    ASSERT_EQ(reorders.at("GREEDY_BYTES"), reorders.at("SELECTED_BYTES"));
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(smoke_LayoutSelection, LayoutSelectionTest,
+                        ::testing::Combine(
+                                ::testing::Values(SizeVector{1, 16, 14, 14}, SizeVector{2, 8, 7, 9}),
+                                ::testing::Values(32),
+                                ::testing::Values(PluginConfigParams::YES, PluginConfigParams::NO)),
+                        LayoutSelectionTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,73 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+
+#include <ie_system_conf.h>
+#include "subgraph_tests/include/numa_memory_usage.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+std::string NUMAMemoryUsageTest::getTestCaseName(testing::TestParamInfo<NUMAMemoryUsageParams> obj) {
+    SizeVector inputShape;
+    std::string streams;
+    std::tie(inputShape, streams) = obj.param;
+
+    std::ostringstream result;
+    result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+    result << "Streams=" << streams;
+    return result.str();
+}
+
+void NUMAMemoryUsageTest::SetUp() {
+    targetDevice = CommonTestUtils::DEVICE_CPU;
+    SizeVector inputShape;
+    std::string streams;
+    std::tie(inputShape, streams) = this->GetParam();
+    configuration.insert({PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, streams});
+
+    const size_t channels = inputShape.back();
+    weightsSize = channels * channels * sizeof(float);
+
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+    auto weights = ngraph::builder::makeConstant<float>(ngraph::element::f32, {channels, channels}, {}, true, 2, 1);
+    auto matMul = std::make_shared<ngraph::opset1::MatMul>(params[0], weights);
+    auto relu = std::make_shared<ngraph::opset1::Relu>(matMul);
+    ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(relu)};
+    function = std::make_shared<ngraph::Function>(results, params, "NUMAMemoryUsage");
+}
+
+TEST_P(NUMAMemoryUsageTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    using MemoryUsage = std::map<int, uint64_t>;
+    MemoryUsage memoryUsage;
+    ASSERT_NO_THROW(memoryUsage = executableNetwork.GetMetric(EXEC_NETWORK_METRIC_KEY(NUMA_NODES_MEMORY_USAGE)).as<MemoryUsage>());
+    ASSERT_FALSE(memoryUsage.empty());
+    const auto numaNodes = getAvailableNUMANodes();
+    uint64_t total = 0;
+    for (const auto& nodeUsage : memoryUsage) {
+        ASSERT_NE(numaNodes.end(), std::find(numaNodes.begin(), numaNodes.end(), nodeUsage.first));
+        total += nodeUsage.second;
+    }
+    // at least weights are accounted
+    ASSERT_GE(total, weightsSize);
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(smoke_NUMAMemoryUsage, NUMAMemoryUsageTest,
+                        ::testing::Combine(
+                                ::testing::Values(SizeVector{1, 16}, SizeVector{4, 64}),
+                                ::testing::Values("1", "2")),
+                        NUMAMemoryUsageTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
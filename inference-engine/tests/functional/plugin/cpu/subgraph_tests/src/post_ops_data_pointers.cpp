@@ -0,0 +1,118 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "subgraph_tests/include/post_ops_data_pointers.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+std::string PostOpsDataPointersTest::getTestCaseName(testing::TestParamInfo<PostOpsDataPointersParams> obj) {
+    PostOpsType postOpsType;
+    SizeVector inputShape;
+    std::tie(postOpsType, inputShape) = obj.param;
+
+    std::ostringstream result;
+    switch (postOpsType) {
+        case PostOpsType::scaleShift: result << "ScaleShift_"; break;
+        case PostOpsType::fakeQuantize: result << "FakeQuantize_"; break;
+        case PostOpsType::deconvolutionBias: result << "DeconvolutionBias_"; break;
+    }
+    result << "IS=" << CommonTestUtils::vec2str(inputShape);
+    return result.str();
+}
+
+/*  PostOpsDataPointersTest graph
+      ---------
+      |Input  |
+      ---------
+          |
+    ---------------------------
+    |Convolution|Deconvolution|
+    ---------------------------
+          |
+    ----------------------------------
+    |ScaleShift|FakeQuantize|Bias Add|
+    ----------------------------------
+          |
+      ---------
+      |Output |
+      ---------
+
+    Post-op is fused into the (de)convolution primitive as depthwise or quantization post-op which
+    keeps pointers to the node data. Two networks differing only by post-op data are loaded into
+    the same process, so a primitive reused from the other network would produce wrong results.
+*/
+
+std::shared_ptr<ngraph::Function> PostOpsDataPointersTest::makeFunction(int variant) const {
+    const size_t channels = inputShape[1];
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+
+    std::vector<float> perChannelValues(channels);
+    for (size_t c = 0; c < channels; c++)
+        perChannelValues[c] = 0.1f * static_cast<float>(c % 5 + 1) * static_cast<float>(variant + 1);
+
+    std::shared_ptr<ngraph::Node> lastNode;
+    if (postOpsType == PostOpsType::deconvolutionBias) {
+        lastNode = ngraph::builder::makeConvolutionBackpropData(params[0], ngraph::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                                ngraph::op::PadType::EXPLICIT, channels, true, {}, perChannelValues);
+    } else {
+        lastNode = ngraph::builder::makeConvolution(params[0], ngraph::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                    ngraph::op::PadType::EXPLICIT, channels);
+        const ngraph::Shape constShape{1, channels, 1, 1};
+        if (postOpsType == PostOpsType::scaleShift) {
+            auto scales = ngraph::builder::makeConstant(ngraph::element::f32, constShape, perChannelValues);
+            auto shifts = ngraph::builder::makeConstant(ngraph::element::f32, constShape, perChannelValues);
+            lastNode = std::make_shared<ngraph::opset1::Multiply>(lastNode, scales);
+            lastNode = std::make_shared<ngraph::opset1::Add>(lastNode, shifts);
+        } else {
+            lastNode = ngraph::builder::makeFakeQuantize(lastNode, ngraph::element::f32, 256, constShape, variant + 1);
+        }
+    }
+
+    ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(lastNode)};
+    return std::make_shared<ngraph::Function>(results, params, "PostOpsDataPointers");
+}
+
+void PostOpsDataPointersTest::SetUp() {
+    targetDevice = CommonTestUtils::DEVICE_CPU;
+    configuration.insert({PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO});
+
+    std::tie(postOpsType, inputShape) = this->GetParam();
+    function = makeFunction(0);
+}
+
+TEST_P(PostOpsDataPointersTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    auto firstNetwork = executableNetwork;
+    auto firstFunction = function;
+    auto firstInputs = inputs;
+
+    // the second network is loaded while the first one is alive
+    function = makeFunction(1);
+    inputs.clear();
+    Run();
+
+    // and the first network still uses its own post-ops data
+    executableNetwork = firstNetwork;
+    function = firstFunction;
+    inputs = firstInputs;
+    Infer();
+    Validate();
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(smoke_PostOpsDataPointers, PostOpsDataPointersTest,
+                        ::testing::Combine(
+                                ::testing::Values(PostOpsType::scaleShift, PostOpsType::fakeQuantize, PostOpsType::deconvolutionBias),
+                                ::testing::Values(SizeVector{1, 16, 10, 10})),
+                        PostOpsDataPointersTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,89 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ie_system_conf.h>
+#include <ngraph/opsets/opset5.hpp>
+#include "subgraph_tests/include/quantized_lstm_sequence.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+namespace {
+
+std::vector<float> makeValues(size_t size, float range) {
+    std::vector<float> values(size);
+    for (size_t i = 0; i < size; i++)
+        values[i] = range * (static_cast<float>((i * 37) % 101) / 50.f - 1.f);
+    return values;
+}
+
+std::shared_ptr<ngraph::Node> makeFakeQuantize(const ngraph::Output<ngraph::Node>& input, size_t levels, float low, float high) {
+    return ngraph::builder::makeFakeQuantize(input, ngraph::element::f32, levels, {}, {low}, {high}, {low}, {high});
+}
+
+} // namespace
+
+std::string QuantizedLSTMSequenceTest::getTestCaseName(testing::TestParamInfo<QuantizedLSTMSequenceParams> obj) {
+    size_t batch, seqLength, inputSize, hiddenSize;
+    std::tie(batch, seqLength, inputSize, hiddenSize) = obj.param;
+
+    std::ostringstream result;
+    result << "N=" << batch << "_";
+    result << "T=" << seqLength << "_";
+    result << "I=" << inputSize << "_";
+    result << "H=" << hiddenSize;
+    return result.str();
+}
+
+// all the inputs are kept in [-1, 1] so that the data FakeQuantize range holds them
+Blob::Ptr QuantizedLSTMSequenceTest::GenerateInput(const InputInfo &info) const {
+    return FuncTestUtils::createAndFillBlob(info.getTensorDesc(), 2, -1, 100);
+}
+
+void QuantizedLSTMSequenceTest::SetUp() {
+    targetDevice = CommonTestUtils::DEVICE_CPU;
+    size_t batch, seqLength, inputSize, hiddenSize;
+    std::tie(batch, seqLength, inputSize, hiddenSize) = this->GetParam();
+
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, {{batch, seqLength, inputSize}, {batch, 1, hiddenSize}, {batch, 1, hiddenSize}});
+    auto seqLengths = ngraph::builder::makeConstant<int64_t>(ngraph::element::i64, {batch}, {static_cast<int64_t>(seqLength)});
+    auto W = ngraph::builder::makeConstant<float>(ngraph::element::f32, {1, 4 * hiddenSize, inputSize}, makeValues(4 * hiddenSize * inputSize, 0.5f));
+    auto R = ngraph::builder::makeConstant<float>(ngraph::element::f32, {1, 4 * hiddenSize, hiddenSize}, makeValues(4 * hiddenSize * hiddenSize, 0.5f));
+    auto B = ngraph::builder::makeConstant<float>(ngraph::element::f32, {1, 4 * hiddenSize}, makeValues(4 * hiddenSize, 0.1f));
+
+    auto dataFQ = makeFakeQuantize(params[0], 256, -1.28f, 1.27f);
+    auto weightsFQ = makeFakeQuantize(W, 255, -0.5f, 0.5f);
+    auto recurrentWeightsFQ = makeFakeQuantize(R, 255, -0.5f, 0.5f);
+
+    auto lstm = std::make_shared<ngraph::opset5::LSTMSequence>(dataFQ, params[1], params[2], seqLengths, weightsFQ, recurrentWeightsFQ, B,
+                                                               hiddenSize, ngraph::op::RecurrentSequenceDirection::FORWARD);
+    ngraph::ResultVector results{std::make_shared<ngraph::opset5::Result>(lstm->output(0))};
+    function = std::make_shared<ngraph::Function>(results, params, "QuantizedLSTMSequence");
+    threshold = 0.05f;
+}
+
+TEST_P(QuantizedLSTMSequenceTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    // data FakeQuantize is folded into int8 RNN primitive where it is available
+    CheckNodeOfTypeCount(executableNetwork, "Quantize", with_cpu_x86_avx512_core() ? 0 : 1);
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(smoke_QuantizedLSTMSequence, QuantizedLSTMSequenceTest,
+                        ::testing::Combine(
+                                ::testing::Values(1, 2),
+                                ::testing::Values(1, 5),
+                                ::testing::Values(16),
+                                ::testing::Values(8, 32)),
+                        QuantizedLSTMSequenceTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
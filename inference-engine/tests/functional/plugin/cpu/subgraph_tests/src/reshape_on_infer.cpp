@@ -0,0 +1,124 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "subgraph_tests/include/reshape_on_infer.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+std::string ReshapeOnInferTest::getTestCaseName(testing::TestParamInfo<ReshapeOnInferParams> obj) {
+    SizeVector networkShape;
+    std::vector<SizeVector> inferShapes;
+    size_t cacheCapacity;
+    std::tie(networkShape, inferShapes, cacheCapacity) = obj.param;
+
+    std::ostringstream result;
+    result << "IS=" << CommonTestUtils::vec2str(networkShape) << "_";
+    result << "InferShapes=" << CommonTestUtils::vec2str(inferShapes) << "_";
+    result << "CacheCapacity=" << cacheCapacity;
+    return result.str();
+}
+
+void ReshapeOnInferTest::SetUp() {
+    targetDevice = CommonTestUtils::DEVICE_CPU;
+    size_t cacheCapacity;
+    std::tie(networkShape, inferShapes, cacheCapacity) = this->GetParam();
+    configuration.insert({PluginConfigParams::KEY_CPU_SHAPES_CACHE_CAPACITY, std::to_string(cacheCapacity)});
+
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, {networkShape});
+    auto scales = ngraph::builder::makeConstant<float>(ngraph::element::f32, {1, networkShape[1], 1, 1}, {}, true, 3, 1);
+    auto multiply = std::make_shared<ngraph::opset1::Multiply>(params[0], scales);
+    auto relu = std::make_shared<ngraph::opset1::Relu>(multiply);
+    ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(relu)};
+    function = std::make_shared<ngraph::Function>(results, params, "ReshapeOnInfer");
+}
+
+void ReshapeOnInferTest::SetInput(const SizeVector& shape) {
+    auto input = FuncTestUtils::createAndFillBlob(TensorDesc(Precision::FP32, shape, Layout::NCHW), 10, -5);
+    inputs = {input};
+    function->get_parameters()[0]->set_partial_shape(ngraph::PartialShape(shape));
+    inferRequest.SetBlob(executableNetwork.GetInputsInfo().begin()->first, input);
+}
+
+// every shape is inferred by the same request and validated, shapes evicted from the cache are compiled again
+void ReshapeOnInferTest::Infer() {
+    inferRequest = executableNetwork.CreateInferRequest();
+    const auto outputName = executableNetwork.GetOutputsInfo().begin()->first;
+    for (const auto& shape : inferShapes) {
+        SetInput(shape);
+        inferRequest.Infer();
+        ASSERT_EQ(shape, inferRequest.GetBlob(outputName)->getTensorDesc().getDims());
+        Validate();
+    }
+}
+
+TEST_P(ReshapeOnInferTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+TEST_P(ReshapeOnInferTest, UserOutputBlobIsKept) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    LoadNetwork();
+    inferRequest = executableNetwork.CreateInferRequest();
+    const auto outputName = executableNetwork.GetOutputsInfo().begin()->first;
+    for (const auto& shape : inferShapes) {
+        auto output = make_shared_blob<float>(TensorDesc(Precision::FP32, shape, Layout::NCHW));
+        output->allocate();
+        inferRequest.SetBlob(outputName, output);
+        SetInput(shape);
+        inferRequest.Infer();
+        ASSERT_EQ(output, inferRequest.GetBlob(outputName));
+        Validate();
+    }
+}
+
+TEST_P(ReshapeOnInferTest, UserOutputBlobOfDifferentShapeThrows) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    LoadNetwork();
+    inferRequest = executableNetwork.CreateInferRequest();
+    const auto outputName = executableNetwork.GetOutputsInfo().begin()->first;
+    auto output = make_shared_blob<float>(TensorDesc(Precision::FP32, networkShape, Layout::NCHW));
+    output->allocate();
+    inferRequest.SetBlob(outputName, output);
+    // the output blob is not reinterpreted even if it has the same number of elements as the inferred output
+    for (const auto& shape : inferShapes) {
+        if (shape == networkShape)
+            continue;
+        SetInput(shape);
+        ASSERT_THROW(inferRequest.Infer(), Exception);
+        ASSERT_EQ(output, inferRequest.GetBlob(outputName));
+    }
+}
+
+TEST_P(ReshapeOnInferTest, SetBlobWithDifferentShapeThrowsIfDisabled) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    configuration.erase(PluginConfigParams::KEY_CPU_SHAPES_CACHE_CAPACITY);
+    LoadNetwork();
+    inferRequest = executableNetwork.CreateInferRequest();
+    for (const auto& shape : inferShapes) {
+        if (shape == networkShape)
+            continue;
+        ASSERT_THROW(SetInput(shape), Exception);
+    }
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(smoke_ReshapeOnInfer, ReshapeOnInferTest,
+                        ::testing::Combine(
+                                ::testing::Values(SizeVector{1, 3, 8, 8}),
+                                ::testing::Values(std::vector<SizeVector>{{1, 3, 8, 8}, {1, 3, 4, 6}, {2, 3, 5, 5}, {1, 3, 4, 6}, {1, 3, 16, 4}, {1, 3, 8, 8}}),
+                                ::testing::Values(1, 2)),
+                        ReshapeOnInferTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
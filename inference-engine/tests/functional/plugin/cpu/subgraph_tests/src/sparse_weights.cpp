@@ -0,0 +1,74 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "subgraph_tests/include/sparse_weights.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+std::string SparseWeightsTest::getTestCaseName(testing::TestParamInfo<SparseWeightsParams> obj) {
+    SizeVector inputShape;
+    std::string sparseThreshold;
+    std::tie(inputShape, sparseThreshold) = obj.param;
+
+    std::ostringstream result;
+    result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+    result << "Threshold=" << (sparseThreshold.empty() ? "default" : sparseThreshold);
+    return result.str();
+}
+
+// every 10th weight is non zero
+void SparseWeightsTest::SetUp() {
+    targetDevice = CommonTestUtils::DEVICE_CPU;
+    SizeVector inputShape;
+    std::string sparseThreshold;
+    std::tie(inputShape, sparseThreshold) = this->GetParam();
+    // sparse weights are used in FP32 precision only
+    configuration.insert({PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO});
+    if (!sparseThreshold.empty())
+        configuration.insert({PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD, sparseThreshold});
+
+    const size_t IC = inputShape.back(), OC = 48;
+    std::vector<float> weightsValues(IC * OC, 0.f);
+    for (size_t i = 0; i < weightsValues.size(); i += 10)
+        weightsValues[i] = 0.1f * static_cast<float>(i % 7) - 0.35f;
+
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+    auto weights = ngraph::builder::makeConstant<float>(ngraph::element::f32, {OC, IC}, weightsValues);
+    auto matMul = std::make_shared<ngraph::opset1::MatMul>(params[0], weights, false, true);
+    auto bias = ngraph::builder::makeConstant<float>(ngraph::element::f32, {OC}, {0.5f});
+    auto add = std::make_shared<ngraph::opset1::Add>(matMul, bias);
+    ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(add)};
+    function = std::make_shared<ngraph::Function>(results, params, "SparseWeights");
+}
+
+TEST_P(SparseWeightsTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    const auto& sparseThreshold = std::get<1>(GetParam());
+    const bool isSparse = !sparseThreshold.empty() && std::stof(sparseThreshold) <= sparseRate;
+    auto sparseLayers = executableNetwork.GetMetric(EXEC_NETWORK_METRIC_KEY(SPARSE_WEIGHTS_LAYERS)).as<std::map<std::string, float>>();
+    if (isSparse) {
+        ASSERT_EQ(1, sparseLayers.size());
+        ASSERT_NEAR(sparseRate, sparseLayers.begin()->second, 0.01f);
+    } else {
+        ASSERT_TRUE(sparseLayers.empty());
+    }
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(smoke_SparseWeights, SparseWeightsTest,
+                        ::testing::Combine(
+                                ::testing::Values(SizeVector{1, 160}, SizeVector{3, 70, 160}),
+                                ::testing::Values("", "0.8", "0.95")),
+                        SparseWeightsTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,100 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ngraph/opsets/opset5.hpp>
+#include "subgraph_tests/include/state_sessions.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+std::string StateSessionsTest::getTestCaseName(testing::TestParamInfo<StateSessionsParams> obj) {
+    SizeVector inputShape;
+    size_t sessions;
+    std::tie(inputShape, sessions) = obj.param;
+
+    std::ostringstream result;
+    result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+    result << "Sessions=" << sessions;
+    return result.str();
+}
+
+// accumulates inputs in the state: out = state + in, state = out
+void StateSessionsTest::SetUp() {
+    targetDevice = CommonTestUtils::DEVICE_CPU;
+    std::tie(inputShape, sessions) = this->GetParam();
+
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+    auto init = ngraph::builder::makeConstant<float>(ngraph::element::f32, inputShape, {0.f});
+    auto read = std::make_shared<ngraph::opset5::ReadValue>(init, "acc");
+    auto sum = std::make_shared<ngraph::opset5::Add>(read, params[0]);
+    auto assign = std::make_shared<ngraph::opset5::Assign>(sum, "acc");
+    auto relu = std::make_shared<ngraph::opset5::Relu>(sum);
+
+    assign->add_control_dependency(read);
+    relu->add_control_dependency(assign);
+    ngraph::ResultVector results{std::make_shared<ngraph::opset5::Result>(relu)};
+    function = std::make_shared<ngraph::Function>(results, params, "StateSessions");
+}
+
+void StateSessionsTest::InferSession(size_t session, float value, float expected) {
+    inferRequest.SetStateSession(session);
+    auto input = make_shared_blob<float>(executableNetwork.GetInputsInfo().begin()->second->getTensorDesc());
+    input->allocate();
+    std::fill_n(input->buffer().as<float*>(), input->size(), value);
+    inferRequest.SetBlob(executableNetwork.GetInputsInfo().begin()->first, input);
+    inferRequest.Infer();
+
+    auto output = inferRequest.GetBlob(executableNetwork.GetOutputsInfo().begin()->first);
+    const auto* outputData = output->cbuffer().as<const float*>();
+    for (size_t i = 0; i < output->size(); i++)
+        ASSERT_FLOAT_EQ(expected, outputData[i]) << "Session " << session << ", index " << i;
+}
+
+TEST_P(StateSessionsTest, SessionsKeepIndependentStates) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    LoadNetwork();
+    inferRequest = executableNetwork.CreateInferRequest();
+    for (size_t round = 1; round <= 2; round++) {
+        for (size_t s = 0; s < sessions; s++)
+            InferSession(s, static_cast<float>(s + 1), static_cast<float>(round * (s + 1)));
+    }
+
+    auto states = inferRequest.QueryState();
+    ASSERT_EQ(1, states.size());
+    auto state = states.front().GetState();
+    const auto* stateData = state->cbuffer().as<const float*>();
+    for (size_t i = 0; i < state->size(); i++)
+        ASSERT_FLOAT_EQ(static_cast<float>(2 * sessions), stateData[i]);
+}
+
+TEST_P(StateSessionsTest, ReleasedSessionStartsFromDefaultState) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    LoadNetwork();
+    inferRequest = executableNetwork.CreateInferRequest();
+    for (size_t s = 0; s < sessions; s++)
+        InferSession(s, 1.f, 1.f);
+
+    // selected session cannot be released
+    const size_t last = sessions - 1;
+    ASSERT_THROW(inferRequest.ReleaseStateSession(last), Exception);
+    inferRequest.SetStateSession(0);
+    inferRequest.ReleaseStateSession(last);
+    InferSession(last, 2.f, 2.f);
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(smoke_StateSessions, StateSessionsTest,
+                        ::testing::Combine(
+                                ::testing::Values(SizeVector{1, 8}, SizeVector{2, 16}),
+                                ::testing::Values(2, 3)),
+                        StateSessionsTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
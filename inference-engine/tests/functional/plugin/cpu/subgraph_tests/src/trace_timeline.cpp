@@ -0,0 +1,117 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include "subgraph_tests/include/trace_timeline.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+std::string TraceTimelineTest::getTestCaseName(testing::TestParamInfo<TraceTimelineParams> obj) {
+    SizeVector inputShape;
+    std::string streams;
+    size_t requestsCount;
+    std::tie(inputShape, streams, requestsCount) = obj.param;
+
+    std::ostringstream result;
+    result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+    result << "Streams=" << streams << "_";
+    result << "Requests=" << requestsCount;
+    return result.str();
+}
+
+void TraceTimelineTest::SetUp() {
+    targetDevice = CommonTestUtils::DEVICE_CPU;
+    SizeVector inputShape;
+    std::string streams;
+    std::tie(inputShape, streams, std::ignore) = this->GetParam();
+    configuration.insert({PluginConfigParams::KEY_CPU_TRACE_FILE, traceFile});
+    configuration.insert({PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, streams});
+    std::remove(traceFile.c_str());
+
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+    auto relu = std::make_shared<ngraph::opset1::Relu>(params[0]);
+    ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(relu)};
+    function = std::make_shared<ngraph::Function>(results, params, "TraceTimeline");
+}
+
+void TraceTimelineTest::TearDown() {
+    std::remove(traceFile.c_str());
+}
+
+// the requests run asynchronously for several iterations, then the first one is validated by a synchronous inference
+void TraceTimelineTest::Infer() {
+    const auto inputName = executableNetwork.GetInputsInfo().begin()->first;
+    inputs = {GenerateInput(*executableNetwork.GetInputsInfo().begin()->second)};
+    requests.clear();
+    for (size_t i = 0; i < std::get<2>(GetParam()); i++) {
+        requests.push_back(executableNetwork.CreateInferRequest());
+        requests.back().SetBlob(inputName, inputs[0]);
+    }
+    for (int iteration = 0; iteration < 3; iteration++) {
+        for (auto& request : requests)
+            request.StartAsync();
+        for (auto& request : requests)
+            ASSERT_EQ(StatusCode::OK, request.Wait(IInferRequest::WaitMode::RESULT_READY));
+    }
+    inferRequest = requests.front();
+    inferRequest.Infer();
+}
+
+std::string TraceTimelineTest::ReleaseAndReadTrace() {
+    requests.clear();
+    inferRequest = {};
+    executableNetwork = {};
+
+    std::ifstream file(traceFile);
+    if (!file.is_open())
+        return {};
+    std::stringstream trace;
+    trace << file.rdbuf();
+    return trace.str();
+}
+
+TEST_P(TraceTimelineTest, TraceIsWrittenOnNetworkRelease) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    ASSERT_EQ(traceFile, executableNetwork.GetConfig(PluginConfigParams::KEY_CPU_TRACE_FILE).as<std::string>());
+    const auto outputName = executableNetwork.GetOutputsInfo().begin()->first;
+
+    const auto content = ReleaseAndReadTrace();
+    ASSERT_NE(std::string::npos, content.find("\"traceEvents\"")) << traceFile << " is not written";
+    for (const auto& name : {outputName, std::string("Preprocessing"), std::string("PushInputData"), std::string("Infer"),
+                             std::string("PullOutputData"), std::string("Pipeline stage 0")}) {
+        EXPECT_NE(std::string::npos, content.find("\"name\":\"" + name + "\"")) << name << " is not traced";
+    }
+    const auto lastRequest = std::get<2>(GetParam()) - 1;
+    EXPECT_NE(std::string::npos, content.find("\"request\":" + std::to_string(lastRequest)));
+}
+
+TEST_P(TraceTimelineTest, TraceIsDisabledByDefault) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    configuration.erase(PluginConfigParams::KEY_CPU_TRACE_FILE);
+    Run();
+    ASSERT_EQ(std::string(), executableNetwork.GetConfig(PluginConfigParams::KEY_CPU_TRACE_FILE).as<std::string>());
+    ASSERT_EQ(std::string(), ReleaseAndReadTrace());
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(smoke_TraceTimeline, TraceTimelineTest,
+                        ::testing::Combine(
+                                ::testing::Values(SizeVector{1, 3, 16, 16}),
+                                ::testing::Values("1", "2"),
+                                ::testing::Values(2, 4)),
+                        TraceTimelineTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,91 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <blob_factory.hpp>
+
+#include "subgraph_tests/include/zero_copy_output.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+std::string ZeroCopyOutputTest::getTestCaseName(testing::TestParamInfo<ZeroCopyOutputParams> obj) {
+    SizeVector inputShape;
+    std::string streams;
+    std::tie(inputShape, streams) = obj.param;
+
+    std::ostringstream result;
+    result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+    result << "Streams=" << streams;
+    return result.str();
+}
+
+void ZeroCopyOutputTest::SetUp() {
+    targetDevice = CommonTestUtils::DEVICE_CPU;
+    SizeVector inputShape;
+    std::string streams;
+    std::tie(inputShape, streams) = this->GetParam();
+    configuration.insert({PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::YES});
+    configuration.insert({PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, streams});
+
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+    auto scales = ngraph::builder::makeConstant<float>(ngraph::element::f32, {1, inputShape[1], 1, 1}, {}, true, 3, 1);
+    auto multiply = std::make_shared<ngraph::opset1::Multiply>(params[0], scales);
+    auto relu = std::make_shared<ngraph::opset1::Relu>(multiply);
+    ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(relu)};
+    function = std::make_shared<ngraph::Function>(results, params, "ZeroCopyOutput");
+}
+
+// the user output blob is set for one request, the other one keeps the default blob, with a single stream both share the graph
+void ZeroCopyOutputTest::Infer() {
+    const auto inputName = executableNetwork.GetInputsInfo().begin()->first;
+    const auto outputName = executableNetwork.GetOutputsInfo().begin()->first;
+    inferRequest = executableNetwork.CreateInferRequest();
+    defaultRequest = executableNetwork.CreateInferRequest();
+
+    userOutput = make_blob_with_precision(executableNetwork.GetOutputsInfo().begin()->second->getTensorDesc());
+    userOutput->allocate();
+    inferRequest.SetBlob(outputName, userOutput);
+
+    const auto& inputDesc = executableNetwork.GetInputsInfo().begin()->second->getTensorDesc();
+    inputs = {FuncTestUtils::createAndFillBlob(inputDesc, 10, -5)};
+    defaultInputs = {FuncTestUtils::createAndFillBlob(inputDesc, 10, -3)};
+    inferRequest.SetBlob(inputName, inputs[0]);
+    defaultRequest.SetBlob(inputName, defaultInputs[0]);
+
+    inferRequest.Infer();
+    defaultRequest.Infer();
+}
+
+TEST_P(ZeroCopyOutputTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    const auto outputName = executableNetwork.GetOutputsInfo().begin()->first;
+    ASSERT_EQ(userOutput->buffer().as<void*>(), inferRequest.GetBlob(outputName)->buffer().as<void*>());
+
+    auto perfCounts = inferRequest.GetPerformanceCounts();
+    auto outputCounter = perfCounts.find("out_" + outputName);
+    ASSERT_NE(perfCounts.end(), outputCounter);
+    ASSERT_STREQ("zero_copy", outputCounter->second.exec_type);
+
+    // the request with the default output blob is not affected by the user one
+    inferRequest = defaultRequest;
+    inputs = defaultInputs;
+    Validate();
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(smoke_ZeroCopyOutput, ZeroCopyOutputTest,
+                        ::testing::Combine(
+                                ::testing::Values(SizeVector{1, 3, 16, 16}, SizeVector{2, 8, 5, 7}),
+                                ::testing::Values("1", "2")),
+                        ZeroCopyOutputTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
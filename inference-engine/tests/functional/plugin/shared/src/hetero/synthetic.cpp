@@ -5,6 +5,7 @@
 #include "hetero/synthetic.hpp"
 #include <ngraph/op/util/op_types.hpp>
 #include <ngraph/variant.hpp>
+#include <hetero/hetero_plugin_config.hpp>
 #include "ngraph_functions/builders.hpp"
 #include "ngraph_functions/subgraph_builders.hpp"
 #include <random>
@@ -149,4 +150,19 @@ TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallback) {
     }
 }
 
+TEST_P(HeteroSyntheticTest, minCostPartitionKeepsSingleSubgraphForEqualDevices) {
+    for (auto&& node : function->get_ordered_ops()) {
+        node->get_rt_info().erase("affinity");
+    }
+    configuration[HETERO_CONFIG_KEY(PARTITION_POLICY)] = HETERO_CONFIG_VALUE(MIN_COST);
+    Run();
+    if (!FuncTestUtils::SkipTestsConfig::currentTestIsDisabled()) {
+        auto report = executableNetwork.GetMetric(EXEC_NETWORK_METRIC_KEY(HETERO_PARTITION)).as<std::string>();
+        SCOPED_TRACE(report);
+        ASSERT_NE(std::string::npos, report.find("subgraph0: "));
+        ASSERT_EQ(std::string::npos, report.find("subgraph1: "));
+        ASSERT_EQ(std::string::npos, report.find("n/a"));
+    }
+}
+
 }  //  namespace HeteroTests
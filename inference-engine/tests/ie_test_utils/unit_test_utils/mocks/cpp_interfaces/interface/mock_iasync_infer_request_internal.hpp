@@ -27,6 +27,8 @@ public:
     MOCK_CONST_METHOD1(GetPreProcess, const InferenceEngine::PreProcessInfo&(const std::string&));
     MOCK_METHOD1(SetCompletionCallback, void(InferenceEngine::IInferRequest::CompletionCallback));
     MOCK_METHOD1(SetBatch, void(int));
+    MOCK_METHOD1(SetStateSession, void(size_t));
+    MOCK_METHOD1(ReleaseStateSession, void(size_t));
     MOCK_METHOD0(QueryState, std::vector<IVariableStateInternal::Ptr>());
     MOCK_METHOD0(Cancel, void());
 };
@@ -0,0 +1,121 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <mkldnn.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "mkldnn_plugin.h"
+#include "utils/primitive_cache.h"
+
+using namespace InferenceEngine;
+using MKLDNNPlugin::PrimitiveCache;
+
+class PrimitiveCacheTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        PrimitiveCache::getInstance().setCapacity(1024);
+    }
+
+    // dims are unique for each test, so primitives cached by other tests are not hit
+    static mkldnn::reorder::primitive_desc makeReorder(const mkldnn::engine& eng, mkldnn::memory::dim channels) {
+        mkldnn::memory::desc src({1, channels, 4, 4}, mkldnn::memory::data_type::f32, mkldnn::memory::format_tag::nchw);
+        mkldnn::memory::desc dst({1, channels, 4, 4}, mkldnn::memory::data_type::f32, mkldnn::memory::format_tag::nhwc);
+        return mkldnn::reorder::primitive_desc(eng, src, eng, dst);
+    }
+
+    mkldnn::engine eng{mkldnn::engine::kind::cpu, 0};
+};
+
+TEST_F(PrimitiveCacheTest, EqualDescriptorsShareThePrimitive) {
+    PrimitiveCache::Statistic statistic;
+    PrimitiveCache::StatisticScope scope(statistic);
+
+    auto first = PrimitiveCache::getInstance().getOrCreate(makeReorder(eng, 3));
+    auto second = PrimitiveCache::getInstance().getOrCreate(makeReorder(eng, 3));
+    auto other = PrimitiveCache::getInstance().getOrCreate(makeReorder(eng, 5));
+
+    ASSERT_EQ(first, second);
+    ASSERT_NE(first, other);
+    ASSERT_EQ(1u, statistic.hits);
+    ASSERT_EQ(2u, statistic.misses);
+    ASSERT_EQ(0u, statistic.uncached);
+}
+
+TEST_F(PrimitiveCacheTest, AttributeKeyIsPartOfTheKey) {
+    std::string firstKey, secondKey;
+    MKLDNNPlugin::appendPrimitiveCacheKey(firstKey, std::vector<uint8_t>{1, 2});
+    MKLDNNPlugin::appendPrimitiveCacheKey(secondKey, std::vector<uint8_t>{1, 3});
+
+    auto first = PrimitiveCache::getInstance().getOrCreate(makeReorder(eng, 7), firstKey);
+    auto second = PrimitiveCache::getInstance().getOrCreate(makeReorder(eng, 7), secondKey);
+    ASSERT_NE(first, second);
+    ASSERT_EQ(first, PrimitiveCache::getInstance().getOrCreate(makeReorder(eng, 7), firstKey));
+}
+
+TEST_F(PrimitiveCacheTest, PostOpsWithDataPointersAreNotCached) {
+    mkldnn::memory::desc src({1, 8, 6, 6}, mkldnn::memory::data_type::f32, mkldnn::memory::format_tag::any);
+    mkldnn::memory::desc weights({8, 8, 3, 3}, mkldnn::memory::data_type::f32, mkldnn::memory::format_tag::any);
+    mkldnn::memory::desc dst({1, 8, 4, 4}, mkldnn::memory::data_type::f32, mkldnn::memory::format_tag::any);
+    mkldnn::convolution_forward::desc desc(mkldnn::prop_kind::forward_inference, mkldnn::algorithm::convolution_direct,
+                                           src, weights, dst, {1, 1}, {0, 0}, {0, 0});
+
+    std::vector<float> scales(8, 2.f), shifts(8, 1.f);
+    mkldnn::post_ops ops;
+    ops.append_depthwise(mkldnn::algorithm::depthwise_scale_shift, scales.data(), shifts.data());
+    mkldnn::primitive_attr attr;
+    attr.set_post_ops(ops);
+    mkldnn::convolution_forward::primitive_desc pd(desc, attr, eng);
+
+    PrimitiveCache::Statistic statistic;
+    PrimitiveCache::StatisticScope scope(statistic);
+    auto first = PrimitiveCache::getInstance().getOrCreate(pd);
+    auto second = PrimitiveCache::getInstance().getOrCreate(pd);
+
+    ASSERT_NE(first, second);
+    ASSERT_EQ(0u, statistic.hits);
+    ASSERT_EQ(0u, statistic.misses);
+    ASSERT_EQ(2u, statistic.uncached);
+}
+
+TEST_F(PrimitiveCacheTest, ZeroCapacityDisablesCache) {
+    PrimitiveCache::getInstance().setCapacity(0);
+    auto first = PrimitiveCache::getInstance().getOrCreate(makeReorder(eng, 9));
+    auto second = PrimitiveCache::getInstance().getOrCreate(makeReorder(eng, 9));
+    ASSERT_NE(first, second);
+}
+
+TEST_F(PrimitiveCacheTest, LeastRecentlyUsedPrimitiveIsEvicted) {
+    PrimitiveCache::getInstance().setCapacity(2);
+    auto first = PrimitiveCache::getInstance().getOrCreate(makeReorder(eng, 11));
+    auto second = PrimitiveCache::getInstance().getOrCreate(makeReorder(eng, 13));
+    ASSERT_EQ(first, PrimitiveCache::getInstance().getOrCreate(makeReorder(eng, 11)));
+    PrimitiveCache::getInstance().getOrCreate(makeReorder(eng, 15));
+
+    ASSERT_EQ(first, PrimitiveCache::getInstance().getOrCreate(makeReorder(eng, 11)));
+    ASSERT_NE(second, PrimitiveCache::getInstance().getOrCreate(makeReorder(eng, 13)));
+}
+
+TEST_F(PrimitiveCacheTest, LoadNetworkAppliesCapacity) {
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 8});
+    auto relu = std::make_shared<ngraph::opset1::Relu>(param);
+    auto function = std::make_shared<ngraph::Function>(ngraph::NodeVector{relu}, ngraph::ParameterVector{param});
+
+    MKLDNNPlugin::Engine engine;
+    auto execNetwork = engine.LoadNetwork(CNNNetwork(function), {{PluginConfigParams::KEY_CPU_RUNTIME_CACHE_CAPACITY, "0"}});
+    ASSERT_NE(nullptr, execNetwork);
+
+    auto first = PrimitiveCache::getInstance().getOrCreate(makeReorder(eng, 17));
+    ASSERT_NE(first, PrimitiveCache::getInstance().getOrCreate(makeReorder(eng, 17)));
+
+    auto statistic = execNetwork->GetMetric(METRIC_KEY(RUNTIME_CACHE_STATISTIC)).as<std::map<std::string, uint64_t>>();
+    ASSERT_EQ(1u, statistic.count("HITS"));
+    ASSERT_EQ(1u, statistic.count("MISSES"));
+    ASSERT_EQ(1u, statistic.count("UNCACHED"));
+}
@@ -22,6 +22,7 @@ const std::map<std::string, std::string>  supportedConfigKeysWithDefaults = {
     {GNA_CONFIG_KEY(PRECISION), Precision(Precision::I16).name()},
     {GNA_CONFIG_KEY(PWL_UNIFORM_DESIGN), CONFIG_VALUE(NO)},
     {GNA_CONFIG_KEY(PWL_MAX_ERROR_PERCENT), "1.000000"},
+    {GNA_CONFIG_KEY(PWL_CACHE_FILE), ""},
     {CONFIG_KEY(PERF_COUNT), CONFIG_VALUE(NO)},
     {GNA_CONFIG_KEY(LIB_N_THREADS), "1"},
     {CONFIG_KEY(SINGLE_THREAD), CONFIG_VALUE(YES)}
@@ -166,6 +167,13 @@ TEST_F(GNAPluginConfigTest, GnaConfigPwlMaxErrorPercentTest) {
     ExpectThrow(GNA_CONFIG_KEY(PWL_MAX_ERROR_PERCENT), "100.1");
 }
 
+TEST_F(GNAPluginConfigTest, GnaConfigPwlCacheFileTest) {
+    SetAndCompare(GNA_CONFIG_KEY(PWL_CACHE_FILE), "pwl.cache");
+    EXPECT_EQ(config.pwlCacheFile, "pwl.cache");
+    SetAndCompare(GNA_CONFIG_KEY(PWL_CACHE_FILE), "");
+    EXPECT_TRUE(config.pwlCacheFile.empty());
+}
+
 TEST_F(GNAPluginConfigTest, GnaConfigPerfCountTest) {
     SetAndCheckFlag(CONFIG_KEY(PERF_COUNT),
                     config.gnaFlags.performance_counting);
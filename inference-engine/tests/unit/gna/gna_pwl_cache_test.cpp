@@ -0,0 +1,153 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdio>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "backend/pwl_cache.hpp"
+#include "runtime/pwl.h"
+
+using namespace GNAPluginNS::backend;
+
+namespace {
+const char* cacheFile = "gna_pwl_cache_test.bin";
+
+class GNAPwlCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        PwlCache::instance().clear();
+    }
+    void TearDown() override {
+        PwlCache::instance().clear();
+        std::remove(cacheFile);
+    }
+};
+
+// activations of the graph compiler always initialize FakeQuantize parameters
+DnnActivation makeActivation(DnnActivationType type) {
+    auto activation = DnnActivation::fromType(type);
+    activation.fqParams.set = false;
+    activation.srcFQParams.set = false;
+    return activation;
+}
+
+std::vector<gna_pwl_segment_t> designTanh(float scale_in, float scale_out) {
+    std::vector<gna_pwl_segment_t> segments;
+    PwlDesignOpt(makeActivation(kActTanh), segments, scale_in, scale_out, 1.0f, false);
+    return segments;
+}
+
+bool equal(const std::vector<gna_pwl_segment_t>& lhs, const std::vector<gna_pwl_segment_t>& rhs) {
+    if (lhs.size() != rhs.size()) return false;
+    for (size_t i = 0; i < lhs.size(); i++) {
+        if (lhs[i].xBase != rhs[i].xBase || lhs[i].yBase != rhs[i].yBase || lhs[i].slope != rhs[i].slope) return false;
+    }
+    return true;
+}
+}  // namespace
+
+TEST_F(GNAPwlCacheTest, keyDependsOnScaleFactors) {
+    auto activation = makeActivation(kActSigmoid);
+    EXPECT_EQ(PwlCache::makeKey(activation, 2048.f, 2048.f, 1.f, false),
+              PwlCache::makeKey(activation, 2048.f, 2048.f, 1.f, false));
+    EXPECT_NE(PwlCache::makeKey(activation, 2048.f, 2048.f, 1.f, false),
+              PwlCache::makeKey(activation, 1024.f, 2048.f, 1.f, false));
+    EXPECT_NE(PwlCache::makeKey(activation, 2048.f, 2048.f, 1.f, false),
+              PwlCache::makeKey(makeActivation(kActTanh), 2048.f, 2048.f, 1.f, false));
+}
+
+TEST_F(GNAPwlCacheTest, keyDependsOnlyOnArgumentsOfActivationType) {
+    auto sigmoid = makeActivation(kActSigmoid);
+    auto sigmoidWithGarbage = sigmoid;
+    sigmoidWithGarbage.args.pow = {2.f, 3.f, 4.f};
+    EXPECT_EQ(PwlCache::makeKey(sigmoid, 2048.f, 2048.f, 1.f, false),
+              PwlCache::makeKey(sigmoidWithGarbage, 2048.f, 2048.f, 1.f, false));
+
+    auto leakyRelu = makeActivation(kActLeakyRelu);
+    leakyRelu.args.pow = {2.f, 3.f, 4.f};
+    leakyRelu.args.lrelu.negative_slope = 0.1f;
+    auto otherLeakyRelu = makeActivation(kActLeakyRelu);
+    otherLeakyRelu.args.lrelu.negative_slope = 0.1f;
+    EXPECT_EQ(PwlCache::makeKey(leakyRelu, 2048.f, 2048.f, 1.f, false),
+              PwlCache::makeKey(otherLeakyRelu, 2048.f, 2048.f, 1.f, false));
+    otherLeakyRelu.args.lrelu.negative_slope = 0.2f;
+    EXPECT_NE(PwlCache::makeKey(leakyRelu, 2048.f, 2048.f, 1.f, false),
+              PwlCache::makeKey(otherLeakyRelu, 2048.f, 2048.f, 1.f, false));
+
+    auto pow = makeActivation(kActPow);
+    pow.args.pow = {2.f, 1.f, 0.f};
+    auto otherPow = pow;
+    otherPow.args.pow.offset = 1.f;
+    EXPECT_NE(PwlCache::makeKey(pow, 2048.f, 2048.f, 1.f, false),
+              PwlCache::makeKey(otherPow, 2048.f, 2048.f, 1.f, false));
+}
+
+TEST_F(GNAPwlCacheTest, designedSegmentsAreReused) {
+    auto designed = designTanh(2048.f, 2048.f);
+    ASSERT_FALSE(designed.empty());
+
+    std::vector<gna_pwl_segment_t> cached;
+    ASSERT_TRUE(PwlCache::instance().find(PwlCache::makeKey(makeActivation(kActTanh), 2048.f, 2048.f, 1.0f, false), cached));
+    EXPECT_TRUE(equal(designed, cached));
+    EXPECT_TRUE(equal(designed, designTanh(2048.f, 2048.f)));
+}
+
+TEST_F(GNAPwlCacheTest, segmentsArePersisted) {
+    auto designed = designTanh(2048.f, 4096.f);
+    PwlCache::instance().save(cacheFile);
+    PwlCache::instance().clear();
+
+    PwlCache::instance().load(cacheFile);
+    std::vector<gna_pwl_segment_t> loaded;
+    ASSERT_TRUE(PwlCache::instance().find(PwlCache::makeKey(makeActivation(kActTanh), 2048.f, 4096.f, 1.0f, false), loaded));
+    EXPECT_TRUE(equal(designed, loaded));
+}
+
+TEST_F(GNAPwlCacheTest, unwritableFileIsNotFatal) {
+    designTanh(2048.f, 2048.f);
+    ASSERT_NO_THROW(PwlCache::instance().save("not_existing_dir/pwl_cache.bin"));
+}
+
+TEST_F(GNAPwlCacheTest, applyMatchesSegmentsDefinition) {
+    auto segments = designTanh(2048.f, 2048.f);
+    std::vector<int32_t> inputs;
+    for (int32_t x = -6 * 2048; x <= 6 * 2048; x += 37) {
+        inputs.push_back(x);
+    }
+    std::vector<int16_t> outputs(inputs.size());
+
+    intel_dnn_component_t component = {};
+    component.op.pwl.func_id = makeActivation(kActTanh);
+    component.op.pwl.num_segments = static_cast<uint32_t>(segments.size());
+    component.op.pwl.ptr_segments = segments.data();
+    component.orientation_in = kDnnNonInterleavedOrientation;
+    component.num_rows_in = 1;
+    component.num_columns_in = static_cast<uint32_t>(inputs.size());
+    component.ptr_inputs = inputs.data();
+    component.ptr_outputs = outputs.data();
+    PwlApply16(&component, 1);
+
+    // rows applied with the segments decoded once give the same outputs
+    std::vector<int16_t> outputsOfDecoded(inputs.size());
+    component.ptr_outputs = outputsOfDecoded.data();
+    const auto decoded = PwlDecodeSegments16(component.op.pwl);
+    PwlApply16(&component, decoded, 0, 0, 0, component.num_columns_in / 2);
+    PwlApply16(&component, decoded, 0, 0, component.num_columns_in / 2 + 1, component.num_columns_in - 1);
+    ASSERT_EQ(outputs, outputsOfDecoded);
+
+    for (size_t i = 0; i < inputs.size(); i++) {
+        // last segment starting not above the input
+        size_t k = 0;
+        while (k + 1 < segments.size() && static_cast<int32_t>(segments[k + 1].xBase & XBASEMASK) <= inputs[i]) k++;
+        int64_t xbase = static_cast<int32_t>(segments[k].xBase & XBASEMASK);
+        int64_t expected = segments[0].yBase;
+        if (inputs[i] > static_cast<int32_t>(segments[0].xBase & XBASEMASK)) {
+            uint32_t shift = ((segments[k].xBase & ~XBASEMASK) + 1) * 8;
+            expected = (((inputs[i] - xbase) * segments[k].slope) >> shift) + segments[k].yBase;
+            expected = std::min<int64_t>(std::max<int64_t>(expected, -32768), 32767);
+        }
+        ASSERT_EQ(expected, outputs[i]) << "at input " << inputs[i];
+    }
+}
@@ -13,6 +13,7 @@
 #include "ngraph/ops.hpp"
 #include "ngraph/variant.hpp"
 #include "ngraph/opsets/opset6.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "transformations/rt_info/dequantization_attribute.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
@@ -349,6 +350,80 @@ TEST(NetworkContext_CNNNetwork, HashWithDifferentMeanValues) {
               NetworkCompilationContext::computeHash(net3, {}));
 }
 
+TEST(NetworkContext_CNNNetwork, HashWithDifferentConstantValues) {
+    auto net1 = createNetwork();
+    auto net2 = createNetwork();
+    auto net3 = createNetwork();
+    for (auto& op : net3.getFunction()->get_ops()) {
+        if (op->get_friendly_name() == "add_constant") {
+            auto constant = ngraph::opset6::Constant::create(ngraph::element::i8, ngraph::Shape{1}, {5});
+            constant->set_friendly_name("add_constant");
+            ngraph::replace_node(op, constant);
+            break;
+        }
+    }
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net3, {}));
+}
+
+static CNNNetwork createClampNetwork(double maxValue, const std::vector<float>& weights) {
+    auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{weights.size()});
+    data->set_friendly_name("Parameter");
+    auto constant = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{weights.size()}, weights);
+    constant->set_friendly_name("weights");
+    auto mul = std::make_shared<ngraph::opset6::Multiply>(data, constant);
+    mul->set_friendly_name("mul");
+    auto clamp = std::make_shared<ngraph::opset6::Clamp>(mul, 0., maxValue);
+    clamp->set_friendly_name("clamp");
+    auto res = std::make_shared<ngraph::opset6::Result>(clamp);
+    res->set_friendly_name("res");
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithDifferentAttributes) {
+    std::vector<float> weights(16, 1.f);
+    ASSERT_EQ(NetworkCompilationContext::computeHash(createClampNetwork(6., weights), {}),
+              NetworkCompilationContext::computeHash(createClampNetwork(6., weights), {}));
+    ASSERT_NE(NetworkCompilationContext::computeHash(createClampNetwork(6., weights), {}),
+              NetworkCompilationContext::computeHash(createClampNetwork(5., weights), {}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashOfLargeConstants) {
+    // Larger than a hashing chunk, so the constant is hashed in parallel and its hash is memoized
+    std::vector<float> weights(3 * 1024 * 1024 / sizeof(float) + 3);
+    for (std::size_t i = 0; i < weights.size(); ++i) {
+        weights[i] = static_cast<float>(i % 1000);
+    }
+    auto net1 = createClampNetwork(6., weights);
+    auto net2 = createClampNetwork(6., weights);
+    weights.back() += 1.f;
+    auto net3 = createClampNetwork(6., weights);
+
+    auto hash1 = NetworkCompilationContext::computeHash(net1, {});
+    ASSERT_EQ(hash1, NetworkCompilationContext::computeHash(net1, {}));
+    ASSERT_EQ(hash1, NetworkCompilationContext::computeHash(net2, {}));
+    ASSERT_NE(hash1, NetworkCompilationContext::computeHash(net3, {}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashOfSharedConstantFollowsData) {
+    // Constant over shared memory, as created by ReadNetwork from the weights blob
+    auto weights = std::make_shared<std::vector<float>>(1024 * 1024, 1.f);
+    auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<std::vector<float>>>>(
+            reinterpret_cast<char*>(weights->data()), weights->size() * sizeof(float), weights);
+    auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{weights->size()});
+    auto constant = std::make_shared<ngraph::opset6::Constant>(ngraph::element::f32, ngraph::Shape{weights->size()}, buffer);
+    auto mul = std::make_shared<ngraph::opset6::Multiply>(data, constant);
+    auto res = std::make_shared<ngraph::opset6::Result>(mul);
+    CNNNetwork net(std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data}));
+
+    auto hash1 = NetworkCompilationContext::computeHash(net, {});
+    ASSERT_EQ(hash1, NetworkCompilationContext::computeHash(net, {}));
+    weights->at(weights->size() / 2) = 2.f;
+    ASSERT_NE(hash1, NetworkCompilationContext::computeHash(net, {}));
+}
+
 // Verify all internal hash calculations are thread-safe (like ngraph::function serialization)
 TEST(NetworkContext_CNNNetwork, HashOfSameMultiThreading) {
     auto net1 = createNetwork();
@@ -36,3 +36,17 @@ TEST(ExecutorManagerTests, returnTheSameExecutorForTheSameDevice) {
     ASSERT_EQ(executor, executor2);
     ASSERT_EQ(2, _manager.getExecutorsNumber());
 }
+
+TEST(ExecutorManagerTests, idleStreamsExecutorIsNotReusedForDifferentCoresPlacement) {
+    ExecutorManagerImpl _manager;
+    IStreamsExecutor::Config anyCoresConfig{"CPUStreamsExecutor"};
+    auto performanceCoresConfig = anyCoresConfig;
+    performanceCoresConfig._coresPlacement = IStreamsExecutor::CoresPlacement::PERFORMANCE;
+
+    auto executor = _manager.getIdleCPUStreamsExecutor(anyCoresConfig).get();
+    ASSERT_NE(executor, _manager.getIdleCPUStreamsExecutor(performanceCoresConfig).get());
+    ASSERT_EQ(2, _manager.getIdleCPUStreamsExecutorsNumber());
+
+    ASSERT_EQ(executor, _manager.getIdleCPUStreamsExecutor(anyCoresConfig).get());
+    ASSERT_EQ(2, _manager.getIdleCPUStreamsExecutorsNumber());
+}
@@ -3,6 +3,8 @@
 //
 
 #include <memory>
+#include <thread>
+#include <vector>
 #include <gtest/gtest.h>
 
 #include "common_test_utils/test_common.hpp"
@@ -62,4 +64,26 @@ TEST_F(SystemAllocatorTests, canLockAndUnlockAllocatedMemory) {
     EXPECT_EQ(ptr[9999], 11);
     allocator->unlock(ptr);
     allocator->free(handle);
-}
\ No newline at end of file
+}
+TEST_F(SystemAllocatorReleaseTests, numaAllocatorCanAllocateFromSeveralThreads) {
+    auto first = std::make_shared<NUMAMemoryAllocator>(0);
+    auto second = std::make_shared<NUMAMemoryAllocator>(0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&, t] {
+            auto& allocator = t % 2 ? first : second;
+            for (int i = 0; i < 16; i++) {
+                const size_t size = 10000 * (i + 1);
+                void* handle = allocator->alloc(size);
+                ASSERT_NE(handle, nullptr);
+                char* ptr = reinterpret_cast<char*>(allocator->lock(handle));
+                ptr[size - 1] = 11;
+                EXPECT_EQ(ptr[size - 1], 11);
+                allocator->unlock(ptr);
+                EXPECT_TRUE(allocator->free(handle));
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+}
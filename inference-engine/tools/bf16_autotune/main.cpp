@@ -0,0 +1,479 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <random>
+#include <set>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gflags/gflags.h>
+
+#include <exec_graph_info.hpp>
+#include <inference_engine.hpp>
+#include <ngraph/graph_util.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/variant.hpp>
+
+static constexpr char help_message[] =
+                                             "Optional. Print the usage message.";
+
+static constexpr char model_message[] =
+                                             "Required. Path to FP32 XML model.";
+
+static constexpr char inputs_message[] =
+                                             "Optional. Comma separated paths to calibration samples. Each sample is a raw binary file "
+                                             "with FP32 values of all network inputs in the order of their names.";
+
+static constexpr char samples_message[] =
+                                             "Optional. Number of random samples which are used if no calibration samples are given. Default value: 4.";
+
+static constexpr char tolerance_message[] =
+                                             "Optional. Maximal relative error of network outputs in comparison with FP32 execution. Default value: 0.01.";
+
+static constexpr char iterations_message[] =
+                                             "Optional. Number of inference runs over all samples to measure layers time. Default value: 10.";
+
+static constexpr char output_message[] =
+                                             "Optional. Path to XML model with precision plan. Default value: <model>_bf16.xml.";
+
+DEFINE_bool(h, false, help_message);
+DEFINE_string(m, "", model_message);
+DEFINE_string(i, "", inputs_message);
+DEFINE_uint32(samples, 4, samples_message);
+DEFINE_double(tolerance, 0.01, tolerance_message);
+DEFINE_uint32(niter, 10, iterations_message);
+DEFINE_string(o, "", output_message);
+
+using namespace InferenceEngine;
+
+using Sample = std::map<std::string, std::vector<float>>;
+using Outputs = std::vector<std::vector<float>>;
+
+struct RunResult {
+    std::vector<Outputs>            outputs;        // outputs of each sample in the order of output names
+    double                          latency = 0.0;  // mean latency of a single inference, ms
+    std::map<std::string, double>   layersTime;     // mean execution time of layers, us
+    std::map<std::string, std::vector<std::string>> originalLayers;  // original layers fused into each executed layer
+};
+
+static const char* const inferencePrecisionAttribute = "InferencePrecision";
+
+static void showUsage() {
+    std::cout << "bf16_autotune [OPTIONS]" << std::endl;
+    std::cout                                                                                      << std::endl;
+    std::cout << " Options:                                    "                                   << std::endl;
+    std::cout << "    -h                                       "   << help_message                 << std::endl;
+    std::cout << "    -m                           <value>     "   << model_message                << std::endl;
+    std::cout << "    -i                           <value>     "   << inputs_message               << std::endl;
+    std::cout << "    -samples                     <value>     "   << samples_message              << std::endl;
+    std::cout << "    -tolerance                   <value>     "   << tolerance_message            << std::endl;
+    std::cout << "    -niter                       <value>     "   << iterations_message           << std::endl;
+    std::cout << "    -o                           <value>     "   << output_message               << std::endl;
+    std::cout << std::endl;
+}
+
+static bool parseCommandLine(int* argc, char*** argv) {
+    gflags::ParseCommandLineNonHelpFlags(argc, argv, true);
+
+    if (FLAGS_h) {
+        showUsage();
+        return false;
+    }
+
+    if (FLAGS_m.empty()) {
+        throw std::invalid_argument("Path to model xml file is required");
+    }
+
+    if (FLAGS_tolerance < 0.0) {
+        throw std::invalid_argument("Tolerance has to be non negative");
+    }
+
+    if (FLAGS_niter == 0) {
+        throw std::invalid_argument("Number of iterations has to be positive");
+    }
+
+    return true;
+}
+
+static std::vector<std::string> split(const std::string& values) {
+    std::vector<std::string> result;
+    std::stringstream stream(values);
+    std::string value;
+    while (std::getline(stream, value, ',')) {
+        if (!value.empty()) {
+            result.push_back(value);
+        }
+    }
+    return result;
+}
+
+static size_t getSize(const SizeVector& dims) {
+    return std::accumulate(dims.begin(), dims.end(), static_cast<size_t>(1), std::multiplies<size_t>());
+}
+
+static std::vector<Sample> readSamples(const CNNNetwork& network) {
+    const auto inputsInfo = network.getInputsInfo();
+    std::vector<Sample> samples;
+    for (const auto& path : split(FLAGS_i)) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            throw std::invalid_argument("Cannot open calibration sample " + path);
+        }
+        Sample sample;
+        for (const auto& input : inputsInfo) {
+            auto& values = sample[input.first];
+            values.resize(getSize(input.second->getTensorDesc().getDims()));
+            if (!file.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(float))) {
+                throw std::invalid_argument("Calibration sample " + path + " is smaller than network inputs");
+            }
+        }
+        samples.push_back(sample);
+    }
+
+    if (samples.empty()) {
+        std::mt19937 generator(0);
+        std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+        for (uint32_t i = 0; i < FLAGS_samples; ++i) {
+            Sample sample;
+            for (const auto& input : inputsInfo) {
+                auto& values = sample[input.first];
+                values.resize(getSize(input.second->getTensorDesc().getDims()));
+                for (auto& value : values) {
+                    value = distribution(generator);
+                }
+            }
+            samples.push_back(sample);
+        }
+    }
+    return samples;
+}
+
+// Operations which precision is tuned: all operations producing FP32 tensors except inputs, outputs and constants
+static std::vector<std::shared_ptr<ngraph::Node>> getTunableOperations(const std::shared_ptr<ngraph::Function>& function) {
+    std::vector<std::shared_ptr<ngraph::Node>> operations;
+    for (const auto& op : function->get_ordered_ops()) {
+        if (ngraph::is_type<ngraph::opset1::Parameter>(op) ||
+            ngraph::is_type<ngraph::opset1::Constant>(op) ||
+            ngraph::is_type<ngraph::opset1::Result>(op)) {
+            continue;
+        }
+        bool isFloat = op->get_output_size() != 0;
+        for (const auto& output : op->outputs()) {
+            isFloat &= output.get_element_type() == ngraph::element::f32;
+        }
+        if (isFloat) {
+            operations.push_back(op);
+        }
+    }
+    return operations;
+}
+
+// Marks every tunable operation with InferencePrecision runtime attribute: BF16 for operations from the plan, FP32 otherwise
+static CNNNetwork makeNetwork(const std::shared_ptr<const ngraph::Function>& function, const std::set<std::string>& bf16Layers) {
+    auto clonedFunction = ngraph::clone_function(*function);
+    for (const auto& op : getTunableOperations(clonedFunction)) {
+        const auto precision = bf16Layers.count(op->get_friendly_name()) ? "BF16" : "FP32";
+        op->get_rt_info()[inferencePrecisionAttribute] = std::make_shared<ngraph::VariantWrapper<std::string>>(precision);
+    }
+    CNNNetwork network(clonedFunction);
+    for (auto& input : network.getInputsInfo()) {
+        input.second->setPrecision(Precision::FP32);
+    }
+    for (auto& output : network.getOutputsInfo()) {
+        output.second->setPrecision(Precision::FP32);
+    }
+    return network;
+}
+
+static RunResult run(Core& ie, CNNNetwork network, const std::vector<Sample>& samples, bool enforceBF16, uint32_t iterations) {
+    auto executableNetwork = ie.LoadNetwork(network, "CPU", {
+        {PluginConfigParams::KEY_ENFORCE_BF16, enforceBF16 ? PluginConfigParams::YES : PluginConfigParams::NO},
+        {PluginConfigParams::KEY_PERF_COUNT, iterations ? PluginConfigParams::YES : PluginConfigParams::NO}});
+    auto request = executableNetwork.CreateInferRequest();
+    const auto outputsInfo = executableNetwork.GetOutputsInfo();
+
+    RunResult result;
+    for (const auto& op : executableNetwork.GetExecGraphInfo().getFunction()->get_ops()) {
+        const auto& rtInfo = op->get_rt_info();
+        auto names = rtInfo.find(ExecGraphInfoSerialization::ORIGINAL_NAMES);
+        if (names == rtInfo.end()) {
+            continue;
+        }
+        if (auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(names->second)) {
+            result.originalLayers[op->get_friendly_name()] = split(value->get());
+        }
+    }
+
+    auto infer = [&](const Sample& sample) {
+        for (const auto& input : sample) {
+            auto blob = request.GetBlob(input.first);
+            std::copy(input.second.begin(), input.second.end(), blob->buffer().as<float*>());
+        }
+        request.Infer();
+    };
+
+    for (const auto& sample : samples) {
+        infer(sample);
+        Outputs outputs;
+        for (const auto& output : outputsInfo) {
+            auto blob = request.GetBlob(output.first);
+            const auto* data = blob->cbuffer().as<const float*>();
+            outputs.emplace_back(data, data + blob->size());
+        }
+        result.outputs.push_back(outputs);
+    }
+
+    if (iterations == 0) {
+        return result;
+    }
+
+    double total = 0.0;
+    for (uint32_t iteration = 0; iteration < iterations; ++iteration) {
+        for (const auto& sample : samples) {
+            const auto start = std::chrono::steady_clock::now();
+            infer(sample);
+            total += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            for (const auto& layer : request.GetPerformanceCounts()) {
+                if (layer.second.status == InferenceEngineProfileInfo::EXECUTED) {
+                    result.layersTime[layer.first] += static_cast<double>(layer.second.realTime_uSec);
+                }
+            }
+        }
+    }
+    const double runs = static_cast<double>(iterations * samples.size());
+    result.latency = total / runs;
+    for (auto& layer : result.layersTime) {
+        layer.second /= runs;
+    }
+    return result;
+}
+
+// Maximal absolute difference of outputs normalized by the range of reference outputs
+static double relativeError(const std::vector<Outputs>& reference, const std::vector<Outputs>& actual) {
+    double error = 0.0;
+    for (size_t sample = 0; sample < reference.size(); ++sample) {
+        for (size_t output = 0; output < reference[sample].size(); ++output) {
+            const auto& expected = reference[sample][output];
+            const auto& values = actual[sample][output];
+            double maxDifference = 0.0, maxReference = 0.0;
+            for (size_t i = 0; i < expected.size(); ++i) {
+                if (std::isnan(values[i]) != std::isnan(expected[i])) {
+                    return std::numeric_limits<double>::infinity();
+                }
+                maxDifference = std::max(maxDifference, static_cast<double>(std::fabs(values[i] - expected[i])));
+                maxReference = std::max(maxReference, static_cast<double>(std::fabs(expected[i])));
+            }
+            error = std::max(error, maxDifference / std::max(maxReference, 1e-6));
+        }
+    }
+    return error;
+}
+
+// Layers fused into one executed layer in any of the runs form a group which precision is tuned as a unit,
+// since a fused layer with a different precision breaks the fusion
+static std::vector<std::set<std::string>> getFusedGroups(const std::set<std::string>& layers, const std::vector<const RunResult*>& runs) {
+    std::map<std::string, std::string> parent;
+    for (const auto& layer : layers) {
+        parent[layer] = layer;
+    }
+    std::function<std::string(const std::string&)> find = [&](const std::string& layer) {
+        if (parent[layer] != layer) {
+            parent[layer] = find(parent[layer]);
+        }
+        return parent[layer];
+    };
+
+    for (const auto* result : runs) {
+        for (const auto& executed : result->originalLayers) {
+            std::string root;
+            for (const auto& layer : executed.second) {
+                if (!layers.count(layer)) {
+                    continue;
+                }
+                if (root.empty()) {
+                    root = find(layer);
+                } else {
+                    parent[find(layer)] = root;
+                }
+            }
+        }
+    }
+
+    std::map<std::string, std::set<std::string>> groups;
+    for (const auto& layer : layers) {
+        groups[find(layer)].insert(layer);
+    }
+    std::vector<std::set<std::string>> result;
+    for (const auto& group : groups) {
+        result.push_back(group.second);
+    }
+    return result;
+}
+
+// Execution time of the layers which the group is fused to, returns a negative value if none of them was executed
+static double getGroupTime(const RunResult& result, const std::set<std::string>& group) {
+    double time = -1.0;
+    for (const auto& layer : result.layersTime) {
+        auto originalLayers = result.originalLayers.find(layer.first);
+        if (originalLayers == result.originalLayers.end()) {
+            continue;
+        }
+        const auto& names = originalLayers->second;
+        if (std::any_of(names.begin(), names.end(), [&](const std::string& name) { return group.count(name) != 0; })) {
+            time = std::max(time, 0.0) + layer.second;
+        }
+    }
+    return time;
+}
+
+struct GroupCandidate {
+    std::set<std::string> layers;
+    double fp32Time = 0.0;
+    double bf16Time = 0.0;
+    double error = 0.0;
+};
+
+static void autotune(Core& ie) {
+    auto network = ie.ReadNetwork(FLAGS_m);
+    const auto function = network.getFunction();
+    if (function == nullptr) {
+        throw std::logic_error("Model " + FLAGS_m + " is not represented by nGraph function");
+    }
+
+    const auto capabilities = ie.GetMetric("CPU", METRIC_KEY(OPTIMIZATION_CAPABILITIES)).as<std::vector<std::string>>();
+    if (std::find(capabilities.begin(), capabilities.end(), METRIC_VALUE(BF16)) == capabilities.end()) {
+        throw std::logic_error("CPU does not support BF16 execution");
+    }
+
+    const auto samples = readSamples(network);
+    std::set<std::string> allLayers;
+    std::map<std::string, std::string> layerTypes;
+    for (const auto& op : getTunableOperations(function)) {
+        allLayers.insert(op->get_friendly_name());
+        layerTypes[op->get_friendly_name()] = op->get_type_name();
+    }
+
+    std::cout << "Model: " << FLAGS_m << std::endl;
+    std::cout << "    samples:        " << samples.size() << std::endl;
+    std::cout << "    tunable layers: " << allLayers.size() << std::endl;
+
+    // 1. Reference FP32 and full BF16 executions give outputs and per-layer cost in each precision
+    const auto fp32 = run(ie, makeNetwork(function, {}), samples, false, FLAGS_niter);
+    const auto bf16 = run(ie, makeNetwork(function, allLayers), samples, true, FLAGS_niter);
+    const double bf16Error = relativeError(fp32.outputs, bf16.outputs);
+
+    // 2. Layers fused together in either precision are grouped. Numeric error of each group which is faster in BF16
+    //    is measured with all other layers kept in FP32
+    std::vector<GroupCandidate> candidates;
+    for (const auto& group : getFusedGroups(allLayers, {&fp32, &bf16})) {
+        GroupCandidate candidate;
+        candidate.layers = group;
+        candidate.fp32Time = getGroupTime(fp32, group);
+        candidate.bf16Time = getGroupTime(bf16, group);
+        if (candidate.fp32Time < 0.0 || candidate.bf16Time < 0.0 || candidate.bf16Time >= candidate.fp32Time) {
+            continue;
+        }
+        candidate.error = relativeError(fp32.outputs, run(ie, makeNetwork(function, group), samples, true, 0).outputs);
+        if (candidate.error <= FLAGS_tolerance) {
+            candidates.push_back(candidate);
+        }
+    }
+
+    // 3. Groups with the best gain per error are switched to BF16 first,
+    //    the longest prefix which fits the tolerance is found by binary search
+    std::sort(candidates.begin(), candidates.end(), [](const GroupCandidate& a, const GroupCandidate& b) {
+        return (a.fp32Time - a.bf16Time) / (a.error + 1e-9) > (b.fp32Time - b.bf16Time) / (b.error + 1e-9);
+    });
+    auto makePlan = [&](size_t count) {
+        std::set<std::string> plan;
+        for (size_t i = 0; i < count; ++i) {
+            plan.insert(candidates[i].layers.begin(), candidates[i].layers.end());
+        }
+        return plan;
+    };
+    size_t low = 0, high = candidates.size();
+    while (low < high) {
+        const size_t middle = (low + high + 1) / 2;
+        const auto outputs = run(ie, makeNetwork(function, makePlan(middle)), samples, true, 0).outputs;
+        if (relativeError(fp32.outputs, outputs) <= FLAGS_tolerance) {
+            low = middle;
+        } else {
+            high = middle - 1;
+        }
+    }
+
+    // 4. Mixed plan is kept only if it is faster than both FP32 and full BF16 (if the latter fits the tolerance),
+    //    since reorders between precisions may eat the gain
+    auto plan = makePlan(low);
+    const auto mixed = run(ie, makeNetwork(function, plan), samples, true, FLAGS_niter);
+    double latency = mixed.latency;
+    if (fp32.latency <= latency) {
+        plan.clear();
+        latency = fp32.latency;
+    }
+    if (bf16Error <= FLAGS_tolerance && bf16.latency < latency) {
+        plan = allLayers;
+        latency = bf16.latency;
+    }
+
+    std::cout << std::fixed << std::setprecision(4);
+    std::cout << "    FP32 latency (ms):  " << fp32.latency << std::endl;
+    std::cout << "    BF16 latency (ms):  " << bf16.latency << ", error: " << bf16Error << std::endl;
+    std::cout << "    mixed latency (ms): " << mixed.latency << ", BF16 groups: " << low << std::endl;
+    std::cout << "    selected plan:      " << plan.size() << " of " << allLayers.size() << " layers in BF16, latency (ms): "
+              << latency << std::endl;
+    std::cout << "    candidate groups of fused layers, FP32 time (us) / BF16 time (us) / error:" << std::endl;
+    for (const auto& candidate : candidates) {
+        std::string layers;
+        for (const auto& name : candidate.layers) {
+            layers += (layers.empty() ? "" : " + ") + name + " (" + layerTypes[name] + ")";
+        }
+        std::cout << "        " << (plan.count(*candidate.layers.begin()) ? "[BF16] " : "[FP32] ") << std::left << std::setw(64)
+                  << layers << std::right << candidate.fp32Time << " / " << candidate.bf16Time << " / " << candidate.error << std::endl;
+    }
+
+    std::string output = FLAGS_o;
+    if (output.empty()) {
+        const auto extension = FLAGS_m.rfind(".xml");
+        output = (extension == std::string::npos ? FLAGS_m : FLAGS_m.substr(0, extension)) + "_bf16.xml";
+    }
+    const auto weights = output.substr(0, output.rfind(".xml")) + ".bin";
+    makeNetwork(function, plan).serialize(output, weights);
+    std::cout << "    saved to:           " << output << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    try {
+        std::cout << "Inference Engine: " << GetInferenceEngineVersion() << std::endl;
+        std::cout << std::endl;
+
+        if (!parseCommandLine(&argc, &argv)) {
+            return EXIT_SUCCESS;
+        }
+
+        Core ie;
+        autotune(ie);
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << std::endl;
+        return EXIT_FAILURE;
+    } catch (...) {
+        std::cerr << "Unknown/internal exception happened." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
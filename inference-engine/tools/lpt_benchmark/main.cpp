@@ -0,0 +1,224 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gflags/gflags.h>
+
+#include <inference_engine.hpp>
+#include <ngraph/graph_util.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <transformations/common_optimizations/lin_op_sequence_fusion.hpp>
+#include <transformations/init_node_info.hpp>
+#include <low_precision/pull_reshape_through_dequantization.hpp>
+#include <low_precision/pull_transpose_through_dequantization.hpp>
+#include <low_precision/transformer.hpp>
+#include <low_precision/convolution.hpp>
+#include <low_precision/group_convolution.hpp>
+#include <low_precision/multiply_to_group_convolution.hpp>
+
+static constexpr char help_message[] =
+                                             "Optional. Print the usage message.";
+
+static constexpr char model_message[] =
+                                             "Required. Comma separated paths to quantized XML models.";
+
+static constexpr char iterations_message[] =
+                                             "Optional. Number of low precision transformations runs for each model. Default value: 10.";
+
+static constexpr char top_message[] =
+                                             "Optional. Number of the most expensive transformations to report. Default value: 10.";
+
+DEFINE_bool(h, false, help_message);
+DEFINE_string(m, "", model_message);
+DEFINE_uint32(niter, 10, iterations_message);
+DEFINE_uint32(top, 10, top_message);
+
+using namespace ngraph::pass::low_precision;
+
+using Milliseconds = std::chrono::duration<double, std::ratio<1, 1000>>;
+
+static void showUsage() {
+    std::cout << "lpt_benchmark [OPTIONS]" << std::endl;
+    std::cout                                                                                      << std::endl;
+    std::cout << " Options:                                    "                                   << std::endl;
+    std::cout << "    -h                                       "   << help_message                 << std::endl;
+    std::cout << "    -m                           <value>     "   << model_message                << std::endl;
+    std::cout << "    -niter                       <value>     "   << iterations_message           << std::endl;
+    std::cout << "    -top                         <value>     "   << top_message                  << std::endl;
+    std::cout << std::endl;
+}
+
+static bool parseCommandLine(int* argc, char*** argv) {
+    gflags::ParseCommandLineNonHelpFlags(argc, argv, true);
+
+    if (FLAGS_h) {
+        showUsage();
+        return false;
+    }
+
+    if (FLAGS_m.empty()) {
+        throw std::invalid_argument("Path to model xml file is required");
+    }
+
+    if (FLAGS_niter == 0) {
+        throw std::invalid_argument("Number of iterations has to be positive");
+    }
+
+    return true;
+}
+
+static std::vector<std::string> splitModels(const std::string& models) {
+    std::vector<std::string> result;
+    std::stringstream stream(models);
+    std::string model;
+    while (std::getline(stream, model, ',')) {
+        if (!model.empty()) {
+            result.push_back(model);
+        }
+    }
+    return result;
+}
+
+// The same transformations configuration and prerequisites as in CPU plugin
+static LowPrecisionTransformer createTransformer() {
+    auto params = LayerTransformation::Params(
+        true,  // updatePrecisions
+        LayerTransformation::QuantizedTensorAlignment::UpdateLevel,  // quantizedTensorAlignmentOnActivations
+        LayerTransformation::QuantizedTensorAlignment::None,  // quantizedTensorAlignmentOnWeights
+        true);  // supportAsymmetricQuantization
+    LowPrecisionTransformer transformer(LowPrecisionTransformer::getAllTransformations(params)
+        .add<ConvolutionTransformation, ngraph::opset1::Convolution>(
+            LayerTransformation::Params(params).setPrecisionsOnActivations({ngraph::element::u8}).setSupportAsymmetricQuantization(true))
+        .add<GroupConvolutionTransformation, ngraph::opset1::GroupConvolution>(
+            LayerTransformation::Params(params).setPrecisionsOnActivations({ ngraph::element::u8 }).setSupportAsymmetricQuantization(true))
+        .addStandaloneCleanup<MultiplyToGroupConvolutionTransformation, ngraph::opset1::Multiply>(
+            LayerTransformation::Params(params).setPrecisionsOnActivations({ ngraph::element::u8 })));
+    transformer.setCollectStatistics(true);
+    return transformer;
+}
+
+static void runPrerequisites(const std::shared_ptr<ngraph::Function>& function) {
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::pass::InitNodeInfo>();
+    auto lptPrerequisites = manager.register_pass<ngraph::pass::GraphRewrite>();
+    const std::vector<ngraph::element::Type> supportedTypes = { ngraph::element::i8, ngraph::element::u8 };
+    lptPrerequisites->add_matcher<PullReshapeThroughDequantization>(supportedTypes);
+    lptPrerequisites->add_matcher<PullTransposeThroughDequantization>(supportedTypes);
+    lptPrerequisites->add_matcher<ngraph::pass::LinOpSequenceFusion>();
+    manager.run_passes(function);
+}
+
+static void benchmark(InferenceEngine::Core& ie, const std::string& model) {
+    auto network = ie.ReadNetwork(model);
+    const auto function = network.getFunction();
+    if (function == nullptr) {
+        throw std::logic_error("Model " + model + " is not represented by nGraph function");
+    }
+
+    std::cout << "Model: " << model << std::endl;
+    if (!LowPrecisionTransformer::isFunctionQuantized(function)) {
+        std::cout << "    model is not quantized, skipped" << std::endl << std::endl;
+        return;
+    }
+
+    auto transformer = createTransformer();
+
+    // statistics are accumulated over all iterations
+    std::vector<Milliseconds> totals;
+    std::vector<std::pair<std::string, Milliseconds>> stages;
+    std::map<std::string, TransformationStatistics> transformations;
+    size_t nodesCount = 0ul;
+    for (uint32_t iteration = 0; iteration < FLAGS_niter; ++iteration) {
+        const auto clonedFunction = ngraph::clone_function(*function);
+        runPrerequisites(clonedFunction);
+        nodesCount = clonedFunction->get_ops().size();
+
+        const auto start = std::chrono::steady_clock::now();
+        transformer.transform(clonedFunction);
+        totals.push_back(std::chrono::duration_cast<Milliseconds>(std::chrono::steady_clock::now() - start));
+
+        const LowPrecisionStatistics& statistics = transformer.getStatistics();
+        stages.resize(statistics.stages.size());
+        for (size_t i = 0; i < statistics.stages.size(); ++i) {
+            stages[i].first = statistics.stages[i].first;
+            stages[i].second += std::chrono::duration_cast<Milliseconds>(statistics.stages[i].second);
+        }
+        for (const auto& it : statistics.transformations) {
+            TransformationStatistics& accumulated = transformations[it.first];
+            accumulated.matched += it.second.matched;
+            accumulated.transformed += it.second.transformed;
+            accumulated.duration += it.second.duration;
+        }
+    }
+
+    std::sort(totals.begin(), totals.end());
+    Milliseconds sum{0};
+    for (const auto& total : totals) {
+        sum += total;
+    }
+
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "    operations:     " << nodesCount << std::endl;
+    std::cout << "    iterations:     " << FLAGS_niter << std::endl;
+    std::cout << "    mean time (ms): " << sum.count() / totals.size() << std::endl;
+    std::cout << "    min time (ms):  " << totals.front().count() << std::endl;
+    std::cout << "    max time (ms):  " << totals.back().count() << std::endl;
+
+    std::cout << "    stages, mean time (ms):" << std::endl;
+    for (const auto& stage : stages) {
+        std::cout << "        " << std::left << std::setw(24) << stage.first << std::right << stage.second.count() / FLAGS_niter << std::endl;
+    }
+
+    std::vector<std::pair<std::string, TransformationStatistics>> sorted(transformations.begin(), transformations.end());
+    std::sort(sorted.begin(), sorted.end(),
+        [](const std::pair<std::string, TransformationStatistics>& a, const std::pair<std::string, TransformationStatistics>& b) {
+            return a.second.duration > b.second.duration;
+        });
+    if (sorted.size() > FLAGS_top) {
+        sorted.resize(FLAGS_top);
+    }
+
+    std::cout << "    transformations, mean time (ms) / matched / transformed per iteration:" << std::endl;
+    for (const auto& it : sorted) {
+        std::cout << "        " << std::left << std::setw(72) << it.first << std::right <<
+            std::chrono::duration_cast<Milliseconds>(it.second.duration).count() / FLAGS_niter << " / " <<
+            it.second.matched / FLAGS_niter << " / " <<
+            it.second.transformed / FLAGS_niter << std::endl;
+    }
+    std::cout << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    try {
+        std::cout << "Inference Engine: " << InferenceEngine::GetInferenceEngineVersion() << std::endl;
+        std::cout << std::endl;
+
+        if (!parseCommandLine(&argc, &argv)) {
+            return EXIT_SUCCESS;
+        }
+
+        InferenceEngine::Core ie;
+        for (const auto& model : splitModels(FLAGS_m)) {
+            benchmark(ie, model);
+        }
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << std::endl;
+        return EXIT_FAILURE;
+    } catch (...) {
+        std::cerr << "Unknown/internal exception happened." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -103,13 +103,13 @@ namespace ngraph
         /// Graph rewrite pass is used for matcher passes execution on Function.
         /// To register MatcherPass use \sa add_matcher<T>(args) method where T is a MatcherPass
         /// class.
-        /// As a default algorithm graph rewrite pass traverse Function in topological order and
-        /// applies
-        /// registered matcher passes for each node. But if all registered matcher passes have type
-        /// based
-        /// root node in Matcher pattern then efficient mechanism is used to execute them.
-        /// Matcher pattern root is type based if it's operation from opset or
-        /// pattern::op::WrapType.
+        /// Graph rewrite pass traverses Function in topological order and applies registered
+        /// matcher passes for each node. Matcher passes with type based root node in Matcher
+        /// pattern are executed only for nodes of matching type (or derived from it), other
+        /// matcher passes are executed for each node. Matcher pattern root is type based if it's
+        /// operation from opset, pattern::op::WrapType, or pattern::op::Label and
+        /// pattern::op::Or wrapping type based patterns. Nodes replaced by previously applied
+        /// matcher passes are not visited.
         /// Note: when implementing pattern for Matcher make sure that root node is an operation
         /// from opset
         /// or has ngraph::pattern::op::WrapType. That will help GraphRewrite to execute matcher
@@ -16,6 +16,7 @@
 #include "ngraph/runtime/reference/helpers.hpp"
 #include "ngraph/runtime/reference/reverse.hpp"
 #include "ngraph/runtime/reference/split.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/util.hpp"
 
 // can't be removed currently due to arm-plugin dependency
@@ -273,17 +274,26 @@ namespace ngraph
                 const Shape filter_shape(++filters_shape.begin(), filters_shape.end());
                 const size_t filter_size = shape_size(filter_shape);
 
-                auto batch = in;
-                for (size_t batch_idx = 0; batch_idx < batches_count; ++batch_idx)
-                {
-                    auto filter = f;
-                    for (size_t f_idx = 0; f_idx < filters_count; ++f_idx)
-                    {
-                        convolve_3D_channels(params, batch, batch_shape, filter, filter_shape, out);
-                        filter += filter_size;
-                    }
-                    batch += batch_size;
-                }
+                const Shape out_spatial_shape(std::next(out_shape.begin(), 2), out_shape.end());
+                const size_t out_spatial_size = shape_size(out_spatial_shape);
+
+                // every (batch, filter) pair produces its own output channel
+                parallel_for(batches_count * filters_count,
+                             parallel_grain(out_spatial_size * filter_size),
+                             [&](size_t begin, size_t end) {
+                                 for (size_t item = begin; item < end; ++item)
+                                 {
+                                     const T* batch = in + item / filters_count * batch_size;
+                                     const T* filter = f + item % filters_count * filter_size;
+                                     T* out_channel = out + item * out_spatial_size;
+                                     convolve_3D_channels(params,
+                                                          batch,
+                                                          batch_shape,
+                                                          filter,
+                                                          filter_shape,
+                                                          out_channel);
+                                 }
+                             });
             }
 
             // DEPRECATED, can't be removed currently due to kmb-plugin dependency (#47799)
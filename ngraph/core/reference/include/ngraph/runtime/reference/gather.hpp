@@ -6,6 +6,7 @@
 
 #include <numeric>
 
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape.hpp"
 #include "utils/span.hpp"
 
@@ -37,16 +38,21 @@ namespace ngraph
                 int64_t batch_indices_mul = shape_size(span(indices_shape).subspan(batch_dims));
 
                 int64_t axis_size = data_shape[axis];
-                int64_t data_offset, out_offset, idx;
 
-                for (int64_t batch = 0; batch < batch_size; batch++)
-                    for (int64_t outer_idx = 0; outer_idx < outer_size; outer_idx++)
-                    {
-                        data_offset = batch_data_mul * batch + inner_size * axis_size * outer_idx;
-                        out_offset = batch_out_mul * batch + indices_size * inner_size * outer_idx;
-                        for (int64_t i = 0; i < indices_size; i++)
+                const int64_t work_amount = batch_size * outer_size * indices_size;
+                parallel_for(
+                    work_amount, parallel_grain(inner_size), [&](size_t begin, size_t end) {
+                        for (int64_t item = begin; item < static_cast<int64_t>(end); item++)
                         {
-                            idx = indices[i + batch_indices_mul * batch];
+                            const int64_t i = item % indices_size;
+                            const int64_t outer_idx = item / indices_size % outer_size;
+                            const int64_t batch = item / indices_size / outer_size;
+
+                            const int64_t data_offset =
+                                batch_data_mul * batch + inner_size * axis_size * outer_idx;
+                            const int64_t out_offset =
+                                batch_out_mul * batch + indices_size * inner_size * outer_idx;
+                            int64_t idx = indices[i + batch_indices_mul * batch];
                             // clang-format off
                             // todo: check if bound check is needed
                             // if (idx >= axis_size || (idx < 0 && -idx >= axis_size))
@@ -60,7 +66,7 @@ namespace ngraph
                             const auto out_ptr = std::next(out, out_offset + inner_size * i);
                             std::copy(src_begin, src_end, out_ptr);
                         }
-                    }
+                    });
             }
 
         } // namespace reference
@@ -96,7 +96,6 @@ namespace ngraph
 
                 const size_t group_count = filter_shape[filter_group_axis];
 
-                const INPUT* group_batch = in;
                 const Shape group_batch_shape = [&]() {
                     Shape new_shape{in_shape};
                     new_shape[in_batch_axis] = 1;
@@ -105,14 +104,12 @@ namespace ngraph
                 }();
                 const size_t group_batch_size = shape_size(group_batch_shape);
 
-                const FILTER* group_filter = f;
                 const Shape group_filter_shape = [&]() {
                     Shape new_shape{++filter_shape.begin(), filter_shape.end()};
                     return new_shape;
                 }();
                 const size_t group_filter_size = shape_size(group_filter_shape);
 
-                OUTPUT* group_out = out;
                 const Shape group_out_shape = [&]() {
                     Shape new_shape{out_shape};
                     new_shape[out_batch_axis] = 1;
@@ -121,24 +118,40 @@ namespace ngraph
                 }();
                 const size_t group_out_size = shape_size(group_out_shape);
 
-                for (size_t batch_idx = 0; batch_idx < in_shape[in_batch_axis]; ++batch_idx)
+                const auto convolve_group = [&](size_t item) {
+                    const size_t group_idx = item % group_count;
+                    runtime::reference::convolution(in + item * group_batch_size,
+                                                    f + group_idx * group_filter_size,
+                                                    out + item * group_out_size,
+                                                    group_batch_shape,
+                                                    group_filter_shape,
+                                                    group_out_shape,
+                                                    strides,
+                                                    dilation,
+                                                    pads_begin,
+                                                    pads_end);
+                };
+
+                // (batch, group) pairs are independent, but when there are fewer of them than
+                // threads it is better to let every convolution split its output channels
+                const size_t items_count = in_shape[in_batch_axis] * group_count;
+                if (items_count >= get_num_threads())
                 {
-                    group_filter = f;
-                    for (size_t group_idx = 0; group_idx < group_count; ++group_idx)
+                    parallel_for(items_count,
+                                 parallel_grain(group_out_size * group_filter_size /
+                                                std::max<size_t>(group_filter_shape[0], 1)),
+                                 [&](size_t begin, size_t end) {
+                                     for (size_t item = begin; item < end; ++item)
+                                     {
+                                         convolve_group(item);
+                                     }
+                                 });
+                }
+                else
+                {
+                    for (size_t item = 0; item < items_count; ++item)
                     {
-                        runtime::reference::convolution(group_batch,
-                                                        group_filter,
-                                                        group_out,
-                                                        group_batch_shape,
-                                                        group_filter_shape,
-                                                        group_out_shape,
-                                                        strides,
-                                                        dilation,
-                                                        pads_begin,
-                                                        pads_end);
-                        group_batch += group_batch_size;
-                        group_filter += group_filter_size;
-                        group_out += group_out_size;
+                        convolve_group(item);
                     }
                 }
             }
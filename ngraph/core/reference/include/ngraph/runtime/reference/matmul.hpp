@@ -11,6 +11,7 @@
 
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
 #include "ngraph/runtime/reference/broadcast.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -21,39 +22,134 @@ namespace ngraph
         {
             namespace details
             {
-                template <typename T>
-                void dot(const T* arg0,
-                         const T* arg1,
-                         T* out,
-                         const Shape& arg0_shape,
-                         const Shape& arg1_shape,
-                         const Shape& out_shape)
-                {
-                    std::fill(out, out + shape_size(out_shape), T{0});
-                    const size_t arg0_rank = arg0_shape.size();
-                    const size_t arg1_rank = arg1_shape.size();
+                /// \brief Number of output columns computed by one work item of dot, the
+                ///        rows of a work item reuse the arg1 panel of that many columns.
+                constexpr size_t dot_block_columns = 256;
+                /// \brief Number of output rows computed at once, they share the loads of
+                ///        arg1 elements.
+                constexpr size_t dot_block_rows = 4;
 
+                struct DotDims
+                {
                     // 2D inputs shapes are interpreted as {I, K} x {K, J}
                     // If first input is 1D tensor of shape {K}, it is interpreted as {1, K}
                     // If second input is 1D tensor of shape {K}, it is interpreted as {K, 1}
-                    const size_t I_dim = arg0_rank == 1 ? 1 : arg0_shape[arg0_rank - 2];
-                    const size_t J_dim = arg1_rank == 1 ? 1 : arg1_shape[arg1_rank - 1];
-                    const size_t K_dim =
-                        arg1_rank == 1 ? arg1_shape[arg1_rank - 1] : arg1_shape[arg1_rank - 2];
+                    DotDims(const Shape& arg0_shape, const Shape& arg1_shape)
+                        : I{arg0_shape.size() == 1 ? 1 : arg0_shape[arg0_shape.size() - 2]}
+                        , J{arg1_shape.size() == 1 ? 1 : arg1_shape[arg1_shape.size() - 1]}
+                        , K{arg1_shape.size() == 1 ? arg1_shape[arg1_shape.size() - 1]
+                                                   : arg1_shape[arg1_shape.size() - 2]}
+                    {
+                    }
+
+                    size_t row_blocks() const
+                    {
+                        return (I + dot_block_rows - 1) / dot_block_rows;
+                    }
+
+                    size_t I;
+                    size_t J;
+                    size_t K;
+                };
 
-                    for (size_t i = 0; i < I_dim; ++i)
+                /// \brief Accumulates the block of rows [i_begin, i_end) and columns
+                ///        [j_begin, j_end) of the product into out. Every output element is
+                ///        summed up over k in ascending order, like in the naive triple loop.
+                template <typename T>
+                void dot_block(const T* arg0,
+                               const T* arg1,
+                               T* out,
+                               const DotDims& dims,
+                               size_t i_begin,
+                               size_t i_end,
+                               size_t j_begin,
+                               size_t j_end)
+                {
+                    const size_t K = dims.K;
+                    const size_t J = dims.J;
+                    size_t i = i_begin;
+                    for (; i + dot_block_rows <= i_end; i += dot_block_rows)
                     {
-                        for (size_t k = 0; k < K_dim; ++k)
+                        const T* a = arg0 + i * K;
+                        T* out0 = out + i * J;
+                        T* out1 = out0 + J;
+                        T* out2 = out1 + J;
+                        T* out3 = out2 + J;
+                        for (size_t k = 0; k < K; ++k)
                         {
-                            const size_t a_idx = i * K_dim + k;
-                            for (size_t j = 0; j < J_dim; ++j)
+                            const T a0 = a[k];
+                            const T a1 = a[K + k];
+                            const T a2 = a[2 * K + k];
+                            const T a3 = a[3 * K + k];
+                            const T* b_row = arg1 + k * J;
+                            for (size_t j = j_begin; j < j_end; ++j)
                             {
-                                const size_t b_idx = k * J_dim + j;
-                                const size_t out_idx = i * J_dim + j;
-                                out[out_idx] += arg0[a_idx] * arg1[b_idx];
+                                const T b = b_row[j];
+                                out0[j] += a0 * b;
+                                out1[j] += a1 * b;
+                                out2[j] += a2 * b;
+                                out3[j] += a3 * b;
                             }
                         }
                     }
+                    for (; i < i_end; ++i)
+                    {
+                        const T* a = arg0 + i * K;
+                        T* out_row = out + i * J;
+                        for (size_t k = 0; k < K; ++k)
+                        {
+                            const T a0 = a[k];
+                            const T* b_row = arg1 + k * J;
+                            for (size_t j = j_begin; j < j_end; ++j)
+                            {
+                                out_row[j] += a0 * b_row[j];
+                            }
+                        }
+                    }
+                }
+
+                /// \brief Computes the row block of the product, work items are row blocks
+                ///        within column blocks, so a chunk of them reuses arg1 panels.
+                template <typename T>
+                void dot_item(const T* arg0,
+                              const T* arg1,
+                              T* out,
+                              const DotDims& dims,
+                              size_t item)
+                {
+                    const size_t i_begin = item % dims.row_blocks() * dot_block_rows;
+                    const size_t j_begin = item / dims.row_blocks() * dot_block_columns;
+                    dot_block(arg0,
+                              arg1,
+                              out,
+                              dims,
+                              i_begin,
+                              std::min(i_begin + dot_block_rows, dims.I),
+                              j_begin,
+                              std::min(j_begin + dot_block_columns, dims.J));
+                }
+
+                template <typename T>
+                void dot(const T* arg0,
+                         const T* arg1,
+                         T* out,
+                         const Shape& arg0_shape,
+                         const Shape& arg1_shape,
+                         const Shape& out_shape)
+                {
+                    std::fill(out, out + shape_size(out_shape), T{0});
+                    const DotDims dims{arg0_shape, arg1_shape};
+                    const size_t column_blocks =
+                        (dims.J + dot_block_columns - 1) / dot_block_columns;
+                    parallel_for(dims.row_blocks() * column_blocks,
+                                 parallel_grain(dims.K * dot_block_rows *
+                                                std::min(dims.J, dot_block_columns)),
+                                 [&](size_t begin, size_t end) {
+                                     for (size_t item = begin; item < end; ++item)
+                                     {
+                                         dot_item(arg0, arg1, out, dims, item);
+                                     }
+                                 });
                 }
 
                 std::vector<size_t> get_transpose_order(const Shape& input_shape)
@@ -243,15 +339,25 @@ namespace ngraph
                 const size_t arg0_offset = (arg0_rank > 2) ? shape_size(dot_arg0_shape) : 0;
                 const size_t arg1_offset = (arg1_rank > 2) ? shape_size(dot_arg1_shape) : 0;
                 const size_t output_offset = shape_size(dot_output_shape);
-                for (size_t i = 0; i < output_batch_size; i++)
-                {
-                    details::dot(arg0_data + i * arg0_offset,
-                                 arg1_data + i * arg1_offset,
-                                 out + i * output_offset,
-                                 dot_arg0_shape,
-                                 dot_arg1_shape,
-                                 dot_output_shape);
-                }
+                const details::DotDims dims{dot_arg0_shape, dot_arg1_shape};
+                const size_t batch_items = dims.row_blocks() *
+                                           ((dims.J + details::dot_block_columns - 1) /
+                                            details::dot_block_columns);
+                std::fill(out, out + output_batch_size * output_offset, T{0});
+                parallel_for(output_batch_size * batch_items,
+                             parallel_grain(dims.K * details::dot_block_rows *
+                                            std::min(dims.J, details::dot_block_columns)),
+                             [&](size_t begin, size_t end) {
+                                 for (size_t item = begin; item < end; ++item)
+                                 {
+                                     const size_t batch = item / batch_items;
+                                     details::dot_item(arg0_data + batch * arg0_offset,
+                                                       arg1_data + batch * arg1_offset,
+                                                       out + batch * output_offset,
+                                                       dims,
+                                                       item % batch_items);
+                                 }
+                             });
             }
         }
     }
@@ -5,7 +5,6 @@
 #pragma once
 
 #include <cmath>
-#include <map>
 #include <vector>
 
 #include "ngraph/coordinate_transform.hpp"
@@ -27,53 +26,21 @@ namespace ngraph
                       const AxisSet& reduction_axes,
                       bool keep_dims)
             {
-                auto out_shape = reduce(in_shape, reduction_axes, keep_dims);
-                CoordinateTransform output_transform(out_shape);
-                std::vector<T> cs(shape_size(out_shape));
+                sum(arg, out, in_shape, reduction_axes, keep_dims);
 
-                for (const Coordinate& output_coord : output_transform)
+                int count = 1;
+                for (const auto axis : reduction_axes)
                 {
-                    out[output_transform.index(output_coord)] = 0;
-                    cs[output_transform.index(output_coord)] = 0;
+                    count *= static_cast<int>(in_shape[axis]);
                 }
-
-                CoordinateTransform input_transform(in_shape);
-                std::map<size_t, int> index_to_count_map;
-
-                for (const Coordinate& input_coord : input_transform)
+                if (count == 0)
                 {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes, keep_dims);
-
-                    T x = arg[input_transform.index(input_coord)];
-                    T& z = out[output_transform.index(output_coord)];
-                    auto index = output_transform.index(output_coord);
-                    if (index_to_count_map.find(index) == index_to_count_map.end())
-                    {
-                        index_to_count_map[index] = 1;
-                    }
-                    else
-                    {
-                        index_to_count_map[index]++;
-                    }
-
-                    if (is_finite(x) && is_finite(z))
-                    {
-                        T& c = cs[output_transform.index(output_coord)];
-                        T t = z + (x - c);
-                        c = (t - z) - (x - c);
-                        z = t;
-                    }
-                    else
-                    {
-                        z = z + x;
-                    }
+                    return;
                 }
-
-                for (const Coordinate& output_coord : output_transform)
+                const size_t out_size = shape_size(reduce(in_shape, reduction_axes, keep_dims));
+                for (size_t i = 0; i < out_size; ++i)
                 {
-                    auto count = index_to_count_map[output_transform.index(output_coord)];
-                    out[output_transform.index(output_coord)] =
-                        out[output_transform.index(output_coord)] / count;
+                    out[i] = out[i] / count;
                 }
             }
         }
@@ -8,6 +8,7 @@
 #include <limits>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/utils/reduction.hpp"
 #include "ngraph/shape_util.hpp"
 
 #ifdef _WIN32
@@ -20,37 +21,36 @@ namespace ngraph
     {
         namespace reference
         {
+            namespace details
+            {
+                template <typename T>
+                struct MinAccumulator
+                {
+                    void operator()(T x)
+                    {
+                        if (x < min)
+                        {
+                            min = x;
+                        }
+                    }
+
+                    T result() const { return min; }
+                    T min;
+                };
+            } // namespace details
+
             template <typename T>
             void min(const T* arg,
                      T* out,
                      const Shape& in_shape,
                      const AxisSet& reduction_axes,
-                     const bool keep_dims)
+                     const bool /* keep_dims */)
             {
                 T minval = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
                                                                 : std::numeric_limits<T>::max();
 
-                const auto out_shape = reduce(in_shape, reduction_axes, keep_dims);
-                CoordinateTransform output_transform(out_shape);
-
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = minval;
-                }
-
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes, keep_dims);
-
-                    T x = arg[input_transform.index(input_coord)];
-                    T min = out[output_transform.index(output_coord)];
-                    if (x < min)
-                    {
-                        out[output_transform.index(output_coord)] = x;
-                    }
-                }
+                reduce_elements(
+                    arg, out, in_shape, reduction_axes, details::MinAccumulator<T>{minval});
             }
         } // namespace reference
     }     // namespace runtime
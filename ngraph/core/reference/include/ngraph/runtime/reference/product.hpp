@@ -7,6 +7,7 @@
 #include <cmath>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/utils/reduction.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -15,31 +16,26 @@ namespace ngraph
     {
         namespace reference
         {
+            namespace details
+            {
+                template <typename T>
+                struct ProductAccumulator
+                {
+                    void operator()(T x) { product = product * x; }
+                    T result() const { return product; }
+                    T product = 1;
+                };
+            } // namespace details
+
             template <typename T>
             void product(const T* arg,
                          T* out,
                          const Shape& in_shape,
                          const AxisSet& reduction_axes,
-                         bool keep_dims)
+                         bool /* keep_dims */)
             {
-                auto out_shape = reduce(in_shape, reduction_axes, keep_dims);
-                CoordinateTransform output_transform(out_shape);
-
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = 1;
-                }
-
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes, keep_dims);
-
-                    size_t output_index = output_transform.index(output_coord);
-
-                    out[output_index] = out[output_index] * arg[input_transform.index(input_coord)];
-                }
+                reduce_elements(
+                    arg, out, in_shape, reduction_axes, details::ProductAccumulator<T>{});
             }
         }
     }
@@ -12,6 +12,8 @@
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+#include "ngraph/runtime/reference/utils/strided_iterator.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -32,29 +34,30 @@ namespace ngraph
                     axes_order = range_vector.data();
                 }
 
-                std::vector<size_t> input_strides(arg_size.size());
-                std::vector<size_t> output_strides(arg_size.size());
-                input_strides.back() = 1;
-                output_strides.back() = 1;
-
-                for (int i = input_strides.size() - 2; i >= 0; i--)
+                const auto input_strides = row_major_strides(arg_size);
+                Shape out_shape(arg_size.size());
+                std::vector<size_t> permuted_strides(arg_size.size());
+                for (size_t i = 0; i < arg_size.size(); ++i)
                 {
-                    input_strides[i] = input_strides[i + 1] * arg_size[i + 1];
-                    output_strides[i] = output_strides[i + 1] * arg_size[axes_order[i + 1]];
+                    out_shape[i] = arg_size[axes_order[i]];
+                    permuted_strides[i] = input_strides[axes_order[i]];
                 }
-                for (int i = 0; i < shape_size(arg_size); ++i)
-                {
-                    size_t in_position = 0;
-                    size_t new_position = i;
 
-                    for (int j = 0; j < arg_size.size(); ++j)
-                    {
-                        in_position +=
-                            (new_position / output_strides[j]) * input_strides[axes_order[j]];
-                        new_position %= output_strides[j];
-                    }
-                    out[i] = arg[in_position];
-                }
+                using Iterator = StridedIterator<2>;
+                const Iterator iterator(out_shape,
+                                        {row_major_strides(out_shape), permuted_strides});
+                const size_t in_stride = iterator.inner_stride(1);
+                parallel_for(iterator.size(), parallel_grain(1), [&](size_t begin, size_t end) {
+                    iterator.for_each_row(
+                        begin, end, [&](const Iterator::Offsets& offsets, size_t count) {
+                            T* dst = out + offsets[0];
+                            const T* src = arg + offsets[1];
+                            for (size_t i = 0; i < count; ++i, src += in_stride)
+                            {
+                                dst[i] = *src;
+                            }
+                        });
+                });
             }
         }
     }
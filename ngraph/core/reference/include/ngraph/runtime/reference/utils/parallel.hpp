@@ -0,0 +1,43 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Returns the number of threads the reference kernels split their work
+            ///        between. It is the number of hardware threads unless it is limited with
+            ///        the NGRAPH_REFERENCE_THREADS environment variable.
+            size_t get_num_threads();
+
+            /// \brief Calls body(begin, end) for disjoint contiguous chunks which cover
+            ///        [0, work_amount). Every chunk holds at least grain_size items, so small
+            ///        problems are run on the calling thread. Calls nested into a running
+            ///        parallel_for are run sequentially.
+            ///
+            /// \param work_amount Number of work items.
+            /// \param grain_size Minimal number of work items processed by one thread.
+            /// \param body Function processing the [begin, end) range of work items.
+            void parallel_for(size_t work_amount,
+                              size_t grain_size,
+                              const std::function<void(size_t, size_t)>& body);
+
+            /// \brief Returns the grain size for work items which take item_cost scalar
+            ///        operations each, so that starting a thread pays off.
+            inline size_t parallel_grain(size_t item_cost)
+            {
+                constexpr size_t min_thread_work = 1 << 16;
+                return std::max<size_t>(1, min_thread_work / std::max<size_t>(item_cost, 1));
+            }
+        } // namespace reference
+    }     // namespace runtime
+} // namespace ngraph
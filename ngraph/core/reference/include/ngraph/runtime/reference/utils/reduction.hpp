@@ -0,0 +1,80 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+#include "ngraph/runtime/reference/utils/strided_iterator.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Reduces arg over reduction_axes. Each output element is computed by its
+            ///        own copy of accumulator, which is called with the reduced input values
+            ///        in row-major order and then asked for result(). The accumulation order
+            ///        is the same for any number of threads.
+            ///
+            /// \param arg Pointer to the input tensor.
+            /// \param out Pointer to the output tensor, keep_dims does not change its layout.
+            /// \param in_shape Shape of the input tensor.
+            /// \param reduction_axes Axes to reduce.
+            /// \param accumulator Initial state of the reduction.
+            template <typename T, typename Accumulator>
+            void reduce_elements(const T* arg,
+                                 T* out,
+                                 const Shape& in_shape,
+                                 const AxisSet& reduction_axes,
+                                 const Accumulator& accumulator)
+            {
+                const auto in_strides = row_major_strides(in_shape);
+                Shape kept_shape;
+                Shape reduced_shape;
+                std::vector<size_t> kept_strides;
+                std::vector<size_t> reduced_strides;
+                for (size_t axis = 0; axis < in_shape.size(); ++axis)
+                {
+                    if (reduction_axes.count(axis) != 0)
+                    {
+                        reduced_shape.push_back(in_shape[axis]);
+                        reduced_strides.push_back(in_strides[axis]);
+                    }
+                    else
+                    {
+                        kept_shape.push_back(in_shape[axis]);
+                        kept_strides.push_back(in_strides[axis]);
+                    }
+                }
+
+                using Iterator = StridedIterator<1>;
+                const Iterator kept(kept_shape, {kept_strides});
+                const Iterator reduced(reduced_shape, {reduced_strides});
+                const size_t reduced_stride = reduced.inner_stride(0);
+
+                parallel_for(
+                    kept.size(), parallel_grain(reduced.size()), [&](size_t begin, size_t end) {
+                        T* dst = out + begin;
+                        kept.for_each(begin, end, [&](const Iterator::Offsets& base) {
+                            Accumulator acc = accumulator;
+                            reduced.for_each_row(
+                                0,
+                                reduced.size(),
+                                [&](const Iterator::Offsets& offsets, size_t count) {
+                                    const T* src = arg + base[0] + offsets[0];
+                                    for (size_t i = 0; i < count; ++i, src += reduced_stride)
+                                    {
+                                        acc(*src);
+                                    }
+                                });
+                            *dst++ = acc.result();
+                        });
+                    });
+            }
+        } // namespace reference
+    }     // namespace runtime
+} // namespace ngraph
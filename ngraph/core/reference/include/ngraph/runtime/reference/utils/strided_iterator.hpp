@@ -0,0 +1,201 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Walks the elements of a shape in row-major order and keeps the linear
+            ///        offsets of N tensors addressed with their own per-axis element strides,
+            ///        e.g. permuted strides of a transposed input or zero strides of a
+            ///        broadcasted one. It replaces CoordinateTransform on hot paths: no
+            ///        Coordinate is materialized per element.
+            ///
+            ///        Unit axes are dropped and adjacent axes which are contiguous in all the
+            ///        tensors are merged, so most traversals end up with rank 1 or 2, which
+            ///        have dedicated loops. The elements are visited in rows along the innermost
+            ///        merged axis: a row of `count` elements starts at `offsets` and advances by
+            ///        inner_stride(i) in the tensor i.
+            template <size_t N>
+            class StridedIterator
+            {
+            public:
+                using Offsets = std::array<size_t, N>;
+
+                StridedIterator(const Shape& shape,
+                                const std::array<std::vector<size_t>, N>& strides)
+                    : m_size{shape_size(shape)}
+                {
+                    for (size_t axis = 0; axis < shape.size(); ++axis)
+                    {
+                        if (shape[axis] == 1)
+                        {
+                            continue;
+                        }
+                        if (!m_shape.empty() && is_contiguous(shape[axis], strides, axis))
+                        {
+                            m_shape.back() *= shape[axis];
+                            for (size_t i = 0; i < N; ++i)
+                            {
+                                m_strides[i].back() = strides[i][axis];
+                            }
+                            continue;
+                        }
+                        m_shape.push_back(shape[axis]);
+                        for (size_t i = 0; i < N; ++i)
+                        {
+                            m_strides[i].push_back(strides[i][axis]);
+                        }
+                    }
+                    if (m_shape.empty())
+                    {
+                        m_shape.push_back(1);
+                        for (auto& tensor_strides : m_strides)
+                        {
+                            tensor_strides.push_back(0);
+                        }
+                    }
+                }
+
+                /// \brief Number of visited elements.
+                size_t size() const noexcept { return m_size; }
+                /// \brief Rank of the shape after unit axes are dropped and axes are merged.
+                size_t rank() const noexcept { return m_shape.size(); }
+                /// \brief Stride of the tensor along a row.
+                size_t inner_stride(size_t tensor) const noexcept
+                {
+                    return m_strides[tensor].back();
+                }
+
+                /// \brief Calls row(offsets, count) for the rows covering the elements with
+                ///        row-major indices [begin, end).
+                template <typename Function>
+                void for_each_row(size_t begin, size_t end, Function&& row) const
+                {
+                    end = std::min(end, m_size);
+                    if (begin >= end)
+                    {
+                        return;
+                    }
+                    const size_t rank = m_shape.size();
+                    const size_t row_size = m_shape.back();
+                    Offsets offsets;
+                    if (rank == 1)
+                    {
+                        for (size_t i = 0; i < N; ++i)
+                        {
+                            offsets[i] = begin * m_strides[i][0];
+                        }
+                        row(offsets, end - begin);
+                    }
+                    else if (rank == 2)
+                    {
+                        size_t outer = begin / row_size;
+                        size_t column = begin % row_size;
+                        for (size_t position = begin; position < end; ++outer, column = 0)
+                        {
+                            for (size_t i = 0; i < N; ++i)
+                            {
+                                offsets[i] = outer * m_strides[i][0] + column * m_strides[i][1];
+                            }
+                            const size_t count = std::min(row_size - column, end - position);
+                            row(offsets, count);
+                            position += count;
+                        }
+                    }
+                    else
+                    {
+                        std::vector<size_t> coordinate(rank);
+                        offsets.fill(0);
+                        for (size_t axis = rank, rest = begin; axis-- > 0;)
+                        {
+                            coordinate[axis] = rest % m_shape[axis];
+                            rest /= m_shape[axis];
+                            for (size_t i = 0; i < N; ++i)
+                            {
+                                offsets[i] += coordinate[axis] * m_strides[i][axis];
+                            }
+                        }
+                        for (size_t position = begin; position < end;)
+                        {
+                            const size_t count =
+                                std::min(row_size - coordinate.back(), end - position);
+                            row(offsets, count);
+                            position += count;
+
+                            // rewind to the beginning of the row and carry to the outer axes
+                            for (size_t i = 0; i < N; ++i)
+                            {
+                                offsets[i] -= coordinate.back() * m_strides[i].back();
+                            }
+                            coordinate.back() = 0;
+                            for (size_t axis = rank - 1; axis-- > 0;)
+                            {
+                                for (size_t i = 0; i < N; ++i)
+                                {
+                                    offsets[i] += m_strides[i][axis];
+                                }
+                                if (++coordinate[axis] < m_shape[axis])
+                                {
+                                    break;
+                                }
+                                for (size_t i = 0; i < N; ++i)
+                                {
+                                    offsets[i] -= coordinate[axis] * m_strides[i][axis];
+                                }
+                                coordinate[axis] = 0;
+                            }
+                        }
+                    }
+                }
+
+                /// \brief Calls element(offsets) for the elements with row-major indices
+                ///        [begin, end).
+                template <typename Function>
+                void for_each(size_t begin, size_t end, Function&& element) const
+                {
+                    for_each_row(begin, end, [&](Offsets offsets, size_t count) {
+                        for (; count > 0; --count)
+                        {
+                            element(static_cast<const Offsets&>(offsets));
+                            for (size_t i = 0; i < N; ++i)
+                            {
+                                offsets[i] += m_strides[i].back();
+                            }
+                        }
+                    });
+                }
+
+            private:
+                bool is_contiguous(size_t dim,
+                                   const std::array<std::vector<size_t>, N>& strides,
+                                   size_t axis) const noexcept
+                {
+                    for (size_t i = 0; i < N; ++i)
+                    {
+                        if (m_strides[i].back() != strides[i][axis] * dim)
+                        {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+
+                size_t m_size;
+                std::vector<size_t> m_shape;
+                std::array<std::vector<size_t>, N> m_strides;
+            };
+        } // namespace reference
+    }     // namespace runtime
+} // namespace ngraph
@@ -2,8 +2,13 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <cstring>
+
 #include "ngraph/runtime/reference/broadcast.hpp"
 #include "ngraph/runtime/reference/tile.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+#include "ngraph/runtime/reference/utils/strided_iterator.hpp"
 
 namespace ngraph
 {
@@ -27,16 +32,70 @@ namespace ngraph
                         adjusted_in_shape.insert(adjusted_in_shape.begin() + axis, 1);
                     }
                 }
+                adjusted_in_shape.insert(
+                    adjusted_in_shape.begin(), output_rank - adjusted_in_shape.size(), 1);
                 Shape adjusted_out_shape = out_shape;
                 adjusted_out_shape.insert(
                     adjusted_out_shape.begin(), output_rank - adjusted_out_shape.size(), 1);
-                std::vector<int64_t> repeats(output_rank);
-                for (size_t i = 0; i < repeats.size(); ++i)
+
+                // Dimensions which are neither equal nor broadcasted from 1 are repeated
+                if (!std::equal(adjusted_in_shape.begin(),
+                                adjusted_in_shape.end(),
+                                adjusted_out_shape.begin(),
+                                [](size_t in_dim, size_t out_dim) {
+                                    return in_dim == out_dim || in_dim == 1;
+                                }))
                 {
-                    repeats[i] = adjusted_out_shape[i] / adjusted_in_shape[i];
+                    std::vector<int64_t> repeats(output_rank);
+                    for (size_t i = 0; i < repeats.size(); ++i)
+                    {
+                        repeats[i] = adjusted_out_shape[i] / adjusted_in_shape[i];
+                    }
+                    return tile(
+                        arg, out, adjusted_in_shape, adjusted_out_shape, elem_size, repeats);
+                }
+
+                auto in_strides = row_major_strides(adjusted_in_shape);
+                for (size_t i = 0; i < output_rank; ++i)
+                {
+                    if (adjusted_in_shape[i] != adjusted_out_shape[i])
+                    {
+                        in_strides[i] = 0;
+                    }
                 }
 
-                return tile(arg, out, adjusted_in_shape, adjusted_out_shape, elem_size, repeats);
+                using Iterator = StridedIterator<2>;
+                const Iterator iterator(adjusted_out_shape,
+                                        {row_major_strides(adjusted_out_shape), in_strides});
+                const size_t in_stride = iterator.inner_stride(1);
+                parallel_for(iterator.size(), parallel_grain(1), [&](size_t begin, size_t end) {
+                    iterator.for_each_row(
+                        begin, end, [&](const Iterator::Offsets& offsets, size_t count) {
+                            char* dst = out + offsets[0] * elem_size;
+                            const char* src = arg + offsets[1] * elem_size;
+                            if (in_stride == 1)
+                            {
+                                memcpy(dst, src, count * elem_size);
+                                return;
+                            }
+                            if (in_stride == 0)
+                            {
+                                // replicate the element doubling the copied block each time
+                                memcpy(dst, src, elem_size);
+                                for (size_t filled = 1; filled < count;)
+                                {
+                                    const size_t block = std::min(filled, count - filled);
+                                    memcpy(dst + filled * elem_size, dst, block * elem_size);
+                                    filled += block;
+                                }
+                                return;
+                            }
+                            for (size_t i = 0; i < count; ++i, src += in_stride * elem_size)
+                            {
+                                memcpy(dst + i * elem_size, src, elem_size);
+                            }
+                        });
+                });
             }
         }
     }
@@ -0,0 +1,89 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <exception>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "ngraph/env_util.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+
+using namespace ngraph;
+
+namespace
+{
+    thread_local bool in_parallel_region = false;
+}
+
+size_t runtime::reference::get_num_threads()
+{
+    static const size_t num_threads = []() -> size_t {
+        const auto limit = getenv_int("NGRAPH_REFERENCE_THREADS", 0);
+        if (limit > 0)
+        {
+            return limit;
+        }
+        return std::max(1u, std::thread::hardware_concurrency());
+    }();
+    return num_threads;
+}
+
+void runtime::reference::parallel_for(size_t work_amount,
+                                      size_t grain_size,
+                                      const std::function<void(size_t, size_t)>& body)
+{
+    if (work_amount == 0)
+    {
+        return;
+    }
+    const size_t max_chunks = std::max<size_t>(1, work_amount / std::max<size_t>(grain_size, 1));
+    const size_t chunks = std::min(get_num_threads(), max_chunks);
+    if (chunks == 1 || in_parallel_region)
+    {
+        body(0, work_amount);
+        return;
+    }
+
+    std::vector<std::exception_ptr> errors(chunks);
+    const auto run_chunk = [&](size_t chunk) {
+        in_parallel_region = true;
+        try
+        {
+            body(work_amount * chunk / chunks, work_amount * (chunk + 1) / chunks);
+        }
+        catch (...)
+        {
+            errors[chunk] = std::current_exception();
+        }
+        in_parallel_region = false;
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(chunks - 1);
+    for (size_t chunk = 1; chunk < chunks; ++chunk)
+    {
+        try
+        {
+            workers.emplace_back(run_chunk, chunk);
+        }
+        catch (const std::system_error&)
+        {
+            // no more threads available, process the chunk on the calling thread
+            run_chunk(chunk);
+        }
+    }
+    run_chunk(0);
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+    for (const auto& error : errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+}
@@ -4,7 +4,11 @@
 
 #include <algorithm>
 #include <deque>
+#include <functional>
 #include <iostream>
+#include <ngraph/pattern/op/any_output.hpp>
+#include <ngraph/pattern/op/label.hpp>
+#include <ngraph/pattern/op/or.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <regex>
 #include <unordered_set>
@@ -13,6 +17,8 @@
 #include "itt.hpp"
 #include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/op/sink.hpp"
+#include "ngraph/op/util/op_types.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
 #include "ngraph/pass/graph_rewrite.hpp"
 #include "perf_counters.hpp"
@@ -71,23 +77,74 @@ namespace ngraph
     }     // namespace pass
 } // namespace ngraph
 
+namespace ngraph
+{
+    namespace pass
+    {
+        namespace
+        {
+            // Collects all node types that can be matched by given pattern root. Returns false if
+            // root can match nodes of arbitrary type (e.g. Label with predicate only, Skip, True,
+            // etc.).
+            bool collect_root_types(std::shared_ptr<Node> root, std::vector<NodeTypeInfo>& types)
+            {
+                // pattern::op::AnyOutput operation automatically appends for multi output
+                // operations inside Matcher and to gen actual root node we need to take it's
+                // parent.
+                if (auto any_output = dynamic_pointer_cast<pattern::op::AnyOutput>(root))
+                {
+                    root = any_output->input_value(0).get_node_shared_ptr();
+                }
+
+                if (auto wrap_type = dynamic_pointer_cast<pattern::op::WrapType>(root))
+                {
+                    const auto& wrapped_types = wrap_type->get_wrapped_types();
+                    types.insert(types.end(), wrapped_types.begin(), wrapped_types.end());
+                    return true;
+                }
+                // Or matches if one of its inputs matches so we need to collect types from all
+                // inputs
+                if (dynamic_pointer_cast<pattern::op::Or>(root))
+                {
+                    for (const auto& input : root->input_values())
+                    {
+                        if (!collect_root_types(input.get_node_shared_ptr(), types))
+                        {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+                // Label matches the same graph value with its wrapped pattern, so root types are
+                // defined by wrapped pattern. Label without wrapped values has pattern::op::True
+                // as input that matches any node.
+                if (dynamic_pointer_cast<pattern::op::Label>(root))
+                {
+                    return root->get_input_size() == 1 &&
+                           collect_root_types(root->get_input_node_shared_ptr(0), types);
+                }
+                if (dynamic_pointer_cast<pattern::op::Pattern>(root))
+                {
+                    return false;
+                }
+                types.push_back(root->get_type_info());
+                return true;
+            }
+        } // namespace
+    }     // namespace pass
+} // namespace ngraph
+
 bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
 {
     OV_ITT_SCOPED_TASK(itt::domains::nGraph, "pass::GraphRewrite::run_on_function");
 
-    bool rewritten = false;
     const auto& pass_config = get_pass_config();
 
-    // Initialize execution queue with nodes in topological order
-    deque<std::shared_ptr<Node>> nodes_to_run;
-    for (auto& node : f->get_ordered_ops())
-    {
-        nodes_to_run.emplace_back(node);
-    }
-
-    // Check that all Matchers in MatcherPasses has type bases root node
-    bool all_roots_has_type = true;
+    // Matchers with type based root node are registered in type_to_matcher map. Matchers which
+    // root can match any node (or legacy matchers without Matcher object) are collected in
+    // generic_matchers and are executed for each node together with type based ones.
     std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
+    std::vector<size_t> generic_matchers;
     for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index)
     {
         // Skip passes that are disabled
@@ -95,157 +152,161 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
             continue;
 
         auto matcher = m_matchers[matcher_index]->get_matcher();
-        if (!matcher)
+        std::vector<NodeTypeInfo> root_types;
+        if (matcher &&
+            collect_root_types(matcher->get_pattern_value().get_node_shared_ptr(), root_types))
         {
-            all_roots_has_type = false;
-            break;
-        }
-
-        auto root = matcher->get_pattern_value().get_node_shared_ptr();
-        // pattern::op::AnyOutput operation automatically appends for multi output operations inside
-        // Matcher and to gen actual root node we need to take it's parent.
-        if (auto any_type = dynamic_pointer_cast<pattern::op::AnyOutput>(root))
-        {
-            root = any_type->input_value(0).get_node_shared_ptr();
-        }
-
-        // if root is an operation from opset or has pattern::op::WrapType type then we can extract
-        // it's type
-        // and use it in unordered_map as key for fast MatcherPass search. Otherwise type is unknown
-        // and default algorithm is used.
-        if (auto p = dynamic_pointer_cast<pattern::op::Pattern>(root))
-        {
-            if (auto any_type = dynamic_pointer_cast<pattern::op::WrapType>(p))
-            {
-                for (const auto& root_type_info : any_type->get_wrapped_types())
-                {
-                    type_to_matcher[root_type_info].push_back(matcher_index);
-                }
-            }
-            else
+            // The same type can be listed several times (e.g. in WrapType and Or) so it must be
+            // registered only once
+            std::sort(root_types.begin(), root_types.end());
+            root_types.erase(std::unique(root_types.begin(), root_types.end()), root_types.end());
+            for (const auto& root_type_info : root_types)
             {
-                all_roots_has_type = false;
-                break;
+                type_to_matcher[root_type_info].push_back(matcher_index);
             }
         }
         else
         {
-            type_to_matcher[root->get_type_info()].push_back(matcher_index);
+            generic_matchers.push_back(matcher_index);
         }
-
-        // TODO: traverse parents for root_type_info in order to register complete list of matchers
-        // including ones triggered by parent type info.
     }
 
-    // This lambda preforms execution of particular MatcherPass on given node.
-    // It automatically handles nodes registered by MatcherPass during transformation and set
-    // transformation callback.
-    auto run_matcher_pass = [&](std::shared_ptr<MatcherPass> m_pass,
-                                std::shared_ptr<Node> node) -> bool {
-        // Keep this property check for backward compatibility. In future transformation property
-        // will be deprecated and removed.
-        if (m_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && f->is_dynamic())
+    // List of matchers to run for each node type including matchers triggered by parent type
+    // info and generic matchers, sorted in order of the registration. Filled lazily when node
+    // with the given type is processed for the first time.
+    std::unordered_map<NodeTypeInfo, std::vector<size_t>> matchers_for_type;
+    auto get_matchers_for_type =
+        [&](const NodeTypeInfo& type_info) -> const std::vector<size_t>& {
+        auto cached = matchers_for_type.find(type_info);
+        if (cached != matchers_for_type.end())
         {
-            NGRAPH_DEBUG << "matcher callback requires static shape but the "
-                            "function is dynamic, skipping this "
-                            "optimization till the shapes are fully "
-                            "materialized";
-            return false;
+            return cached->second;
         }
 
-        // Apply MatcherPass. In case if it returns true no other MatcherPasses will apply
-        // to this node
-        bool status = m_pass->apply(node);
-
-        // In case if MatcherPass registered nodes they will be added to the beginning of execution
-        // queue
-        const auto& new_nodes = m_pass->get_new_nodes();
-        if (!new_nodes.empty())
+        std::vector<size_t> matcher_passes_to_run = generic_matchers;
+        for (auto node_type_info = &type_info; node_type_info;
+             node_type_info = node_type_info->parent)
         {
-            // Need to push nodes in reverse order as we expect that nodes in new_nodes
-            // vector are in topological order
-            for (auto it = new_nodes.rbegin(); it != new_nodes.rend(); it++)
+            auto matchers = type_to_matcher.find(*node_type_info);
+            if (matchers != type_to_matcher.end())
             {
-                nodes_to_run.emplace_front(*it);
+                matcher_passes_to_run.insert(matcher_passes_to_run.end(),
+                                             matchers->second.begin(),
+                                             matchers->second.end());
             }
-            m_pass->clear_new_nodes();
         }
-        return status;
+        std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
+        matcher_passes_to_run.erase(
+            std::unique(matcher_passes_to_run.begin(), matcher_passes_to_run.end()),
+            matcher_passes_to_run.end());
+        return matchers_for_type.emplace(type_info, std::move(matcher_passes_to_run))
+            .first->second;
     };
 
-    // list of matchers to run for a node; define here to keep memory allocated
-    std::vector<size_t> matcher_passes_to_run;
-
-    while (!nodes_to_run.empty())
-    {
-        auto node = nodes_to_run.front();
-        nodes_to_run.pop_front();
-        // Recursive apply Matchers for sub-graph based nodes
-        if (auto sub_graph_node = std::dynamic_pointer_cast<op::util::SubGraphOp>(node))
+    // Node that was replaced by one of previously applied matchers has no consumers anymore and
+    // it is not needed to process it. Parameters, Results and Sinks have no consumers by design.
+    auto is_dead = [](const std::shared_ptr<Node>& node) {
+        if (node->get_output_size() == 0 || op::is_parameter(node) || op::is_output(node) ||
+            dynamic_pointer_cast<op::Sink>(node))
+        {
+            return false;
+        }
+        for (const auto& output : node->outputs())
         {
-            if (auto sub_graph = sub_graph_node->get_function())
+            if (!output.get_target_inputs().empty())
             {
-                run_on_function(sub_graph);
+                return false;
             }
         }
-        // Temporary keep this GraphRewrite property for backward compatibility
-        if (m_enable_shape_inference)
+        return true;
+    };
+
+    std::function<bool(const shared_ptr<Function>&)> apply_matchers =
+        [&](const shared_ptr<Function>& func) -> bool {
+        bool rewritten = false;
+
+        // Initialize execution queue with nodes in topological order. The queue is the worklist of
+        // the rewrite: every node is visited once, nodes registered by a MatcherPass are put in front
+        // of it and nodes replaced by a rewrite are dropped when they reach the front. Consumers of a
+        // rewritten node are still ahead in the queue, so they see the new producers. Producers are not
+        // revisited to keep the results of existing transformations unchanged.
+        deque<std::shared_ptr<Node>> nodes_to_run;
+        for (auto& node : func->get_ordered_ops())
         {
-            node->revalidate_and_infer_types();
+            nodes_to_run.emplace_back(node);
         }
-        // If all Matchers in MatcherPasses has type based root node then we apply efficient
-        // algorithm for finding matchers
-        if (all_roots_has_type)
-        {
-            const DiscreteTypeInfo* node_type_info = &node->get_type_info();
-            matcher_passes_to_run.clear();
-            while (node_type_info)
+
+        // This lambda preforms execution of particular MatcherPass on given node.
+        // It automatically handles nodes registered by MatcherPass during transformation and set
+        // transformation callback.
+        auto run_matcher_pass = [&](const std::shared_ptr<MatcherPass>& m_pass,
+                                    const std::shared_ptr<Node>& node) -> bool {
+            // Keep this property check for backward compatibility. In future transformation
+            // property will be deprecated and removed.
+            if (m_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && func->is_dynamic())
             {
-                auto matchers = type_to_matcher.find(*node_type_info);
-                if (matchers != type_to_matcher.end())
-                {
-                    // do not run found matchers immediately, need to collect all matchers for
-                    // parents
-                    // and sort them in order of the registration
-                    matcher_passes_to_run.insert(matcher_passes_to_run.end(),
-                                                 matchers->second.begin(),
-                                                 matchers->second.end());
-                }
-                node_type_info = node_type_info->parent;
+                NGRAPH_DEBUG << "matcher callback requires static shape but the "
+                                "function is dynamic, skipping this "
+                                "optimization till the shapes are fully "
+                                "materialized";
+                return false;
             }
 
-            std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
-
-            // TODO: type_to_matcher with just collected list of matchers to enable
-            // fast processing at the next time when node with the same type will be processed
+            // Apply MatcherPass. In case if it returns true no other MatcherPasses will apply
+            // to this node
+            bool status = m_pass->apply(node);
 
-            for (size_t matcher_index : matcher_passes_to_run)
+            // In case if MatcherPass registered nodes they will be added to the beginning of
+            // execution queue
+            const auto& new_nodes = m_pass->get_new_nodes();
+            if (!new_nodes.empty())
             {
-                if (run_matcher_pass(m_matchers[matcher_index], node))
+                // Need to push nodes in reverse order as we expect that nodes in new_nodes
+                // vector are in topological order
+                for (auto it = new_nodes.rbegin(); it != new_nodes.rend(); it++)
                 {
-                    rewritten = true;
-                    break;
+                    nodes_to_run.emplace_front(*it);
                 }
+                m_pass->clear_new_nodes();
             }
-        }
-        // Otherwise we use default algorithm that iterates over all registered matcher passes
-        else
+            return status;
+        };
+
+        while (!nodes_to_run.empty())
         {
-            for (auto& m_pass : m_matchers)
+            auto node = nodes_to_run.front();
+            nodes_to_run.pop_front();
+            if (is_dead(node))
             {
-                // Skip passes that are disabled
-                if (pass_config->is_disabled(m_pass->get_type_info()))
-                    continue;
+                continue;
+            }
+            // Recursive apply Matchers for sub-graph based nodes
+            if (auto sub_graph_node = std::dynamic_pointer_cast<op::util::SubGraphOp>(node))
+            {
+                if (auto sub_graph = sub_graph_node->get_function())
+                {
+                    apply_matchers(sub_graph);
+                }
+            }
+            // Temporary keep this GraphRewrite property for backward compatibility
+            if (m_enable_shape_inference)
+            {
+                node->revalidate_and_infer_types();
+            }
 
-                if (run_matcher_pass(m_pass, node))
+            for (size_t matcher_index : get_matchers_for_type(node->get_type_info()))
+            {
+                if (run_matcher_pass(m_matchers[matcher_index], node))
                 {
                     rewritten = true;
                     break;
                 }
             }
         }
-    }
-    return rewritten;
+        return rewritten;
+    };
+
+    return apply_matchers(f);
 }
 
 void pass::GraphRewrite::add_matcher(const shared_ptr<pattern::Matcher>& m,
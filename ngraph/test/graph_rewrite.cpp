@@ -6,6 +6,9 @@
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/pass/graph_rewrite.hpp>
 #include <ngraph/pass/manager.hpp>
+#include <ngraph/pattern/op/label.hpp>
+#include <ngraph/pattern/op/or.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
 #include <util/test_tools.hpp>
 
 NGRAPH_SUPPRESS_DEPRECATED_START
@@ -267,6 +270,176 @@ TEST(GraphRewriteTest, TypeBasedMatcherPassOrder2)
     ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 1);
 }
 
+TEST(GraphRewriteTest, MixedMatcherPassOrder1)
+{
+    auto f = get_derived_function();
+
+    Anchor anchor;
+    anchor.add_matcher<TestPass>()->set_callback(get_callback());
+    anchor.add_matcher<TypeBasedTestPassDerived>()->set_callback(get_callback());
+    anchor.run_on_function(f);
+
+    ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 1);
+    ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 0);
+}
+
+TEST(GraphRewriteTest, MixedMatcherPassOrder2)
+{
+    auto f = get_derived_function();
+
+    Anchor anchor;
+    anchor.add_matcher<TypeBasedTestPassDerived>()->set_callback(get_callback());
+    anchor.add_matcher<TestPass>()->set_callback(get_callback());
+    anchor.run_on_function(f);
+
+    ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 1);
+    ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 0);
+}
+
+class CountingTestPass : public ngraph::pass::MatcherPass
+{
+public:
+    CountingTestPass(const std::shared_ptr<Node>& pattern, size_t& counter)
+        : MatcherPass()
+    {
+        ngraph::graph_rewrite_callback callback = [&counter](pattern::Matcher& m) {
+            ++counter;
+            return false;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(pattern, "CountingTestMatcher");
+        this->register_matcher(m, callback);
+    }
+};
+
+TEST(GraphRewriteTest, WrappedRootMatcherPass)
+{
+    auto data =
+        std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32, ngraph::Shape{3, 1, 2});
+    auto relu = std::make_shared<ngraph::opset3::Relu>(data);
+    auto tanh = std::make_shared<ngraph::opset3::Tanh>(relu);
+    auto f = std::make_shared<ngraph::Function>(ngraph::NodeVector{tanh},
+                                                ngraph::ParameterVector{data});
+
+    size_t label_counter = 0, or_counter = 0, any_counter = 0;
+    Anchor anchor;
+    anchor.add_matcher<CountingTestPass>(
+        std::make_shared<pattern::op::Label>(
+            element::f32, Shape{}, [](const Output<Node>&) { return true; },
+            OutputVector{pattern::wrap_type<opset3::Relu>()}),
+        label_counter);
+    anchor.add_matcher<CountingTestPass>(
+        std::make_shared<pattern::op::Or>(
+            OutputVector{pattern::wrap_type<opset3::Relu>(), pattern::wrap_type<opset3::Tanh>()}),
+        or_counter);
+    anchor.add_matcher<CountingTestPass>(pattern::any_input(), any_counter);
+    anchor.run_on_function(f);
+
+    ASSERT_EQ(label_counter, 1);
+    ASSERT_EQ(or_counter, 2);
+    // Parameter, Relu, Tanh and Result
+    ASSERT_EQ(any_counter, 4);
+}
+
+class ReplaceConsumerTestPass : public ngraph::pass::MatcherPass
+{
+public:
+    ReplaceConsumerTestPass()
+        : MatcherPass()
+    {
+        auto relu = pattern::wrap_type<opset3::Relu>();
+        ngraph::graph_rewrite_callback callback = [](pattern::Matcher& m) {
+            auto consumers = m.get_match_root()->output(0).get_target_inputs();
+            for (const auto& consumer : consumers)
+            {
+                auto node = consumer.get_node()->shared_from_this();
+                if (is_type<opset3::Tanh>(node))
+                {
+                    replace_node(node, m.get_match_root());
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(relu, "ReplaceConsumerTestMatcher");
+        this->register_matcher(m, callback);
+    }
+};
+
+TEST(GraphRewriteTest, ReplacedNodesAreSkipped)
+{
+    auto data =
+        std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32, ngraph::Shape{3, 1, 2});
+    auto relu = std::make_shared<ngraph::opset3::Relu>(data);
+    auto tanh = std::make_shared<ngraph::opset3::Tanh>(relu);
+    auto f = std::make_shared<ngraph::Function>(ngraph::NodeVector{tanh},
+                                                ngraph::ParameterVector{data});
+
+    size_t tanh_counter = 0;
+    Anchor anchor;
+    anchor.add_matcher<ReplaceConsumerTestPass>();
+    anchor.add_matcher<CountingTestPass>(pattern::wrap_type<opset3::Tanh>(), tanh_counter);
+    anchor.run_on_function(f);
+
+    ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 0);
+    ASSERT_EQ(tanh_counter, 0);
+}
+
+class RegisterNewNodeTestPass : public ngraph::pass::MatcherPass
+{
+public:
+    RegisterNewNodeTestPass()
+        : MatcherPass()
+    {
+        auto relu = pattern::wrap_type<opset3::Relu>();
+        ngraph::graph_rewrite_callback callback = [this](pattern::Matcher& m) {
+            auto root = m.get_match_root();
+            if (root->get_friendly_name() != "replace_me")
+            {
+                return false;
+            }
+            auto tanh = register_new_node<opset3::Tanh>(root->input_value(0));
+            replace_node(root, tanh);
+            return true;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(relu, "RegisterNewNodeTestMatcher");
+        this->register_matcher(m, callback);
+    }
+};
+
+TEST(GraphRewriteTest, NodesAreVisitedOnce)
+{
+    const size_t chain_length = 1000;
+    auto data =
+        std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32, ngraph::Shape{3, 1, 2});
+    std::shared_ptr<Node> last = data;
+    for (size_t i = 0; i < chain_length; ++i)
+    {
+        last = std::make_shared<ngraph::opset3::Relu>(last);
+        if (i == chain_length / 2)
+        {
+            last->set_friendly_name("replace_me");
+        }
+    }
+    auto f = std::make_shared<ngraph::Function>(ngraph::NodeVector{last},
+                                                ngraph::ParameterVector{data});
+
+    size_t any_counter = 0, tanh_counter = 0;
+    Anchor anchor;
+    anchor.add_matcher<RegisterNewNodeTestPass>();
+    anchor.add_matcher<CountingTestPass>(pattern::wrap_type<opset3::Tanh>(), tanh_counter);
+    anchor.add_matcher<CountingTestPass>(pattern::any_input(), any_counter);
+    anchor.run_on_function(f);
+
+    ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 1);
+    // only the registered Tanh is visited in addition to the original nodes
+    ASSERT_EQ(tanh_counter, 1);
+    // Parameter, Relu nodes except the replaced one, Tanh and Result
+    ASSERT_EQ(any_counter, chain_length + 2);
+}
+
 TEST(PassConfigTest, Test1)
 {
     {
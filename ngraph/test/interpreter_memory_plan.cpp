@@ -0,0 +1,132 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <iostream>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/host_tensor.hpp"
+#include "runtime/backend.hpp"
+#include "runtime/interpreter/int_executable.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    shared_ptr<Function> make_chain(const Shape& shape, size_t length)
+    {
+        auto param = make_shared<op::Parameter>(element::f32, shape);
+        Output<Node> value = param;
+        for (size_t i = 0; i < length; ++i)
+        {
+            if (i % 2 == 0)
+            {
+                value = make_shared<op::v0::Relu>(value);
+            }
+            else
+            {
+                value = make_shared<op::v0::Negative>(value);
+            }
+        }
+        return make_shared<Function>(OutputVector{value}, ParameterVector{param});
+    }
+
+    template <typename Function>
+    double microseconds_per_call(Function&& function, size_t calls)
+    {
+        const auto start = chrono::steady_clock::now();
+        for (size_t i = 0; i < calls; ++i)
+        {
+            function();
+        }
+        const chrono::duration<double, micro> elapsed = chrono::steady_clock::now() - start;
+        return elapsed.count() / calls;
+    }
+
+    void compare_call_overhead(const string& name, const Shape& shape, size_t length, size_t calls)
+    {
+        const auto function = make_chain(shape, length);
+        auto backend = runtime::Backend::create("INTERPRETER");
+        auto executable = backend->compile(function);
+        auto input = backend->create_tensor(element::f32, shape);
+        auto output = backend->create_tensor(element::f32, shape);
+        copy_data(input, vector<float>(shape_size(shape), 1.f));
+
+        // Function::evaluate allocates every intermediate tensor on each call
+        const auto host_input = static_pointer_cast<runtime::HostTensor>(input);
+        const auto host_output = static_pointer_cast<runtime::HostTensor>(output);
+        const auto evaluate_time = microseconds_per_call(
+            [&]() { function->evaluate({host_output}, {host_input}); }, calls);
+        const auto call_time =
+            microseconds_per_call([&]() { executable->call({output}, {input}); }, calls);
+        cout << name << ": " << length << " ops on " << shape << ", Function::evaluate "
+             << evaluate_time << " us, INTERPRETER call " << call_time << " us" << endl;
+    }
+} // namespace
+
+TEST(INTERPRETER, memory_plan_reuses_arena)
+{
+    const Shape shape{16};
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto executable = backend->compile(make_chain(shape, 10));
+
+    // a chain needs only the input and the output of the current operation
+    const auto tensor_size = shape_size(shape) * sizeof(float);
+    EXPECT_EQ(static_pointer_cast<runtime::interpreter::INTExecutable>(executable)
+                  ->get_arena_size(),
+              2 * tensor_size);
+
+    auto input = backend->create_tensor(element::f32, shape);
+    auto output = backend->create_tensor(element::f32, shape);
+    for (float value : {2.f, -3.f})
+    {
+        copy_data(input, vector<float>(shape_size(shape), value));
+        ASSERT_TRUE(executable->call_with_validate({output}, {input}));
+        // the second Relu zeroes all the values
+        EXPECT_EQ(read_vector<float>(output), vector<float>(shape_size(shape), 0.f));
+    }
+}
+
+TEST(INTERPRETER, memory_plan_keeps_tensors_used_later)
+{
+    const Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto sum = make_shared<op::v1::Add>(A, B);
+    auto square = make_shared<op::v1::Multiply>(sum, sum);
+    auto negative = make_shared<op::v0::Negative>(square);
+    auto difference = make_shared<op::v1::Subtract>(negative, sum);
+    auto constant = op::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    auto scaled = make_shared<op::v1::Multiply>(difference, constant);
+    auto f = make_shared<Function>(OutputVector{scaled, square}, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto executable = backend->compile(f);
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    auto result_square = backend->create_tensor(element::f32, shape);
+
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{0, 1, 0, 1});
+    ASSERT_TRUE(executable->call_with_validate({result, result_square}, {a, b}));
+    EXPECT_EQ(read_vector<float>(result), (vector<float>{-2, -24, -36, -120}));
+    EXPECT_EQ(read_vector<float>(result_square), (vector<float>{1, 9, 9, 25}));
+
+    copy_data(b, vector<float>{1, 0, 1, 0});
+    ASSERT_TRUE(executable->call_with_validate({result, result_square}, {a, b}));
+    EXPECT_EQ(read_vector<float>(result), (vector<float>{-6, -12, -60, -80}));
+    EXPECT_EQ(read_vector<float>(result_square), (vector<float>{4, 4, 16, 16}));
+}
+
+// Call overhead compared with Function::evaluate, run with --gtest_also_run_disabled_tests
+TEST(INTERPRETER, DISABLED_benchmark_call_overhead)
+{
+    compare_call_overhead("small graph", Shape{2}, 20, 10000);
+    compare_call_overhead("large graph", Shape{2}, 2000, 100);
+    compare_call_overhead("large tensors", Shape{1, 64, 56, 56}, 200, 10);
+}
@@ -0,0 +1,429 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/coordinate_index.hpp"
+#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/broadcast.hpp"
+#include "ngraph/runtime/reference/matmul.hpp"
+#include "ngraph/runtime/reference/max.hpp"
+#include "ngraph/runtime/reference/sum.hpp"
+#include "ngraph/runtime/reference/tile.hpp"
+#include "ngraph/runtime/reference/transpose.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+#include "ngraph/runtime/reference/utils/strided_iterator.hpp"
+#include "ngraph/shape_util.hpp"
+
+using namespace ngraph;
+using namespace ngraph::runtime;
+
+namespace
+{
+    // Single-threaded implementations replaced by the parallel kernels. They are the baseline
+    // for the results and for the benchmarks.
+    namespace legacy
+    {
+        template <typename T>
+        void dot(const T* arg0, const T* arg1, T* out, size_t I, size_t J, size_t K)
+        {
+            std::fill(out, out + I * J, T{0});
+            for (size_t i = 0; i < I; ++i)
+            {
+                for (size_t k = 0; k < K; ++k)
+                {
+                    for (size_t j = 0; j < J; ++j)
+                    {
+                        out[i * J + j] += arg0[i * K + k] * arg1[k * J + j];
+                    }
+                }
+            }
+        }
+
+        template <typename T>
+        void sum(const T* arg, T* out, const Shape& in_shape, const AxisSet& reduction_axes)
+        {
+            auto out_shape = reduce(in_shape, reduction_axes, false);
+            CoordinateTransform output_transform(out_shape);
+            std::vector<T> cs(shape_size(out_shape));
+            std::fill(out, out + shape_size(out_shape), T{0});
+
+            CoordinateTransform input_transform(in_shape);
+            for (const Coordinate& input_coord : input_transform)
+            {
+                Coordinate output_coord = reduce(input_coord, reduction_axes, false);
+
+                T x = arg[input_transform.index(input_coord)];
+                T& z = out[output_transform.index(output_coord)];
+                if (reference::is_finite(x) && reference::is_finite(z))
+                {
+                    T& c = cs[output_transform.index(output_coord)];
+                    T t = z + (x - c);
+                    c = (t - z) - (x - c);
+                    z = t;
+                }
+                else
+                {
+                    z = z + x;
+                }
+            }
+        }
+
+        template <typename T>
+        void transpose(const T* arg, T* out, const Shape& arg_shape, const AxisVector& axes_order)
+        {
+            const auto input_strides = row_major_strides(arg_shape);
+            std::vector<size_t> output_strides(arg_shape.size());
+            output_strides.back() = 1;
+            for (int i = output_strides.size() - 2; i >= 0; i--)
+            {
+                output_strides[i] = output_strides[i + 1] * arg_shape[axes_order[i + 1]];
+            }
+            for (size_t i = 0; i < shape_size(arg_shape); ++i)
+            {
+                size_t in_position = 0;
+                size_t new_position = i;
+                for (size_t j = 0; j < arg_shape.size(); ++j)
+                {
+                    in_position +=
+                        (new_position / output_strides[j]) * input_strides[axes_order[j]];
+                    new_position %= output_strides[j];
+                }
+                out[i] = arg[in_position];
+            }
+        }
+
+        void broadcast(const char* arg,
+                       char* out,
+                       const Shape& in_shape,
+                       const Shape& out_shape,
+                       size_t elem_size)
+        {
+            Shape adjusted_in_shape(in_shape);
+            adjusted_in_shape.insert(
+                adjusted_in_shape.begin(), out_shape.size() - in_shape.size(), 1);
+            std::vector<int64_t> repeats(out_shape.size());
+            for (size_t i = 0; i < repeats.size(); ++i)
+            {
+                repeats[i] = out_shape[i] / adjusted_in_shape[i];
+            }
+            reference::tile(arg, out, adjusted_in_shape, out_shape, elem_size, repeats);
+        }
+    } // namespace legacy
+
+    template <typename T>
+    std::vector<T> random_vector(size_t size)
+    {
+        std::mt19937 generator(size);
+        std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+        std::vector<T> data(size);
+        for (auto& value : data)
+        {
+            value = static_cast<T>(distribution(generator));
+        }
+        return data;
+    }
+
+    template <typename Function>
+    double best_time_ms(Function&& function)
+    {
+        double best = std::numeric_limits<double>::max();
+        for (int i = 0; i < 5; ++i)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            function();
+            const std::chrono::duration<double, std::milli> elapsed =
+                std::chrono::steady_clock::now() - start;
+            best = std::min(best, elapsed.count());
+        }
+        return best;
+    }
+
+    template <typename Legacy, typename Parallel>
+    void compare_performance(const std::string& name, Legacy&& legacy, Parallel&& parallel)
+    {
+        const auto legacy_time = best_time_ms(legacy);
+        const auto parallel_time = best_time_ms(parallel);
+        std::cout << name << ": legacy " << legacy_time << " ms, parallel " << parallel_time
+                  << " ms (" << reference::get_num_threads() << " threads), speedup "
+                  << legacy_time / parallel_time << std::endl;
+    }
+
+    std::vector<size_t> offsets_of(const Shape& shape,
+                                   const std::vector<size_t>& strides,
+                                   size_t begin,
+                                   size_t end)
+    {
+        std::vector<size_t> offsets;
+        size_t index = 0;
+        for (const Coordinate& coordinate : CoordinateTransform(shape))
+        {
+            if (index >= begin && index < end)
+            {
+                offsets.push_back(std::inner_product(
+                    coordinate.begin(), coordinate.end(), strides.begin(), size_t{0}));
+            }
+            ++index;
+        }
+        return offsets;
+    }
+} // namespace
+
+TEST(reference_kernels, strided_iterator_merges_contiguous_axes)
+{
+    const Shape shape{2, 1, 3, 4};
+    const auto strides = row_major_strides(shape);
+
+    const reference::StridedIterator<1> contiguous(shape, {strides});
+    EXPECT_EQ(contiguous.rank(), 1);
+    EXPECT_EQ(contiguous.size(), 24);
+    EXPECT_EQ(contiguous.inner_stride(0), 1);
+
+    const reference::StridedIterator<2> broadcasted(shape, {strides, {0, 0, 4, 1}});
+    EXPECT_EQ(broadcasted.rank(), 2);
+
+    const reference::StridedIterator<1> scalar(Shape{}, {std::vector<size_t>{}});
+    EXPECT_EQ(scalar.size(), 1);
+    size_t visited = 0;
+    scalar.for_each(0, 1, [&](const reference::StridedIterator<1>::Offsets& offsets) {
+        EXPECT_EQ(offsets[0], 0);
+        ++visited;
+    });
+    EXPECT_EQ(visited, 1);
+}
+
+TEST(reference_kernels, strided_iterator_matches_coordinate_transform)
+{
+    const Shape shape{3, 4, 5, 2};
+    // strides of the {5, 3, 2, 4} tensor transposed with the {1, 3, 0, 2} order
+    const std::vector<size_t> strides{8, 1, 24, 4};
+    const reference::StridedIterator<2> iterator(shape, {row_major_strides(shape), strides});
+    ASSERT_EQ(iterator.rank(), 4);
+
+    for (const auto& range : std::vector<std::pair<size_t, size_t>>{
+             {0, 120}, {0, 1}, {7, 8}, {3, 57}, {40, 120}, {119, 120}})
+    {
+        std::vector<size_t> dense_offsets;
+        std::vector<size_t> offsets;
+        iterator.for_each(
+            range.first, range.second, [&](const reference::StridedIterator<2>::Offsets& o) {
+                dense_offsets.push_back(o[0]);
+                offsets.push_back(o[1]);
+            });
+        std::vector<size_t> expected_dense(range.second - range.first);
+        std::iota(expected_dense.begin(), expected_dense.end(), range.first);
+        EXPECT_EQ(dense_offsets, expected_dense);
+        EXPECT_EQ(offsets, offsets_of(shape, strides, range.first, range.second));
+    }
+}
+
+TEST(reference_kernels, parallel_for_covers_range)
+{
+    std::vector<std::atomic<int>> visits(100000);
+    reference::parallel_for(visits.size(), 1000, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            visits[i]++;
+        }
+    });
+    EXPECT_TRUE(std::all_of(
+        visits.begin(), visits.end(), [](const std::atomic<int>& v) { return v == 1; }));
+}
+
+TEST(reference_kernels, parallel_for_rethrows)
+{
+    EXPECT_THROW(reference::parallel_for(
+                     100000,
+                     1,
+                     [](size_t begin, size_t end) {
+                         if (end == 100000)
+                         {
+                             throw std::runtime_error("last chunk");
+                         }
+                     }),
+                 std::runtime_error);
+}
+
+TEST(reference_kernels, matmul_matches_naive)
+{
+    const size_t I = 37, J = 130, K = 100;
+    const auto arg0 = random_vector<float>(I * K);
+    const auto arg1 = random_vector<float>(K * J);
+    std::vector<float> expected(I * J);
+    std::vector<float> result(I * J);
+
+    legacy::dot(arg0.data(), arg1.data(), expected.data(), I, J, K);
+    reference::matmul(
+        arg0.data(), arg1.data(), result.data(), {I, K}, {K, J}, {I, J}, false, false);
+    EXPECT_EQ(result, expected);
+
+    const size_t batch = 3;
+    const auto batched_arg0 = random_vector<float>(batch * I * K);
+    std::vector<float> batched_expected(batch * I * J);
+    std::vector<float> batched_result(batch * I * J);
+    for (size_t b = 0; b < batch; ++b)
+    {
+        legacy::dot(batched_arg0.data() + b * I * K,
+                    arg1.data(),
+                    batched_expected.data() + b * I * J,
+                    I,
+                    J,
+                    K);
+    }
+    reference::matmul(batched_arg0.data(),
+                      arg1.data(),
+                      batched_result.data(),
+                      {batch, I, K},
+                      {K, J},
+                      {batch, I, J},
+                      false,
+                      false);
+    EXPECT_EQ(batched_result, batched_expected);
+}
+
+TEST(reference_kernels, reductions_match_naive)
+{
+    const Shape in_shape{7, 5, 33, 3};
+    const auto arg = random_vector<float>(shape_size(in_shape));
+
+    for (const auto& axes : std::vector<AxisSet>{{0, 2}, {1, 3}, {3}, {0, 1, 2, 3}, {}})
+    {
+        const auto out_size = shape_size(reduce(in_shape, axes, false));
+        std::vector<float> expected(out_size);
+        std::vector<float> result(out_size);
+        legacy::sum(arg.data(), expected.data(), in_shape, axes);
+        reference::sum(arg.data(), result.data(), in_shape, axes, false);
+        EXPECT_EQ(result, expected);
+
+        for (size_t i = 0; i < out_size; ++i)
+        {
+            expected[i] = -std::numeric_limits<float>::infinity();
+        }
+        for (const Coordinate& coordinate : CoordinateTransform(in_shape))
+        {
+            auto& z = expected[coordinate_index(reduce(coordinate, axes, false),
+                                                reduce(in_shape, axes, false))];
+            z = std::max(z, arg[coordinate_index(coordinate, in_shape)]);
+        }
+        reference::max(arg.data(), result.data(), in_shape, axes, true);
+        EXPECT_EQ(result, expected);
+    }
+}
+
+TEST(reference_kernels, transpose_matches_naive)
+{
+    const Shape in_shape{4, 5, 6, 7};
+    const AxisVector order{2, 0, 3, 1};
+    const auto arg = random_vector<float>(shape_size(in_shape));
+    std::vector<float> expected(arg.size());
+    std::vector<float> result(arg.size());
+
+    legacy::transpose(arg.data(), expected.data(), in_shape, order);
+    reference::transpose(arg.data(), result.data(), in_shape, order.data());
+    EXPECT_EQ(result, expected);
+}
+
+TEST(reference_kernels, broadcast_matches_tile)
+{
+    const Shape in_shape{3, 1, 5};
+    const Shape out_shape{2, 3, 4, 5};
+    const auto arg = random_vector<float>(shape_size(in_shape));
+    std::vector<float> expected(shape_size(out_shape));
+    std::vector<float> result(shape_size(out_shape));
+
+    legacy::broadcast(reinterpret_cast<const char*>(arg.data()),
+                      reinterpret_cast<char*>(expected.data()),
+                      in_shape,
+                      out_shape,
+                      sizeof(float));
+    reference::broadcast(reinterpret_cast<const char*>(arg.data()),
+                         reinterpret_cast<char*>(result.data()),
+                         in_shape,
+                         out_shape,
+                         {0},
+                         sizeof(float));
+    EXPECT_EQ(result, expected);
+}
+
+// The benchmarks compare the kernels with their single-threaded predecessors, run them with
+// --gtest_also_run_disabled_tests --gtest_filter=reference_kernels.DISABLED_benchmark*
+
+TEST(reference_kernels, DISABLED_benchmark_matmul)
+{
+    const size_t size = 512;
+    const auto arg0 = random_vector<float>(size * size);
+    const auto arg1 = random_vector<float>(size * size);
+    std::vector<float> out(size * size);
+    compare_performance(
+        "matmul 512x512x512",
+        [&]() { legacy::dot(arg0.data(), arg1.data(), out.data(), size, size, size); },
+        [&]() {
+            reference::matmul(arg0.data(),
+                              arg1.data(),
+                              out.data(),
+                              {size, size},
+                              {size, size},
+                              {size, size},
+                              false,
+                              false);
+        });
+}
+
+TEST(reference_kernels, DISABLED_benchmark_sum)
+{
+    const Shape in_shape{64, 256, 256};
+    const AxisSet axes{1};
+    const auto arg = random_vector<float>(shape_size(in_shape));
+    std::vector<float> out(shape_size(reduce(in_shape, axes, false)));
+    compare_performance(
+        "sum {64, 256, 256} over axis 1",
+        [&]() { legacy::sum(arg.data(), out.data(), in_shape, axes); },
+        [&]() { reference::sum(arg.data(), out.data(), in_shape, axes, false); });
+}
+
+TEST(reference_kernels, DISABLED_benchmark_transpose)
+{
+    const Shape in_shape{16, 64, 64, 64};
+    const AxisVector order{0, 2, 3, 1};
+    const auto arg = random_vector<float>(shape_size(in_shape));
+    std::vector<float> out(arg.size());
+    compare_performance(
+        "transpose {16, 64, 64, 64} to NHWC",
+        [&]() { legacy::transpose(arg.data(), out.data(), in_shape, order); },
+        [&]() { reference::transpose(arg.data(), out.data(), in_shape, order.data()); });
+}
+
+TEST(reference_kernels, DISABLED_benchmark_broadcast)
+{
+    const Shape in_shape{1, 64, 1, 1};
+    const Shape out_shape{16, 64, 64, 64};
+    const auto arg = random_vector<float>(shape_size(in_shape));
+    std::vector<float> out(shape_size(out_shape));
+    compare_performance(
+        "broadcast {1, 64, 1, 1} to {16, 64, 64, 64}",
+        [&]() {
+            legacy::broadcast(reinterpret_cast<const char*>(arg.data()),
+                              reinterpret_cast<char*>(out.data()),
+                              in_shape,
+                              out_shape,
+                              sizeof(float));
+        },
+        [&]() {
+            reference::broadcast(reinterpret_cast<const char*>(arg.data()),
+                                 reinterpret_cast<char*>(out.data()),
+                                 in_shape,
+                                 out_shape,
+                                 {},
+                                 sizeof(float));
+        });
+}
@@ -4,6 +4,7 @@
 
 #include "int_executable.hpp"
 #include <cstring>
+#include <map>
 #include "backend_manager.hpp"
 #include "evaluates_map.hpp"
 #include "ngraph/except.hpp"
@@ -17,6 +18,97 @@ using namespace ngraph;
 
 NGRAPH_SUPPRESS_DEPRECATED_START
 
+namespace
+{
+    constexpr size_t arena_alignment = 64;
+
+    /// \brief First-fit allocator of offsets in the arena. It lays out the intermediate
+    ///        tensors at compile time following the order they are produced and released.
+    class ArenaPlanner
+    {
+    public:
+        size_t allocate(size_t size)
+        {
+            size = align(size);
+            if (size == 0)
+            {
+                return 0;
+            }
+            for (auto it = m_free.begin(); it != m_free.end(); ++it)
+            {
+                const size_t offset = it->first;
+                const size_t block_size = it->second;
+                if (block_size >= size)
+                {
+                    m_free.erase(it);
+                    if (block_size > size)
+                    {
+                        m_free.emplace(offset + size, block_size - size);
+                    }
+                    return offset;
+                }
+                if (offset + block_size == m_size)
+                {
+                    // the last free block is too small, grow the arena past its end
+                    m_free.erase(it);
+                    m_size = offset + size;
+                    return offset;
+                }
+            }
+            const size_t offset = m_size;
+            m_size += size;
+            return offset;
+        }
+
+        void release(size_t offset, size_t size)
+        {
+            size = align(size);
+            if (size == 0)
+            {
+                return;
+            }
+            auto it = m_free.emplace(offset, size).first;
+            auto next = std::next(it);
+            if (next != m_free.end() && it->first + it->second == next->first)
+            {
+                it->second += next->second;
+                m_free.erase(next);
+            }
+            if (it != m_free.begin())
+            {
+                auto prev = std::prev(it);
+                if (prev->first + prev->second == it->first)
+                {
+                    prev->second += it->second;
+                    m_free.erase(it);
+                }
+            }
+        }
+
+        size_t size() const { return m_size; }
+
+    private:
+        static size_t align(size_t size)
+        {
+            return (size + arena_alignment - 1) / arena_alignment * arena_alignment;
+        }
+
+        // offset -> size of the free blocks
+        std::map<size_t, size_t> m_free;
+        size_t m_size = 0;
+    };
+
+    bool has_static_layout(const Output<Node>& value)
+    {
+        return value.get_partial_shape().is_static() && value.get_element_type().is_static();
+    }
+
+    size_t tensor_byte_size(const Output<Node>& value)
+    {
+        return shape_size(value.get_shape()) * value.get_element_type().size();
+    }
+} // namespace
+
 runtime::interpreter::INTExecutable::INTExecutable(const shared_ptr<Function>& function,
                                                    bool enable_performance_collection)
     : m_is_compiled{true}
@@ -28,11 +120,125 @@ runtime::interpreter::INTExecutable::INTExecutable(const shared_ptr<Function>& f
         m_nodes.push_back(node);
     }
     set_parameters_and_results(*m_function);
+    build_execution_plan();
+}
+
+void runtime::interpreter::INTExecutable::build_execution_plan()
+{
+    unordered_map<descriptor::Tensor*, size_t> tensor_indices;
+    const auto add_tensor = [&](const Output<Node>& value) {
+        tensor_indices.insert({&value.get_tensor(), m_tensor_values.size()});
+        m_tensor_values.push_back(value);
+    };
+    for (const auto& param : get_parameters())
+    {
+        for (const auto& output : param->outputs())
+        {
+            add_tensor(output);
+        }
+    }
+    for (const auto& result : get_results())
+    {
+        add_tensor(result->output(0));
+    }
+    m_external_tensors_count = m_tensor_values.size();
+    m_tensors.resize(m_external_tensors_count);
+
+    for (const auto& node : m_nodes)
+    {
+        if (is_type<op::Parameter>(node))
+        {
+            continue;
+        }
+        if (const auto constant = as_type_ptr<op::Constant>(node))
+        {
+            // constants are copied once instead of being evaluated on every call
+            add_tensor(constant->output(0));
+            m_tensors.push_back(make_shared<HostTensor>(constant));
+            continue;
+        }
+        ExecutionStep step{node, {}, {}};
+        for (const auto& input : node->inputs())
+        {
+            step.inputs.push_back(tensor_indices.at(&input.get_tensor()));
+        }
+        for (const auto& output : node->outputs())
+        {
+            auto it = tensor_indices.find(&output.get_tensor());
+            if (it == tensor_indices.end())
+            {
+                add_tensor(output);
+                m_tensors.emplace_back();
+                it = tensor_indices.find(&output.get_tensor());
+            }
+            step.outputs.push_back(it->second);
+        }
+        m_steps.push_back(move(step));
+    }
+
+    // The intermediate tensors live from the step producing them till the last step reading
+    // them, the ones which do not overlap in time share memory
+    const size_t not_planned = numeric_limits<size_t>::max();
+    vector<size_t> last_use(m_tensor_values.size(), not_planned);
+    for (size_t step = 0; step < m_steps.size(); ++step)
+    {
+        for (const auto index : m_steps[step].outputs)
+        {
+            last_use[index] = step;
+        }
+        for (const auto index : m_steps[step].inputs)
+        {
+            last_use[index] = step;
+        }
+    }
+    const auto is_planned = [&](size_t index) {
+        return index >= m_external_tensors_count && !m_tensors[index] &&
+               has_static_layout(m_tensor_values[index]);
+    };
+
+    ArenaPlanner planner;
+    vector<size_t> offsets(m_tensor_values.size());
+    vector<vector<size_t>> released_after(m_steps.size());
+    for (size_t step = 0; step < m_steps.size(); ++step)
+    {
+        for (const auto index : m_steps[step].outputs)
+        {
+            if (is_planned(index))
+            {
+                offsets[index] = planner.allocate(tensor_byte_size(m_tensor_values[index]));
+                released_after[last_use[index]].push_back(index);
+            }
+        }
+        for (const auto index : released_after[step])
+        {
+            planner.release(offsets[index], tensor_byte_size(m_tensor_values[index]));
+        }
+    }
+
+    m_arena.reset(new AlignedBuffer(planner.size(), arena_alignment));
+    for (size_t index = m_external_tensors_count; index < m_tensor_values.size(); ++index)
+    {
+        if (is_planned(index))
+        {
+            const auto& value = m_tensor_values[index];
+            m_tensors[index] = make_shared<HostTensor>(value.get_element_type(),
+                                                       value.get_shape(),
+                                                       m_arena->get_ptr<char>() + offsets[index],
+                                                       value.get_tensor().get_name());
+        }
+    }
+}
+
+size_t runtime::interpreter::INTExecutable::get_arena_size() const
+{
+    return m_arena->size();
 }
 
 bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
                                                const vector<shared_ptr<runtime::Tensor>>& inputs)
 {
+    lock_guard<mutex> lock(m_call_mutex);
+
     // convert inputs to HostTensor
     vector<shared_ptr<HostTensor>> func_inputs;
     for (const auto& tensor : inputs)
@@ -53,83 +259,39 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
         func_outputs.push_back(host_tensor);
     }
 
-    // map function params -> HostTensor
-    unordered_map<descriptor::Tensor*, shared_ptr<HostTensor>> tensor_map;
-    size_t input_count = 0;
-    for (const auto& param : get_parameters())
+    const size_t results_count = get_results().size();
+    const size_t inputs_count = m_external_tensors_count - results_count;
+    if (func_inputs.size() < inputs_count || func_outputs.size() < results_count)
     {
-        for (size_t i = 0; i < param->get_output_size(); ++i)
-        {
-            descriptor::Tensor* tensor = &param->output(i).get_tensor();
-            tensor_map.insert({tensor, func_inputs[input_count++]});
-        }
+        throw ngraph_error("Not enough input or output tensors passed to the call");
     }
 
-    // map function outputs -> HostTensor
-    for (size_t output_count = 0; output_count < get_results().size(); ++output_count)
+    // bind function inputs and outputs, tensors with dynamic shapes are created on every call
+    vector<shared_ptr<HostTensor>> tensors(m_tensors);
+    copy_n(func_inputs.begin(), inputs_count, tensors.begin());
+    copy_n(func_outputs.begin(), results_count, tensors.begin() + inputs_count);
+    for (size_t index = m_external_tensors_count; index < tensors.size(); ++index)
     {
-        auto output = get_results()[output_count];
-        if (!is_type<op::Result>(output))
+        if (!tensors[index])
         {
-            throw ngraph_error("One of function's outputs isn't op::Result");
+            tensors[index] = make_shared<HostTensor>(m_tensor_values[index]);
         }
-        descriptor::Tensor* tensor = &output->get_output_tensor(0);
-        tensor_map.insert({tensor, func_outputs[output_count]});
     }
 
-    // for each ordered op in the graph
-    for (const auto& op : m_nodes)
+    HostTensorVector op_inputs;
+    HostTensorVector op_outputs;
+    for (const auto& step : m_steps)
     {
-        if (dynamic_pointer_cast<op::Parameter>(op) != nullptr)
-        {
-            continue;
-        }
-
-        // get op inputs from map
-        vector<shared_ptr<HostTensor>> op_inputs;
-        for (auto input : op->inputs())
-        {
-            descriptor::Tensor* tensor = &input.get_tensor();
-            op_inputs.push_back(tensor_map.at(tensor));
-        }
-
-        // get op outputs from map or create
-        vector<shared_ptr<HostTensor>> op_outputs;
-        for (size_t i = 0; i < op->get_output_size(); ++i)
-        {
-            descriptor::Tensor* tensor = &op->output(i).get_tensor();
-            shared_ptr<HostTensor> host_tensor;
-            auto it = tensor_map.find(tensor);
-            if (it == tensor_map.end())
-            {
-                host_tensor = make_shared<HostTensor>(op->output(i));
-                tensor_map.insert({tensor, host_tensor});
-            }
-            else
-            {
-                host_tensor = it->second;
-            }
-            op_outputs.push_back(host_tensor);
-        }
-
-        // get op type
-        element::Type type;
-        if (is_type<op::Convert>(op) || is_type<op::PriorBox>(op))
-        {
-            type = op->get_input_element_type(0);
-        }
-        else if (is_type<op::v1::Equal>(op) || is_type<op::v1::Greater>(op) ||
-                 is_type<op::v1::GreaterEqual>(op) || is_type<op::v1::Less>(op) ||
-                 is_type<op::v1::LessEqual>(op) || is_type<op::v1::NotEqual>(op))
+        const auto& op = step.node;
+        op_inputs.clear();
+        for (const auto index : step.inputs)
         {
-            // Get the type of the second input, not the first
-            // All BinaryElementwiseComparision ops have the same type for inputs
-            // Select has bool for first input and the type we are interested in for the second
-            type = op->get_input_element_type(1);
+            op_inputs.push_back(tensors[index]);
         }
-        else
+        op_outputs.clear();
+        for (const auto index : step.outputs)
         {
-            type = op->get_output_element_type(0);
+            op_outputs.push_back(tensors[index]);
         }
 
         if (m_performance_counters_enabled)
@@ -7,6 +7,7 @@
 #include <initializer_list>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -48,6 +49,10 @@ public:
 
     void set_nan_check(bool enable);
 
+    /// \brief Returns the size in bytes of the buffer shared by intermediate tensors with
+    ///        static shapes, planned at compile time.
+    size_t get_arena_size() const;
+
     std::vector<PerformanceCounter> get_performance_data() const override;
 
     std::shared_ptr<runtime::Tensor> create_input_tensor(size_t input_index) override;
@@ -66,12 +71,32 @@ protected:
     bool evaluate_node(const std::shared_ptr<Node>& node,
                        const HostTensorVector& outputs,
                        const HostTensorVector& inputs) const;
+    /// \brief Operation of the execution plan. Tensors are referred by indices in the tensor
+    ///        table: function inputs go first, then function outputs, then the other tensors.
+    struct ExecutionStep
+    {
+        std::shared_ptr<Node> node;
+        std::vector<size_t> inputs;
+        std::vector<size_t> outputs;
+    };
+
+    void build_execution_plan();
+
     bool m_is_compiled = false;
     bool m_nan_check_enabled = false;
     bool m_performance_counters_enabled = false;
     std::shared_ptr<Function> m_function;
     std::unordered_map<std::shared_ptr<const Node>, stopwatch> m_timer_map;
     std::vector<std::shared_ptr<Node>> m_nodes;
+    std::vector<ExecutionStep> m_steps;
+    size_t m_external_tensors_count = 0;
+    // intermediate tensors with static shapes are allocated in the arena and constants are
+    // stored once, tensors with dynamic shapes are nullptr and get allocated on every call
+    std::vector<std::shared_ptr<HostTensor>> m_tensors;
+    std::vector<Output<Node>> m_tensor_values;
+    std::unique_ptr<AlignedBuffer> m_arena;
+    // calls share the arena
+    std::mutex m_call_mutex;
 
     static void perform_nan_check(const std::vector<std::shared_ptr<HostTensor>>&,
                                   const Node* op = nullptr);